@@ -1077,11 +1077,78 @@ typedef struct EbSvtAv1EncConfiguration {
      */
     uint8_t noise_norm_strength;
 
+    /**
+     * @brief Hash based motion search pre-pass. Exact 64x64 block matches found
+     * in the reference pictures short-circuit HME and full-pel ME. Aimed at
+     * static or repeated content (slides, lecture capture, surveillance).
+     * Always on for pictures coded as screen content.
+     * 0: disabled
+     * 1: enabled
+     * Default is 0.
+     */
+    Bool enable_hash_me;
+
+    /**
+     * @brief Cross-picture wavefront. A picture that references other pictures of
+     * the same mini-GOP can start its encode as soon as the SB rows it may point
+     * to in its references are reconstructed, instead of waiting for the full
+     * references. The value is the number of SB rows below the current one that
+     * motion vectors may reach into; MD restricts its vectors accordingly.
+     * Forces 64x64 SBs, and turns off CDEF, restoration, MFMV and frame end CDF
+     * updates for reference pictures. Ignored for high bit depth, tiles,
+     * super-res / resize, VBR / CBR, multi-pass, film grain and overlays.
+     * 0: disabled
+     * [1-16]: reference SB row margin
+     * Default is 0.
+     */
+    uint8_t cross_pic_wavefront;
+
+    /**
+     * @brief Static SB fast path. SBs whose source (luma and chroma) is unchanged
+     * from the first list 0 reference are detected ahead of mode decision, and
+     * coded as a single 64x64 zero motion block from that reference without
+     * searching other candidates, partitions or transform types.
+     * Forces 64x64 SBs. Ignored for super-res / resize and non 4:2:0 input.
+     * 0: disabled
+     * 1: enabled
+     * Default is 0.
+     */
+    Bool enable_static_sb_skip;
+
+    /**
+     * @brief Sub-SB parallel mode decision. Once the 64x64 block of an SB is decided,
+     * the partition search (PD0) of its four 32x32 quadrants is shared with idle
+     * EncDec threads, each quadrant being searched without the costs of its
+     * siblings; the 64x64 split decision is then taken on the merged results.
+     * Aimed at low-latency encodes with few SBs per picture. Only applies to
+     * inter pictures using the light PD0 path without intra, with 64x64 SBs.
+     * Ignored when a single EncDec thread is used.
+     * 0: disabled
+     * 1: enabled
+     * Default is 0.
+     */
+    Bool enable_sub_sb_parallel_md;
+
+    /**
+     * @brief MD early termination. Small integer decision models (sums of trees
+     * trained offline on features dumped by the encoder) prune the PD1 search:
+     * the sub-depth of a PD0 block is not tested when it is predicted not to be
+     * split, and an NSQ shape is not tested when it is predicted not to win over
+     * its SQ block. Only applies when MD runs in 8 bit. Setting the environment
+     * variable SVT_ETM_DUMP_FILE to a path writes the model features, with the
+     * decisions of the full search as labels, for training.
+     * 0: disabled
+     * 1: conservative
+     * 2: aggressive
+     * Default is 0.
+     */
+    uint8_t md_early_term_level;
+
     /*Add 128 Byte Padding to Struct to avoid changing the size of the public configuration struct*/
 #if CLN_LP_LVLS
-    uint8_t padding[128 - sizeof(Bool) - 2 * sizeof(uint8_t) - sizeof(uint32_t)];
+    uint8_t padding[128 - 4 * sizeof(Bool) - 4 * sizeof(uint8_t) - sizeof(uint32_t)];
 #else
-    uint8_t padding[128 - 4 * sizeof(Bool) - 10 * sizeof(uint8_t) - sizeof(int8_t)];
+    uint8_t padding[128 - 7 * sizeof(Bool) - 12 * sizeof(uint8_t) - sizeof(int8_t)];
 #endif
 
 } EbSvtAv1EncConfiguration;
@@ -93,6 +93,11 @@
 #define INTRA_REFRESH_TYPE_TOKEN "--irefresh-type" // no Eval
 #define CDEF_ENABLE_TOKEN "--enable-cdef"
 #define SCREEN_CONTENT_TOKEN "--scm"
+#define HASH_ME_TOKEN "--enable-hash-me"
+#define CROSS_PIC_WAVEFRONT_TOKEN "--cross-pic-wavefront"
+#define STATIC_SB_SKIP_TOKEN "--enable-static-sb-skip"
+#define SUB_SB_PARALLEL_MD_TOKEN "--enable-sub-sb-parallel-md"
+#define MD_EARLY_TERM_TOKEN "--md-early-term"
 // --- start: ALTREF_FILTERING_SUPPORT
 #define ENABLE_TF_TOKEN "--enable-tf"
 #define ENABLE_OVERLAYS "--enable-overlays"
@@ -1113,6 +1118,31 @@ ConfigEntry config_entry_specific[] = {
      SCREEN_CONTENT_TOKEN,
      "Set screen content detection level, default is 2 [0: off, 1: on, 2: content adaptive]",
      set_cfg_generic_token},
+    {SINGLE_INPUT,
+     HASH_ME_TOKEN,
+     "Look up exact block matches in the reference pictures before motion search, for static or "
+     "repeated content, default is 0 [0-1]",
+     set_cfg_generic_token},
+    {SINGLE_INPUT,
+     CROSS_PIC_WAVEFRONT_TOKEN,
+     "Start a picture once the needed SB rows of its references are reconstructed; the value is the number "
+     "of SB rows below the current one that motion vectors may reach, 2 or more recommended, default is 0 [0-16]",
+     set_cfg_generic_token},
+    {SINGLE_INPUT,
+     STATIC_SB_SKIP_TOKEN,
+     "Code SBs whose source is unchanged from the previous reference as a single zero motion block, skipping "
+     "mode decision search for them, default is 0 [0-1]",
+     set_cfg_generic_token},
+    {SINGLE_INPUT,
+     SUB_SB_PARALLEL_MD_TOKEN,
+     "Share the partition search of the four 32x32 quadrants of an SB with idle threads, for low-latency "
+     "encodes with few SBs per picture, default is 0 [0-1]",
+     set_cfg_generic_token},
+    {SINGLE_INPUT,
+     MD_EARLY_TERM_TOKEN,
+     "Prune the partition depth and NSQ shape searches with small learned models, default is 0 [0: off, "
+     "1: conservative, 2: aggressive]",
+     set_cfg_generic_token},
     // Optional Features
     {SINGLE_INPUT,
      RESTRICTED_MOTION_VECTOR,
@@ -1456,6 +1486,11 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, ENABLE_TF_TOKEN, "EnableTf", set_cfg_generic_token},
     {SINGLE_INPUT, ENABLE_OVERLAYS, "EnableOverlays", set_cfg_generic_token},
     {SINGLE_INPUT, SCREEN_CONTENT_TOKEN, "ScreenContentMode", set_cfg_generic_token},
+    {SINGLE_INPUT, HASH_ME_TOKEN, "EnableHashMe", set_cfg_generic_token},
+    {SINGLE_INPUT, CROSS_PIC_WAVEFRONT_TOKEN, "CrossPicWavefront", set_cfg_generic_token},
+    {SINGLE_INPUT, STATIC_SB_SKIP_TOKEN, "EnableStaticSbSkip", set_cfg_generic_token},
+    {SINGLE_INPUT, SUB_SB_PARALLEL_MD_TOKEN, "EnableSubSbParallelMd", set_cfg_generic_token},
+    {SINGLE_INPUT, MD_EARLY_TERM_TOKEN, "MdEarlyTerm", set_cfg_generic_token},
     {SINGLE_INPUT, RESTRICTED_MOTION_VECTOR, "RestrictedMotionVector", set_cfg_generic_token},
     {SINGLE_INPUT, FILM_GRAIN_TOKEN, "FilmGrain", set_cfg_generic_token},
     {SINGLE_INPUT, FILM_GRAIN_DENOISE_APPLY_TOKEN, "FilmGrainDenoise", set_cfg_generic_token},
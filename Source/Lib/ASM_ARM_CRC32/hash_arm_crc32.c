@@ -0,0 +1,120 @@
+/*
+* Copyright (c) 2024, Alliance for Open Media. All rights reserved
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at www.aomedia.org/license/software. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+*/
+
+#include <arm_acle.h>
+#include <arm_neon.h>
+
+#include "aom_dsp_rtcd.h"
+#include "hash.h"
+
+uint32_t svt_av1_get_crc32c_value_arm_crc32(const uint32_t *words, int count) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (int i = 0; i < count; i++) crc = __crc32cw(crc, words[i]);
+    return crc ^ 0xFFFFFFFF;
+}
+
+void svt_av1_generate_block_2x2_hash_row_arm_crc32(const uint8_t *src, int stride, int width, uint32_t *hash1,
+                                                   uint32_t *hash2, int8_t *row_same, int8_t *col_same) {
+    const uint8x16_t one  = vdupq_n_u8(1);
+    const uint32x4_t mult = vdupq_n_u32(CRC32C_HASH2_MULTIPLIER);
+    uint32_t         words[2][16];
+    int              x_pos = 0;
+
+    for (; x_pos + 16 <= width; x_pos += 16) {
+        const uint8x16_t a = vld1q_u8(src + x_pos);
+        const uint8x16_t b = vld1q_u8(src + x_pos + 1);
+        const uint8x16_t c = vld1q_u8(src + stride + x_pos);
+        const uint8x16_t d = vld1q_u8(src + stride + x_pos + 1);
+
+        const uint8x16_t row = vandq_u8(vceqq_u8(a, b), vceqq_u8(c, d));
+        const uint8x16_t col = vandq_u8(vceqq_u8(a, c), vceqq_u8(b, d));
+        vst1q_s8(row_same + x_pos, vreinterpretq_s8_u8(vandq_u8(row, one)));
+        vst1q_s8(col_same + x_pos, vreinterpretq_s8_u8(vandq_u8(col, one)));
+
+        // Gather the 4 pixels of each 2x2 block in one 32-bit word.
+        const uint16x8_t ab_lo = vreinterpretq_u16_u8(vzip1q_u8(a, b));
+        const uint16x8_t ab_hi = vreinterpretq_u16_u8(vzip2q_u8(a, b));
+        const uint16x8_t cd_lo = vreinterpretq_u16_u8(vzip1q_u8(c, d));
+        const uint16x8_t cd_hi = vreinterpretq_u16_u8(vzip2q_u8(c, d));
+        const uint32x4_t w0    = vreinterpretq_u32_u16(vzip1q_u16(ab_lo, cd_lo));
+        const uint32x4_t w1    = vreinterpretq_u32_u16(vzip2q_u16(ab_lo, cd_lo));
+        const uint32x4_t w2    = vreinterpretq_u32_u16(vzip1q_u16(ab_hi, cd_hi));
+        const uint32x4_t w3    = vreinterpretq_u32_u16(vzip2q_u16(ab_hi, cd_hi));
+        vst1q_u32(&words[0][0], w0);
+        vst1q_u32(&words[0][4], w1);
+        vst1q_u32(&words[0][8], w2);
+        vst1q_u32(&words[0][12], w3);
+        vst1q_u32(&words[1][0], vmulq_u32(w0, mult));
+        vst1q_u32(&words[1][4], vmulq_u32(w1, mult));
+        vst1q_u32(&words[1][8], vmulq_u32(w2, mult));
+        vst1q_u32(&words[1][12], vmulq_u32(w3, mult));
+
+        for (int i = 0; i < 16; i++) {
+            hash1[x_pos + i] = __crc32cw(0xFFFFFFFF, words[0][i]) ^ 0xFFFFFFFF;
+            hash2[x_pos + i] = __crc32cw(0xFFFFFFFF, words[1][i]) ^ 0xFFFFFFFF;
+        }
+    }
+
+    if (x_pos < width)
+        svt_av1_generate_block_2x2_hash_row_c(src + x_pos,
+                                              stride,
+                                              width - x_pos,
+                                              hash1 + x_pos,
+                                              hash2 + x_pos,
+                                              row_same + x_pos,
+                                              col_same + x_pos);
+}
+
+void svt_av1_generate_block_hash_row_arm_crc32(const uint32_t *src_hash1, const uint32_t *src_hash2, int src_size,
+                                               int stride, int width, uint32_t *dst_hash1, uint32_t *dst_hash2) {
+    const uint32_t *src1_tl = src_hash1;
+    const uint32_t *src1_tr = src_hash1 + src_size;
+    const uint32_t *src1_bl = src_hash1 + src_size * stride;
+    const uint32_t *src1_br = src1_bl + src_size;
+    const uint32_t *src2_tl = src_hash2;
+    const uint32_t *src2_tr = src_hash2 + src_size;
+    const uint32_t *src2_bl = src_hash2 + src_size * stride;
+    const uint32_t *src2_br = src2_bl + src_size;
+    const uint32x4_t mult   = vdupq_n_u32(CRC32C_HASH2_MULTIPLIER);
+    uint32_t         words[4][4];
+    int              x_pos = 0;
+
+    for (; x_pos + 4 <= width; x_pos += 4) {
+        vst1q_u32(words[0], vmulq_u32(vld1q_u32(src2_tl + x_pos), mult));
+        vst1q_u32(words[1], vmulq_u32(vld1q_u32(src2_tr + x_pos), mult));
+        vst1q_u32(words[2], vmulq_u32(vld1q_u32(src2_bl + x_pos), mult));
+        vst1q_u32(words[3], vmulq_u32(vld1q_u32(src2_br + x_pos), mult));
+
+        for (int i = 0; i < 4; i++) {
+            const int x   = x_pos + i;
+            uint32_t  crc = __crc32cw(0xFFFFFFFF, src1_tl[x]);
+            crc           = __crc32cw(crc, src1_tr[x]);
+            crc           = __crc32cw(crc, src1_bl[x]);
+            crc           = __crc32cw(crc, src1_br[x]);
+            dst_hash1[x]  = crc ^ 0xFFFFFFFF;
+
+            crc          = __crc32cw(0xFFFFFFFF, words[0][i]);
+            crc          = __crc32cw(crc, words[1][i]);
+            crc          = __crc32cw(crc, words[2][i]);
+            crc          = __crc32cw(crc, words[3][i]);
+            dst_hash2[x] = crc ^ 0xFFFFFFFF;
+        }
+    }
+
+    if (x_pos < width)
+        svt_av1_generate_block_hash_row_c(src_hash1 + x_pos,
+                                          src_hash2 + x_pos,
+                                          src_size,
+                                          stride,
+                                          width - x_pos,
+                                          dst_hash1 + x_pos,
+                                          dst_hash2 + x_pos);
+}
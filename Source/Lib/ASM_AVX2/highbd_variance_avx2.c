@@ -138,6 +138,102 @@ VAR_FN(64, 16, 16, 10);
 
 #undef VAR_FN
 
+/*
+* Small blocks pack several rows into one register: 4 rows of 4, 2 rows of 8 or 1 row of 16 pixels.
+* The sum is widened with madd, so the 16-bit accumulation limits of the square kernels do not apply.
+*/
+static INLINE __m256i load_4x4_u16_avx2(const uint16_t *p, int stride) {
+    const __m128i r01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p),
+                                           _mm_loadl_epi64((const __m128i *)(p + stride)));
+    const __m128i r23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p + 2 * stride)),
+                                           _mm_loadl_epi64((const __m128i *)(p + 3 * stride)));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(r01), r23, 1);
+}
+
+static INLINE __m256i load_2x8_u16_avx2(const uint16_t *p, int stride) {
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)), _mm_loadu_si128((const __m128i *)(p + stride)), 1);
+}
+
+static INLINE void highbd_var_acc_avx2(const __m256i a, const __m256i b, __m256i *v_sum, __m256i *v_sse) {
+    const __m256i v_diff = _mm256_sub_epi16(a, b);
+    *v_sum               = _mm256_add_epi32(*v_sum, _mm256_madd_epi16(v_diff, _mm256_set1_epi16(1)));
+    *v_sse               = _mm256_add_epi32(*v_sse, _mm256_madd_epi16(v_diff, v_diff));
+}
+
+static INLINE void highbd_var_reduce_avx2(const __m256i v_sum, const __m256i v_sse, uint32_t *sse, int *sum) {
+    const __m256i v_d_l  = _mm256_unpacklo_epi32(v_sum, v_sse);
+    const __m256i v_d_h  = _mm256_unpackhi_epi32(v_sum, v_sse);
+    const __m256i v_d_lh = _mm256_add_epi32(v_d_l, v_d_h);
+    __m128i v_d = _mm_add_epi32(_mm256_castsi256_si128(v_d_lh), _mm256_extracti128_si256(v_d_lh, 1));
+    v_d         = _mm_add_epi32(v_d, _mm_srli_si128(v_d, 8));
+    *sum        = _mm_extract_epi32(v_d, 0);
+    *sse        = _mm_extract_epi32(v_d, 1);
+}
+
+static void highbd_calc4xh_var_avx2(const uint16_t *src, int src_stride, const uint16_t *ref, int ref_stride, int h,
+                                    uint32_t *sse, int *sum) {
+    __m256i v_sum = _mm256_setzero_si256();
+    __m256i v_sse = _mm256_setzero_si256();
+    for (int i = 0; i < h; i += 4) {
+        highbd_var_acc_avx2(load_4x4_u16_avx2(src, src_stride), load_4x4_u16_avx2(ref, ref_stride), &v_sum, &v_sse);
+        src += 4 * src_stride;
+        ref += 4 * ref_stride;
+    }
+    highbd_var_reduce_avx2(v_sum, v_sse, sse, sum);
+}
+
+static void highbd_calc8xh_var_avx2(const uint16_t *src, int src_stride, const uint16_t *ref, int ref_stride, int h,
+                                    uint32_t *sse, int *sum) {
+    __m256i v_sum = _mm256_setzero_si256();
+    __m256i v_sse = _mm256_setzero_si256();
+    for (int i = 0; i < h; i += 2) {
+        highbd_var_acc_avx2(load_2x8_u16_avx2(src, src_stride), load_2x8_u16_avx2(ref, ref_stride), &v_sum, &v_sse);
+        src += 2 * src_stride;
+        ref += 2 * ref_stride;
+    }
+    highbd_var_reduce_avx2(v_sum, v_sse, sse, sum);
+}
+
+static void highbd_calc16xh_var_avx2(const uint16_t *src, int src_stride, const uint16_t *ref, int ref_stride, int h,
+                                     uint32_t *sse, int *sum) {
+    __m256i v_sum = _mm256_setzero_si256();
+    __m256i v_sse = _mm256_setzero_si256();
+    for (int i = 0; i < h; ++i) {
+        highbd_var_acc_avx2(
+            _mm256_loadu_si256((const __m256i *)src), _mm256_loadu_si256((const __m256i *)ref), &v_sum, &v_sse);
+        src += src_stride;
+        ref += ref_stride;
+    }
+    highbd_var_reduce_avx2(v_sum, v_sse, sse, sum);
+}
+
+#define VAR_FN_SMALL(w, h, shift)                                                                  \
+    uint32_t svt_aom_highbd_10_variance##w##x##h##_avx2(                                           \
+        const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride, uint32_t *sse) { \
+        int     sum;                                                                               \
+        int64_t var;                                                                               \
+        highbd_calc##w##xh_var_avx2(CONVERT_TO_SHORTPTR(src8),                                     \
+                                    src_stride,                                                    \
+                                    CONVERT_TO_SHORTPTR(ref8),                                     \
+                                    ref_stride,                                                    \
+                                    h,                                                             \
+                                    sse,                                                           \
+                                    &sum);                                                         \
+        *sse = ROUND_POWER_OF_TWO(*sse, 4);                                                        \
+        sum  = ROUND_POWER_OF_TWO(sum, 2);                                                         \
+        var  = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);                                  \
+        return (var >= 0) ? (uint32_t)var : 0;                                                     \
+    }
+
+VAR_FN_SMALL(4, 4, 4);
+VAR_FN_SMALL(4, 8, 5);
+VAR_FN_SMALL(4, 16, 6);
+VAR_FN_SMALL(8, 4, 5);
+VAR_FN_SMALL(16, 4, 6);
+
+#undef VAR_FN_SMALL
+
 /*
 * Compute variance for 16bit input, only for blocks 32x32
 * This kernel is only used by svt_aom_variance_highbd_avx2()
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+#include "definitions.h"
+
+/* Project 8 source corners at a time with the affine model "mat" and store the squared
+distance to their matched reference corners. The operations are kept in the same order as
+the C version (no fused multiply-add) so both produce the same inliers.
+*/
+void svt_av1_ransac_inlier_dist_avx2(const float *mat, const float *x1, const float *y1, const float *x2,
+                                     const float *y2, float *dist_pow2, int n) {
+    const __m256 m0 = _mm256_set1_ps(mat[0]);
+    const __m256 m1 = _mm256_set1_ps(mat[1]);
+    const __m256 m2 = _mm256_set1_ps(mat[2]);
+    const __m256 m3 = _mm256_set1_ps(mat[3]);
+    const __m256 m4 = _mm256_set1_ps(mat[4]);
+    const __m256 m5 = _mm256_set1_ps(mat[5]);
+    int          i  = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256 x  = _mm256_loadu_ps(x1 + i);
+        const __m256 y  = _mm256_loadu_ps(y1 + i);
+        const __m256 px = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m3, y)), m0);
+        const __m256 py = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m4, x), _mm256_mul_ps(m5, y)), m1);
+        const __m256 dx = _mm256_sub_ps(px, _mm256_loadu_ps(x2 + i));
+        const __m256 dy = _mm256_sub_ps(py, _mm256_loadu_ps(y2 + i));
+        _mm256_storeu_ps(dist_pow2 + i, _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+    }
+
+    for (; i < n; ++i) {
+        const float dx = mat[2] * x1[i] + mat[3] * y1[i] + mat[0] - x2[i];
+        const float dy = mat[4] * x1[i] + mat[5] * y1[i] + mat[1] - y2[i];
+        dist_pow2[i]   = dx * dx + dy * dy;
+    }
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2017, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "definitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+#define AOM_QM_BITS 5
+
+// The 16-bit kernels work on 32 coefficients at a time. Every transform has a multiple of 16
+// coefficients, so only a 4x4 block leaves the upper half of the last vector unused; hi masks it.
+static INLINE __m512i read_coeff(const TranLow *coeff, const __mmask16 hi) {
+    const __m256i lo16 = _mm512_cvtsepi32_epi16(_mm512_loadu_si512((const __m512i *)coeff));
+    const __m256i hi16 = _mm512_cvtsepi32_epi16(_mm512_maskz_loadu_epi32(hi, coeff + 16));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo16), hi16, 1);
+}
+
+static INLINE void store_coeff(const __m512i x, TranLow *addr, const __mmask16 hi) {
+    _mm512_storeu_si512((__m512i *)addr, _mm512_cvtepi16_epi32(_mm512_castsi512_si256(x)));
+    _mm512_mask_storeu_epi32(addr + 16, hi, _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(x, 1)));
+}
+
+// Lane 0 holds the DC parameter, the other lanes the AC parameter.
+static INLINE __m512i init_one_qp(int16_t dc, int16_t ac) {
+    return _mm512_mask_set1_epi16(_mm512_set1_epi16(ac), 1, dc);
+}
+
+static INLINE void init_qp(const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *dequant_ptr,
+                           int log_scale, __m512i *thr, __m512i *qp) {
+    const int rnd = (1 << log_scale) >> 1;
+    qp[0]         = init_one_qp((round_ptr[0] + rnd) >> log_scale, (round_ptr[1] + rnd) >> log_scale);
+    if (log_scale == 1)
+        qp[1] = init_one_qp((int16_t)(quant_ptr[0] << 1), (int16_t)(quant_ptr[1] << 1));
+    else
+        qp[1] = init_one_qp(quant_ptr[0], quant_ptr[1]);
+    qp[2] = init_one_qp(dequant_ptr[0], dequant_ptr[1]);
+    *thr  = _mm512_srai_epi16(qp[2], 1 + log_scale);
+}
+
+// Once the DC coefficient is done, every lane takes the AC parameter.
+static INLINE void update_qp(__m512i *thr, __m512i *qp) {
+    const __m512i ac_idx = _mm512_set1_epi16(1);
+    qp[0]                = _mm512_permutexvar_epi16(ac_idx, qp[0]);
+    qp[1]                = _mm512_permutexvar_epi16(ac_idx, qp[1]);
+    qp[2]                = _mm512_permutexvar_epi16(ac_idx, qp[2]);
+    *thr                 = _mm512_permutexvar_epi16(ac_idx, *thr);
+}
+
+// Gives the magnitudes in x the sign of c in the lanes set in keep and zeroes the other lanes.
+static INLINE __m512i mm512_apply_sign_epi16(const __m512i x, const __m512i c, const __mmask32 keep) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i r    = _mm512_maskz_mov_epi16(keep, x);
+    return _mm512_mask_sub_epi16(r, _mm512_mask_cmplt_epi16_mask(keep, c, zero), zero, r);
+}
+
+static INLINE uint16_t quant_gather_eob(const __m512i eob) {
+    const __m256i eob_256 = _mm256_max_epi16(_mm512_castsi512_si256(eob), _mm512_extracti64x4_epi64(eob, 1));
+    __m128i       eob_s   = _mm_max_epi16(_mm256_castsi256_si128(eob_256), _mm256_extracti128_si256(eob_256, 1));
+    eob_s                 = _mm_subs_epu16(_mm_set1_epi16(INT16_MAX), eob_s);
+    eob_s                 = _mm_minpos_epu16(eob_s);
+    return INT16_MAX - _mm_extract_epi16(eob_s, 0);
+}
+
+// log_scale selects the 4x4..16x16 (0), 32x32 (1) or 64x64 (2) arithmetic of the C code. The eob
+// is updated from the dequantized values in the same pass.
+static INLINE void quantize(const __m512i *thr, const __m512i *qp, const __m512i c, const int16_t *iscan_ptr,
+                            TranLow *qcoeff, TranLow *dqcoeff, __m512i *eob, const __mmask16 hi, int log_scale) {
+    const __m512i   abs  = _mm512_abs_epi16(c);
+    const __mmask32 keep = _mm512_mask_cmpge_epi16_mask(_mm512_test_epi16_mask(c, c), abs, *thr);
+
+    if (keep) {
+        __m512i q = _mm512_adds_epi16(abs, qp[0]);
+        __m512i dq;
+        if (log_scale == 0) {
+            q  = _mm512_mulhi_epi16(q, qp[1]);
+            dq = _mm512_mullo_epi16(q, qp[2]);
+        } else if (log_scale == 1) {
+            q  = _mm512_mulhi_epu16(q, qp[1]);
+            dq = _mm512_srli_epi16(_mm512_mullo_epi16(q, qp[2]), 1);
+        } else {
+            const __m512i qh  = _mm512_slli_epi16(_mm512_mulhi_epi16(q, qp[1]), 2);
+            const __m512i ql  = _mm512_srli_epi16(_mm512_mullo_epi16(q, qp[1]), 14);
+            q                 = _mm512_or_si512(qh, ql);
+            const __m512i dqh = _mm512_slli_epi16(_mm512_mulhi_epi16(q, qp[2]), 14);
+            const __m512i dql = _mm512_srli_epi16(_mm512_mullo_epi16(q, qp[2]), 2);
+            dq                = _mm512_or_si512(dqh, dql);
+        }
+        q  = mm512_apply_sign_epi16(q, c, keep);
+        dq = mm512_apply_sign_epi16(dq, c, keep);
+
+        store_coeff(q, qcoeff, hi);
+        store_coeff(dq, dqcoeff, hi);
+
+        const __mmask32 valid = ((__mmask32)hi << 16) | 0xFFFF;
+        const __m512i   iscan = _mm512_maskz_loadu_epi16(valid, iscan_ptr);
+        const __mmask32 nz    = _mm512_test_epi16_mask(dq, dq);
+        *eob = _mm512_mask_max_epi16(*eob, nz, *eob, _mm512_add_epi16(iscan, _mm512_set1_epi16(1)));
+    } else {
+        const __m512i zero = _mm512_setzero_si512();
+        store_coeff(zero, qcoeff, hi);
+        store_coeff(zero, dqcoeff, hi);
+    }
+}
+
+static INLINE void quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *round_ptr,
+                                      const int16_t *quant_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *iscan_ptr,
+                                      int log_scale) {
+    const unsigned int step = 32;
+    __m512i            qp[3], thr;
+
+    init_qp(round_ptr, quant_ptr, dequant_ptr, log_scale, &thr, qp);
+    __m512i eob = _mm512_setzero_si512();
+    for (intptr_t i = 0; i < n_coeffs; i += step) {
+        const __mmask16 hi    = n_coeffs - i > 16 ? 0xFFFF : 0;
+        const __m512i   coeff = read_coeff(coeff_ptr + i, hi);
+        quantize(&thr, qp, coeff, iscan_ptr + i, qcoeff_ptr + i, dqcoeff_ptr + i, &eob, hi, log_scale);
+        if (!i)
+            update_qp(&thr, qp);
+    }
+    *eob_ptr = quant_gather_eob(eob);
+}
+
+void svt_av1_quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr, const int16_t *dequant_ptr,
+                                uint16_t *eob_ptr, const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)scan_ptr;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    quantize_fp_avx512(
+        coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr, dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 0);
+}
+
+void svt_av1_quantize_fp_32x32_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                      const int16_t *round_ptr, const int16_t *quant_ptr,
+                                      const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan_ptr,
+                                      const int16_t *iscan_ptr) {
+    (void)scan_ptr;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    quantize_fp_avx512(
+        coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr, dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 1);
+}
+
+void svt_av1_quantize_fp_64x64_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                      const int16_t *round_ptr, const int16_t *quant_ptr,
+                                      const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan_ptr,
+                                      const int16_t *iscan_ptr) {
+    (void)scan_ptr;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    quantize_fp_avx512(
+        coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr, dqcoeff_ptr, dequant_ptr, eob_ptr, iscan_ptr, 2);
+}
+
+// 16 int32_t parallel multiplication with a 64-bit intermediate, right shifted by shift.
+static INLINE __m512i mm512_mul_shift_epi32(const __m512i x, const __m512i y, int shift) {
+    const __m512i prod_lo = _mm512_srli_epi64(_mm512_mul_epi32(x, y), shift);
+    __m512i       prod_hi = _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32));
+    prod_hi               = _mm512_slli_epi64(_mm512_srli_epi64(prod_hi, shift), 32);
+    return _mm512_mask_blend_epi32(0xAAAA, prod_lo, prod_hi);
+}
+
+static INLINE __m512i mm512_apply_sign_epi32(const __m512i x, const __m512i c, const __mmask16 keep) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i r    = _mm512_maskz_mov_epi32(keep, x);
+    return _mm512_mask_sub_epi32(r, _mm512_mask_cmplt_epi32_mask(keep, c, zero), zero, r);
+}
+
+static INLINE __m512i init_one_qp_qm(int32_t dc, int32_t ac) {
+    return _mm512_mask_set1_epi32(_mm512_set1_epi32(ac), 1, dc);
+}
+
+static INLINE void quantize_qm(const __m512i *qp, const __m512i c, const int16_t *iscan_ptr, TranLow *qcoeff,
+                               TranLow *dqcoeff, __m512i *eob, const __m512i qm, const __m512i iqm, int log_scale) {
+    const __m512i   abs  = _mm512_abs_epi32(c);
+    const __m512i   thr  = _mm512_slli_epi32(qp[2], AOM_QM_BITS - (1 + log_scale));
+    const __mmask16 keep = _mm512_mask_cmpge_epi32_mask(
+        _mm512_test_epi32_mask(c, c), _mm512_mullo_epi32(abs, qm), thr);
+
+    if (keep) {
+        // clamped (abs + round) < 2^15 and wt * quant < 2^23, so one 64-bit multiply covers both
+        __m512i q = _mm512_min_epi32(_mm512_add_epi32(abs, qp[0]), _mm512_set1_epi32(INT16_MAX));
+        q         = mm512_mul_shift_epi32(q, _mm512_mullo_epi32(qm, qp[1]), AOM_QM_BITS + 16 - log_scale);
+
+        __m512i dq = _mm512_mullo_epi32(qp[2], iqm);
+        dq         = _mm512_srli_epi32(_mm512_add_epi32(dq, _mm512_set1_epi32(1 << (AOM_QM_BITS - 1))), AOM_QM_BITS);
+        dq         = _mm512_srli_epi32(_mm512_mullo_epi32(q, dq), log_scale);
+
+        q  = mm512_apply_sign_epi32(q, c, keep);
+        dq = mm512_apply_sign_epi32(dq, c, keep);
+        _mm512_storeu_si512((__m512i *)qcoeff, q);
+        _mm512_storeu_si512((__m512i *)dqcoeff, dq);
+
+        const __m512i   iscan = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)iscan_ptr));
+        const __mmask16 nz    = _mm512_test_epi32_mask(dq, dq);
+        *eob = _mm512_mask_max_epi32(*eob, nz, *eob, _mm512_add_epi32(iscan, _mm512_set1_epi32(1)));
+    } else {
+        const __m512i zero = _mm512_setzero_si512();
+        _mm512_storeu_si512((__m512i *)qcoeff, zero);
+        _mm512_storeu_si512((__m512i *)dqcoeff, zero);
+    }
+}
+
+void svt_av1_quantize_fp_qm_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                   const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                   TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr, const int16_t *dequant_ptr,
+                                   uint16_t *eob_ptr, const int16_t *scan_ptr, const int16_t *iscan_ptr,
+                                   const QmVal *qm_ptr, const QmVal *iqm_ptr, int16_t log_scale) {
+    (void)scan_ptr;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    const unsigned int step = 16;
+    const int          rnd  = (1 << log_scale) >> 1;
+    __m512i            qp[3];
+
+    qp[0]       = init_one_qp_qm((round_ptr[0] + rnd) >> log_scale, (round_ptr[1] + rnd) >> log_scale);
+    qp[1]       = init_one_qp_qm(quant_ptr[0], quant_ptr[1]);
+    qp[2]       = init_one_qp_qm(dequant_ptr[0], dequant_ptr[1]);
+    __m512i eob = _mm512_setzero_si512();
+    for (intptr_t i = 0; i < n_coeffs; i += step) {
+        const __m512i coeff = _mm512_loadu_si512((const __m512i *)(coeff_ptr + i));
+        const __m512i qm    = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(qm_ptr + i)));
+        const __m512i iqm   = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(iqm_ptr + i)));
+        quantize_qm(qp, coeff, iscan_ptr + i, qcoeff_ptr + i, dqcoeff_ptr + i, &eob, qm, iqm, log_scale);
+        if (!i) {
+            const __m512i ac_idx = _mm512_set1_epi32(1);
+            qp[0]                = _mm512_permutexvar_epi32(ac_idx, qp[0]);
+            qp[1]                = _mm512_permutexvar_epi32(ac_idx, qp[1]);
+            qp[2]                = _mm512_permutexvar_epi32(ac_idx, qp[2]);
+        }
+    }
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+#endif // EN_AVX512_SUPPORT
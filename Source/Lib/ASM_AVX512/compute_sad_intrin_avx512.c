@@ -4712,4 +4712,193 @@ void svt_sad_loop_kernel_avx512_intrin(uint8_t  *src, // input parameter, source
     *x_search_center = (int16_t)best_x;
     *y_search_center = (int16_t)best_y;
 }
+
+/*******************************************************************************
+* Eight-point ME SADs for one 8-row band of a 64x64 block.
+* Each 128-bit lane covers two neighbouring 8x8 blocks. vdbpsadbw slides a
+* source quadruplet over four reference positions, so two shuffles per lane
+* give all 8 horizontal offsets of a block row at once.
+* sad_even / sad_odd: lane k holds the 8 offsets of 8x8 block 2k / 2k+1.
+*******************************************************************************/
+static INLINE void eight_sad_8x8_band_avx512(const uint8_t *src, const uint32_t src_stride, const uint8_t *ref,
+                                             const uint32_t ref_stride, const int rows, __m512i *const sad_even,
+                                             __m512i *const sad_odd) {
+    const __mmask64 ref_mask = 0x7FFFFFFFFFFFFFFFULL; // the last byte of ref + 8 is never used
+    __m512i         even_0   = _mm512_setzero_si512();
+    __m512i         even_1   = _mm512_setzero_si512();
+    __m512i         odd_0    = _mm512_setzero_si512();
+    __m512i         odd_1    = _mm512_setzero_si512();
+
+    for (int i = 0; i < rows; i++) {
+        const __m512i s      = _mm512_loadu_si512((const __m512i *)src);
+        const __m512i r0     = _mm512_loadu_si512((const __m512i *)ref);
+        const __m512i r8     = _mm512_maskz_loadu_epi8(ref_mask, ref + 8);
+        const __m512i s_even = _mm512_shuffle_epi32(s, (_MM_PERM_ENUM)0x50); // 0 0 1 1
+        const __m512i s_odd  = _mm512_shuffle_epi32(s, (_MM_PERM_ENUM)0xFA); // 2 2 3 3
+        even_0               = _mm512_add_epi16(even_0, _mm512_dbsad_epu8(s_even, r0, 0x94)); // offsets 0..3
+        even_1               = _mm512_add_epi16(even_1, _mm512_dbsad_epu8(s_even, r0, 0xE9)); // offsets 4..7
+        odd_0                = _mm512_add_epi16(odd_0, _mm512_dbsad_epu8(s_odd, r8, 0x94));
+        odd_1                = _mm512_add_epi16(odd_1, _mm512_dbsad_epu8(s_odd, r8, 0xE9));
+        src += src_stride;
+        ref += ref_stride;
+    }
+
+    *sad_even = _mm512_add_epi16(_mm512_unpacklo_epi64(even_0, even_1), _mm512_unpackhi_epi64(even_0, even_1));
+    *sad_odd  = _mm512_add_epi16(_mm512_unpacklo_epi64(odd_0, odd_1), _mm512_unpackhi_epi64(odd_0, odd_1));
+}
+
+static INLINE void update_eight_sad_8x8_16x16(const __m128i sad0, const __m128i sad1, const __m128i sad2,
+                                              const __m128i sad3, const uint32_t start_16x16_pos, const uint32_t mv,
+                                              uint32_t *p_best_sad_8x8, uint32_t *p_best_sad_16x16,
+                                              uint32_t *p_best_mv8x8, uint32_t *p_best_mv16x16,
+                                              uint32_t p_eight_sad16x16[16][8]) {
+    const uint32_t start_8x8_pos = 4 * start_16x16_pos;
+
+    const __m128i minpos0 = _mm_minpos_epu16(sad0);
+    const __m128i minpos1 = _mm_minpos_epu16(sad1);
+    const __m128i minpos2 = _mm_minpos_epu16(sad2);
+    const __m128i minpos3 = _mm_minpos_epu16(sad3);
+
+    const __m128i minpos01   = _mm_unpacklo_epi16(minpos0, minpos1);
+    const __m128i minpos23   = _mm_unpacklo_epi16(minpos2, minpos3);
+    const __m128i minpos0123 = _mm_unpacklo_epi32(minpos01, minpos23);
+    const __m128i sad8x8     = _mm_unpacklo_epi16(minpos0123, _mm_setzero_si128());
+    const __m128i pos8x8     = _mm_unpackhi_epi16(minpos0123, _mm_setzero_si128());
+
+    const __m128i  mvs  = _mm_set1_epi32(mv);
+    const __mmask8 mask = _mm_cmplt_epu32_mask(sad8x8,
+                                               _mm_loadu_si128((__m128i *)(p_best_sad_8x8 + start_8x8_pos)));
+    _mm_mask_storeu_epi32(p_best_sad_8x8 + start_8x8_pos, mask, sad8x8);
+    _mm_mask_storeu_epi32(p_best_mv8x8 + start_8x8_pos, mask, _mm_add_epi16(mvs, pos8x8));
+
+    const __m128i sad16x16_16 = _mm_add_epi16(_mm_add_epi16(sad0, sad1), _mm_add_epi16(sad2, sad3));
+    _mm256_storeu_si256((__m256i *)(p_eight_sad16x16[start_16x16_pos]), _mm256_cvtepu16_epi32(sad16x16_16));
+
+    const __m128i  minpos16x16 = _mm_minpos_epu16(sad16x16_16);
+    const uint32_t min16x16    = _mm_extract_epi16(minpos16x16, 0);
+
+    if (min16x16 < p_best_sad_16x16[start_16x16_pos]) {
+        p_best_sad_16x16[start_16x16_pos] = min16x16;
+        const __m128i mv16x16             = _mm_add_epi16(mvs, _mm_srli_si128(minpos16x16, 2));
+        p_best_mv16x16[start_16x16_pos]   = _mm_extract_epi32(mv16x16, 0);
+    }
+}
+
+void svt_ext_all_sad_calculation_8x8_16x16_avx512(uint8_t *src, uint32_t src_stride, uint8_t *ref,
+                                                  uint32_t ref_stride, uint32_t mv, uint32_t *p_best_sad_8x8,
+                                                  uint32_t *p_best_sad_16x16, uint32_t *p_best_mv8x8,
+                                                  uint32_t *p_best_mv16x16, uint32_t p_eight_sad16x16[16][8],
+                                                  uint32_t p_eight_sad8x8[64][8], Bool sub_sad) {
+    static const char offsets[16] = {0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15};
+    const uint32_t    row_step    = sub_sad ? 2 : 1;
+    const int         rows        = sub_sad ? 4 : 8;
+    DECLARE_ALIGNED(64, uint16_t, sads[4][32]);
+
+    (void)p_eight_sad8x8;
+    for (int y = 0; y < 4; y++) {
+        const uint8_t *s = src + 16 * y * src_stride;
+        const uint8_t *r = ref + 16 * y * ref_stride;
+        __m512i        top_even, top_odd, bot_even, bot_odd;
+
+        eight_sad_8x8_band_avx512(s, row_step * src_stride, r, row_step * ref_stride, rows, &top_even, &top_odd);
+        eight_sad_8x8_band_avx512(
+            s + 8 * src_stride, row_step * src_stride, r + 8 * ref_stride, row_step * ref_stride, rows, &bot_even,
+            &bot_odd);
+        if (sub_sad) {
+            top_even = _mm512_slli_epi16(top_even, 1);
+            top_odd  = _mm512_slli_epi16(top_odd, 1);
+            bot_even = _mm512_slli_epi16(bot_even, 1);
+            bot_odd  = _mm512_slli_epi16(bot_odd, 1);
+        }
+        _mm512_store_si512((__m512i *)sads[0], top_even);
+        _mm512_store_si512((__m512i *)sads[1], top_odd);
+        _mm512_store_si512((__m512i *)sads[2], bot_even);
+        _mm512_store_si512((__m512i *)sads[3], bot_odd);
+
+        //---- 16x16 : 0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15
+        for (int x = 0; x < 4; x++)
+            update_eight_sad_8x8_16x16(_mm_load_si128((__m128i *)(sads[0] + 8 * x)),
+                                       _mm_load_si128((__m128i *)(sads[1] + 8 * x)),
+                                       _mm_load_si128((__m128i *)(sads[2] + 8 * x)),
+                                       _mm_load_si128((__m128i *)(sads[3] + 8 * x)),
+                                       offsets[4 * y + x],
+                                       mv,
+                                       p_best_sad_8x8,
+                                       p_best_sad_16x16,
+                                       p_best_mv8x8,
+                                       p_best_mv16x16,
+                                       p_eight_sad16x16);
+    }
+}
+
+/* Horizontal (value << 3 | index) minimum of each 256-bit half. The result of
+   the low half lands in dword 0 and the one of the high half in dword 8.
+   Ties resolve to the lowest index, as in the C kernel. Values must fit 29 bits. */
+static INLINE __m512i min_pos_8x2_avx512(const __m512i sad) {
+    const __m512i idx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7);
+    __m512i       x   = _mm512_or_si512(_mm512_slli_epi32(sad, 3), idx);
+    x                 = _mm512_min_epu32(x, _mm512_shuffle_i64x2(x, x, 0xB1));
+    x                 = _mm512_min_epu32(x, _mm512_shuffle_epi32(x, (_MM_PERM_ENUM)0x4E));
+    return _mm512_min_epu32(x, _mm512_shuffle_epi32(x, (_MM_PERM_ENUM)0xB1));
+}
+
+void svt_ext_eight_sad_calculation_32x32_64x64_avx512(uint32_t p_sad16x16[16][8], uint32_t *p_best_sad_32x32,
+                                                      uint32_t *p_best_sad_64x64, uint32_t *p_best_mv32x32,
+                                                      uint32_t *p_best_mv64x64, uint32_t mv,
+                                                      uint32_t p_sad32x32[4][8]) {
+    __m512i sad32[2];
+
+    // sad32[i] holds the 8 search points of 32x32 blocks 2 * i and 2 * i + 1
+    for (int i = 0; i < 2; i++) {
+        const __m512i t0 = _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)p_sad16x16[8 * i + 0]),
+                                            _mm512_loadu_si512((const __m512i *)p_sad16x16[8 * i + 2]));
+        const __m512i t1 = _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)p_sad16x16[8 * i + 4]),
+                                            _mm512_loadu_si512((const __m512i *)p_sad16x16[8 * i + 6]));
+        sad32[i]         = _mm512_add_epi32(_mm512_shuffle_i64x2(t0, t1, 0x44), _mm512_shuffle_i64x2(t0, t1, 0xEE));
+        _mm512_storeu_si512((__m512i *)p_sad32x32[2 * i], sad32[i]);
+    }
+
+    const __m512i sad64_x2 = _mm512_add_epi32(sad32[0], sad32[1]);
+    const __m512i sad64    = _mm512_add_epi32(sad64_x2, _mm512_shuffle_i64x2(sad64_x2, sad64_x2, 0x4E));
+
+    const __m512i  gather_idx = _mm512_setr_epi32(0, 8, 16, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i  min32      = _mm512_castsi512_si128(
+        _mm512_permutex2var_epi32(min_pos_8x2_avx512(sad32[0]), gather_idx, min_pos_8x2_avx512(sad32[1])));
+    const __m128i  mvs        = _mm_set1_epi32(mv);
+    const __m128i  best32     = _mm_srli_epi32(min32, 3);
+    const __m128i  mv32       = _mm_add_epi16(mvs, _mm_and_si128(min32, _mm_set1_epi32(7)));
+    const __mmask8 mask       = _mm_cmplt_epu32_mask(best32, _mm_loadu_si128((__m128i *)p_best_sad_32x32));
+    _mm_mask_storeu_epi32(p_best_sad_32x32, mask, best32);
+    _mm_mask_storeu_epi32(p_best_mv32x32, mask, mv32);
+
+    const uint32_t min64 = (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(min_pos_8x2_avx512(sad64)));
+    if ((min64 >> 3) < p_best_sad_64x64[0]) {
+        p_best_sad_64x64[0] = min64 >> 3;
+        p_best_mv64x64[0]   = _mm_cvtsi128_si32(_mm_add_epi16(mvs, _mm_cvtsi32_si128(min64 & 7)));
+    }
+}
+
+void svt_ext_sad_calculation_32x32_64x64_avx512(uint32_t *p_sad16x16, uint32_t *p_best_sad_32x32,
+                                                uint32_t *p_best_sad_64x64, uint32_t *p_best_mv32x32,
+                                                uint32_t *p_best_mv64x64, uint32_t mv, uint32_t *p_sad32x32) {
+    // 16x16 blocks 4 * i .. 4 * i + 3 form 32x32 block i, i.e. one 128-bit lane each
+    __m512i sum = _mm512_loadu_si512((const __m512i *)p_sad16x16);
+    sum         = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, (_MM_PERM_ENUM)0x4E));
+    sum         = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, (_MM_PERM_ENUM)0xB1));
+
+    const __m128i sad32 = _mm512_castsi512_si128(
+        _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), sum));
+    _mm_storeu_si128((__m128i *)p_sad32x32, sad32);
+
+    const __mmask8 mask = _mm_cmplt_epu32_mask(sad32, _mm_loadu_si128((__m128i *)p_best_sad_32x32));
+    _mm_mask_storeu_epi32(p_best_sad_32x32, mask, sad32);
+    _mm_mask_storeu_epi32(p_best_mv32x32, mask, _mm_set1_epi32(mv));
+
+    __m128i sad64 = _mm_add_epi32(sad32, _mm_srli_si128(sad32, 8));
+    sad64         = _mm_add_epi32(sad64, _mm_srli_si128(sad64, 4));
+    if ((uint32_t)_mm_cvtsi128_si32(sad64) < p_best_sad_64x64[0]) {
+        p_best_sad_64x64[0] = _mm_cvtsi128_si32(sad64);
+        p_best_mv64x64[0]   = mv;
+    }
+}
 #endif // EN_AVX512_SUPPORT
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2017, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "definitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+#define AOM_QM_BITS 5
+
+// Lane 0 holds the DC parameter, lanes 1..15 the AC parameter.
+static INLINE __m512i init_one_qp(const int16_t *p, int log_scale) {
+    const int32_t rnd = (1 << log_scale) >> 1;
+    const __m512i ac  = _mm512_set1_epi32((p[1] + rnd) >> log_scale);
+    return _mm512_mask_set1_epi32(ac, 1, (p[0] + rnd) >> log_scale);
+}
+
+static INLINE void init_qp(const int16_t *zbin_ptr, const int16_t *round_ptr, const int16_t *quant_ptr,
+                           const int16_t *dequant_ptr, const int16_t *quant_shift_ptr, __m512i *qp, int log_scale) {
+    qp[0] = init_one_qp(zbin_ptr, log_scale);
+    qp[1] = init_one_qp(round_ptr, log_scale);
+    qp[2] = init_one_qp(quant_ptr, 0);
+    qp[3] = init_one_qp(dequant_ptr, 0);
+    qp[4] = init_one_qp(quant_shift_ptr, 0);
+}
+
+// Once the first 16 coefficients are done, every lane takes the AC parameter.
+static INLINE void update_qp(__m512i *qp, int n) {
+    const __m512i ac_idx = _mm512_set1_epi32(1);
+    for (int i = 0; i < n; ++i) qp[i] = _mm512_permutexvar_epi32(ac_idx, qp[i]);
+}
+
+// 16 int32_t parallel multiplication with a 64-bit intermediate, right shifted by shift.
+static INLINE __m512i mm512_mul_shift_epi32(const __m512i x, const __m512i y, int shift) {
+    const __m512i prod_lo = _mm512_srli_epi64(_mm512_mul_epi32(x, y), shift);
+    __m512i       prod_hi = _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32));
+    prod_hi               = _mm512_slli_epi64(_mm512_srli_epi64(prod_hi, shift), 32);
+    return _mm512_mask_blend_epi32(0xAAAA, prod_lo, prod_hi);
+}
+
+// Gives the magnitudes in x the sign of c in the lanes set in keep and zeroes the other lanes.
+static INLINE __m512i mm512_apply_sign_epi32(const __m512i x, const __m512i c, const __mmask16 keep) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i r    = _mm512_maskz_mov_epi32(keep, x);
+    return _mm512_mask_sub_epi32(r, _mm512_mask_cmplt_epi32_mask(keep, c, zero), zero, r);
+}
+
+// Lanes with a non-zero coefficient whose (weighted) magnitude reaches the threshold.
+static INLINE __mmask16 mm512_keep_mask(const __m512i c, const __m512i abs, const __m512i thr) {
+    return _mm512_mask_cmpge_epi32_mask(_mm512_test_epi32_mask(c, c), abs, thr);
+}
+
+static INLINE __m512i load_bytes_to_m512(const QmVal *p) {
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)p));
+}
+
+// Stores the quantized and dequantized coefficients and folds the scan position of every non-zero
+// dequantized coefficient into the running eob, so no separate eob pass is needed.
+static INLINE void store_and_update_eob(__m512i q, __m512i dq, const __m512i c, const __mmask16 keep,
+                                        const int16_t *iscan_ptr, TranLow *qcoeff, TranLow *dqcoeff,
+                                        __m512i *eob) {
+    q  = mm512_apply_sign_epi32(q, c, keep);
+    dq = mm512_apply_sign_epi32(dq, c, keep);
+
+    _mm512_storeu_si512((__m512i *)qcoeff, q);
+    _mm512_storeu_si512((__m512i *)dqcoeff, dq);
+
+    const __m512i   iscan = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)iscan_ptr));
+    const __mmask16 nz    = _mm512_test_epi32_mask(dq, dq);
+    *eob = _mm512_mask_max_epi32(*eob, nz, *eob, _mm512_add_epi32(iscan, _mm512_set1_epi32(1)));
+}
+
+static INLINE void write_zero(TranLow *qcoeff, TranLow *dqcoeff) {
+    const __m512i zero = _mm512_setzero_si512();
+    _mm512_storeu_si512((__m512i *)qcoeff, zero);
+    _mm512_storeu_si512((__m512i *)dqcoeff, zero);
+}
+
+// quantize_b: clamp16 clamps (abs + round) to the int16_t range as the low bit-depth C code does.
+static INLINE void quantize_b(const __m512i *qp, const __m512i c, const int16_t *iscan_ptr, TranLow *qcoeff,
+                              TranLow *dqcoeff, __m512i *eob, int log_scale, int clamp16) {
+    const __m512i   abs  = _mm512_abs_epi32(c);
+    const __mmask16 keep = mm512_keep_mask(c, abs, qp[0]);
+
+    if (keep) {
+        __m512i q = _mm512_add_epi32(abs, qp[1]);
+        if (clamp16)
+            q = _mm512_min_epi32(q, _mm512_set1_epi32(INT16_MAX));
+        q          = _mm512_add_epi32(mm512_mul_shift_epi32(q, qp[2], 16), q);
+        q          = mm512_mul_shift_epi32(q, qp[4], 16 - log_scale);
+        __m512i dq = _mm512_srli_epi32(_mm512_mullo_epi32(q, qp[3]), log_scale);
+        store_and_update_eob(q, dq, c, keep, iscan_ptr, qcoeff, dqcoeff, eob);
+    } else
+        write_zero(qcoeff, dqcoeff);
+}
+
+static INLINE void quantize_b_qm(const __m512i *qp, const __m512i c, const int16_t *iscan_ptr, TranLow *qcoeff,
+                                 TranLow *dqcoeff, __m512i *eob, const __m512i qm, const __m512i iqm, int log_scale,
+                                 int clamp16) {
+    const __m512i   abs  = _mm512_abs_epi32(c);
+    const __mmask16 keep = mm512_keep_mask(c, _mm512_mullo_epi32(abs, qm), qp[0]);
+
+    if (keep) {
+        __m512i q = _mm512_add_epi32(abs, qp[1]);
+        if (clamp16)
+            q = _mm512_min_epi32(q, _mm512_set1_epi32(INT16_MAX));
+        q          = _mm512_mullo_epi32(q, qm);
+        q          = _mm512_add_epi32(mm512_mul_shift_epi32(q, qp[2], 16), q);
+        q          = mm512_mul_shift_epi32(q, qp[4], 16 - log_scale + AOM_QM_BITS);
+        __m512i dq = _mm512_mullo_epi32(qp[3], iqm);
+        dq         = _mm512_srli_epi32(_mm512_add_epi32(dq, _mm512_set1_epi32(1 << (AOM_QM_BITS - 1))), AOM_QM_BITS);
+        dq         = _mm512_srli_epi32(_mm512_mullo_epi32(dq, q), log_scale);
+        store_and_update_eob(q, dq, c, keep, iscan_ptr, qcoeff, dqcoeff, eob);
+    } else
+        write_zero(qcoeff, dqcoeff);
+}
+
+static INLINE void quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                     const int16_t *round_ptr, const int16_t *quant_ptr,
+                                     const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                     const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *iscan,
+                                     const QmVal *qm_ptr, const QmVal *iqm_ptr, int log_scale, int clamp16) {
+    const uint32_t step = 16;
+    __m512i        qp[5], coeff, qm = _mm512_setzero_si512(), iqm = _mm512_setzero_si512();
+
+    init_qp(zbin_ptr, round_ptr, quant_ptr, dequant_ptr, quant_shift_ptr, qp, log_scale);
+    if (qm_ptr)
+        qp[0] = _mm512_slli_epi32(qp[0], AOM_QM_BITS);
+
+    __m512i eob = _mm512_setzero_si512();
+    for (intptr_t i = 0; i < n_coeffs; i += step) {
+        coeff = _mm512_loadu_si512((const __m512i *)(coeff_ptr + i));
+        if (qm_ptr) {
+            qm  = load_bytes_to_m512(qm_ptr + i);
+            iqm = load_bytes_to_m512(iqm_ptr + i);
+            quantize_b_qm(qp, coeff, iscan + i, qcoeff_ptr + i, dqcoeff_ptr + i, &eob, qm, iqm, log_scale, clamp16);
+        } else
+            quantize_b(qp, coeff, iscan + i, qcoeff_ptr + i, dqcoeff_ptr + i, &eob, log_scale, clamp16);
+        if (!i)
+            update_qp(qp, 5);
+    }
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+void svt_aom_quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                               const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                               TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr, const int16_t *dequant_ptr,
+                               uint16_t *eob_ptr, const int16_t *scan, const int16_t *iscan, const QmVal *qm_ptr,
+                               const QmVal *iqm_ptr, const int32_t log_scale) {
+    (void)qm_ptr;
+    (void)iqm_ptr;
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      NULL,
+                      NULL,
+                      log_scale,
+                      1);
+}
+
+void svt_av1_quantize_b_qm_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                  const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                  TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr, const int16_t *dequant_ptr,
+                                  uint16_t *eob_ptr, const int16_t *scan, const int16_t *iscan, const QmVal *qm_ptr,
+                                  const QmVal *iqm_ptr, const int32_t log_scale) {
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      qm_ptr,
+                      iqm_ptr,
+                      log_scale,
+                      1);
+}
+
+void svt_aom_highbd_quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                      const int16_t *round_ptr, const int16_t *quant_ptr,
+                                      const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan,
+                                      const int16_t *iscan, const QmVal *qm_ptr, const QmVal *iqm_ptr,
+                                      const int32_t log_scale) {
+    (void)qm_ptr;
+    (void)iqm_ptr;
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      NULL,
+                      NULL,
+                      log_scale,
+                      0);
+}
+
+void svt_av1_highbd_quantize_b_qm_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                         const int16_t *round_ptr, const int16_t *quant_ptr,
+                                         const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                         const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan,
+                                         const int16_t *iscan, const QmVal *qm_ptr, const QmVal *iqm_ptr,
+                                         const int32_t log_scale) {
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      qm_ptr,
+                      iqm_ptr,
+                      log_scale,
+                      0);
+}
+
+static INLINE void quantize_highbd_fp(const __m512i *qp, const __m512i c, const int16_t *iscan_ptr, int log_scale,
+                                      TranLow *qcoeff, TranLow *dqcoeff, __m512i *eob) {
+    const __m512i   abs  = _mm512_abs_epi32(c);
+    const __mmask16 keep = mm512_keep_mask(c, _mm512_slli_epi32(abs, 1 + log_scale), qp[2]);
+
+    if (keep) {
+        const __m512i q  = mm512_mul_shift_epi32(_mm512_add_epi32(abs, qp[0]), qp[1], 16 - log_scale);
+        const __m512i dq = _mm512_srai_epi32(_mm512_mullo_epi32(q, qp[2]), log_scale);
+        store_and_update_eob(q, dq, c, keep, iscan_ptr, qcoeff, dqcoeff, eob);
+    } else
+        write_zero(qcoeff, dqcoeff);
+}
+
+static INLINE void quantize_highbd_fp_qm(const __m512i *qp, const __m512i c, const int16_t *iscan_ptr, int log_scale,
+                                         TranLow *qcoeff, TranLow *dqcoeff, __m512i *eob, const __m512i qm,
+                                         const __m512i iqm) {
+    const __m512i   abs  = _mm512_abs_epi32(c);
+    const __m512i   thr  = _mm512_slli_epi32(qp[2], AOM_QM_BITS - (1 + log_scale));
+    const __mmask16 keep = mm512_keep_mask(c, _mm512_mullo_epi32(abs, qm), thr);
+
+    if (keep) {
+        // (abs + round) * wt stays within 32 bits, so the weight is applied before the 64-bit multiply
+        __m512i q = _mm512_mullo_epi32(_mm512_add_epi32(abs, qp[0]), qm);
+        q         = mm512_mul_shift_epi32(q, qp[1], 16 - log_scale + AOM_QM_BITS);
+
+        __m512i dq = _mm512_mullo_epi32(qp[2], iqm);
+        dq         = _mm512_srli_epi32(_mm512_add_epi32(dq, _mm512_set1_epi32(1 << (AOM_QM_BITS - 1))), AOM_QM_BITS);
+        dq         = _mm512_srai_epi32(_mm512_mullo_epi32(q, dq), log_scale);
+        store_and_update_eob(q, dq, c, keep, iscan_ptr, qcoeff, dqcoeff, eob);
+    } else
+        write_zero(qcoeff, dqcoeff);
+}
+
+static INLINE void init_qp_fp(const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *dequant_ptr,
+                              int log_scale, __m512i *qp) {
+    qp[0] = init_one_qp(round_ptr, log_scale);
+    qp[1] = init_one_qp(quant_ptr, 0);
+    qp[2] = init_one_qp(dequant_ptr, 0);
+}
+
+void svt_av1_highbd_quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                       const int16_t *round_ptr, const int16_t *quant_ptr,
+                                       const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                       const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan,
+                                       const int16_t *iscan, int16_t log_scale) {
+    (void)scan;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    const unsigned int step = 16;
+    __m512i            qp[3];
+
+    init_qp_fp(round_ptr, quant_ptr, dequant_ptr, log_scale, qp);
+    __m512i eob = _mm512_setzero_si512();
+    for (intptr_t i = 0; i < n_coeffs; i += step) {
+        const __m512i coeff = _mm512_loadu_si512((const __m512i *)(coeff_ptr + i));
+        quantize_highbd_fp(qp, coeff, iscan + i, log_scale, qcoeff_ptr + i, dqcoeff_ptr + i, &eob);
+        if (!i)
+            update_qp(qp, 3);
+    }
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+void svt_av1_highbd_quantize_fp_qm_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                                          const int16_t *round_ptr, const int16_t *quant_ptr,
+                                          const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                          const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan,
+                                          const int16_t *iscan, const QmVal *qm_ptr, const QmVal *iqm_ptr,
+                                          int16_t log_scale) {
+    (void)scan;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    const unsigned int step = 16;
+    __m512i            qp[3];
+
+    init_qp_fp(round_ptr, quant_ptr, dequant_ptr, log_scale, qp);
+    __m512i eob = _mm512_setzero_si512();
+    for (intptr_t i = 0; i < n_coeffs; i += step) {
+        const __m512i coeff = _mm512_loadu_si512((const __m512i *)(coeff_ptr + i));
+        const __m512i qm    = load_bytes_to_m512(qm_ptr + i);
+        const __m512i iqm   = load_bytes_to_m512(iqm_ptr + i);
+        quantize_highbd_fp_qm(qp, coeff, iscan + i, log_scale, qcoeff_ptr + i, dqcoeff_ptr + i, &eob, qm, iqm);
+        if (!i)
+            update_qp(qp, 3);
+    }
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+#endif // EN_AVX512_SUPPORT
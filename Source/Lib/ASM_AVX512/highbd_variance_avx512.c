@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2018, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "definitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+#include "aom_dsp_rtcd.h"
+
+/*
+* The narrow 10-bit blocks fit one zmm per 32 pixels, so a whole 4x8 or 8x4 block is a single
+* subtract and two madds. 4x4 only fills a ymm and stays on the AVX2 kernel.
+*/
+static INLINE __m128i load_2rows_w4(const uint16_t *p, int stride) {
+    return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p), _mm_loadl_epi64((const __m128i *)(p + stride)));
+}
+
+static INLINE __m512i load_8rows_w4(const uint16_t *p, int stride) {
+    const __m256i lo = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(load_2rows_w4(p, stride)), load_2rows_w4(p + 2 * stride, stride), 1);
+    const __m256i hi = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(load_2rows_w4(p + 4 * stride, stride)), load_2rows_w4(p + 6 * stride, stride), 1);
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+static INLINE __m512i load_4rows_w8(const uint16_t *p, int stride) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *)p));
+    v         = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + stride)), 1);
+    v         = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + 2 * stride)), 2);
+    return _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + 3 * stride)), 3);
+}
+
+static INLINE __m512i load_2rows_w16(const uint16_t *p, int stride) {
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)p)),
+                              _mm256_loadu_si256((const __m256i *)(p + stride)),
+                              1);
+}
+
+static INLINE void highbd_var_acc_avx512(const __m512i a, const __m512i b, __m512i *v_sum, __m512i *v_sse) {
+    const __m512i v_diff = _mm512_sub_epi16(a, b);
+    *v_sum               = _mm512_add_epi32(*v_sum, _mm512_madd_epi16(v_diff, _mm512_set1_epi16(1)));
+    *v_sse               = _mm512_add_epi32(*v_sse, _mm512_madd_epi16(v_diff, v_diff));
+}
+
+static INLINE uint32_t highbd_10_var_avx512(const __m512i v_sum, const __m512i v_sse, int shift, uint32_t *sse) {
+    const int sum = ROUND_POWER_OF_TWO(_mm512_reduce_add_epi32(v_sum), 2);
+    *sse          = ROUND_POWER_OF_TWO((uint32_t)_mm512_reduce_add_epi32(v_sse), 4);
+    const int64_t var = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);
+    return (var >= 0) ? (uint32_t)var : 0;
+}
+
+uint32_t svt_aom_highbd_10_variance4x8_avx512(const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride,
+                                              uint32_t *sse) {
+    const uint16_t *src   = CONVERT_TO_SHORTPTR(src8);
+    const uint16_t *ref   = CONVERT_TO_SHORTPTR(ref8);
+    __m512i         v_sum = _mm512_setzero_si512();
+    __m512i         v_sse = _mm512_setzero_si512();
+    highbd_var_acc_avx512(load_8rows_w4(src, src_stride), load_8rows_w4(ref, ref_stride), &v_sum, &v_sse);
+    return highbd_10_var_avx512(v_sum, v_sse, 5, sse);
+}
+
+uint32_t svt_aom_highbd_10_variance4x16_avx512(const uint8_t *src8, int src_stride, const uint8_t *ref8,
+                                               int ref_stride, uint32_t *sse) {
+    const uint16_t *src   = CONVERT_TO_SHORTPTR(src8);
+    const uint16_t *ref   = CONVERT_TO_SHORTPTR(ref8);
+    __m512i         v_sum = _mm512_setzero_si512();
+    __m512i         v_sse = _mm512_setzero_si512();
+    highbd_var_acc_avx512(load_8rows_w4(src, src_stride), load_8rows_w4(ref, ref_stride), &v_sum, &v_sse);
+    highbd_var_acc_avx512(load_8rows_w4(src + 8 * src_stride, src_stride),
+                          load_8rows_w4(ref + 8 * ref_stride, ref_stride),
+                          &v_sum,
+                          &v_sse);
+    return highbd_10_var_avx512(v_sum, v_sse, 6, sse);
+}
+
+uint32_t svt_aom_highbd_10_variance8x4_avx512(const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride,
+                                              uint32_t *sse) {
+    const uint16_t *src   = CONVERT_TO_SHORTPTR(src8);
+    const uint16_t *ref   = CONVERT_TO_SHORTPTR(ref8);
+    __m512i         v_sum = _mm512_setzero_si512();
+    __m512i         v_sse = _mm512_setzero_si512();
+    highbd_var_acc_avx512(load_4rows_w8(src, src_stride), load_4rows_w8(ref, ref_stride), &v_sum, &v_sse);
+    return highbd_10_var_avx512(v_sum, v_sse, 5, sse);
+}
+
+uint32_t svt_aom_highbd_10_variance16x4_avx512(const uint8_t *src8, int src_stride, const uint8_t *ref8,
+                                               int ref_stride, uint32_t *sse) {
+    const uint16_t *src   = CONVERT_TO_SHORTPTR(src8);
+    const uint16_t *ref   = CONVERT_TO_SHORTPTR(ref8);
+    __m512i         v_sum = _mm512_setzero_si512();
+    __m512i         v_sse = _mm512_setzero_si512();
+    highbd_var_acc_avx512(load_2rows_w16(src, src_stride), load_2rows_w16(ref, ref_stride), &v_sum, &v_sse);
+    highbd_var_acc_avx512(load_2rows_w16(src + 2 * src_stride, src_stride),
+                          load_2rows_w16(ref + 2 * ref_stride, ref_stride),
+                          &v_sum,
+                          &v_sse);
+    return highbd_10_var_avx512(v_sum, v_sse, 6, sse);
+}
+
+#endif // EN_AVX512_SUPPORT
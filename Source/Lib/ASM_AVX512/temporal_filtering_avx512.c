@@ -0,0 +1,785 @@
+/*
+ * Copyright (c) 2019, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "definitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "temporal_filtering_constants.h"
+#include "utility.h"
+
+/*value [i:0-15] (sqrt((float)i)*65536.0*/
+static const uint32_t sqrt_array_fp16[16] = {0,
+                                             65536,
+                                             92681,
+                                             113511,
+                                             131072,
+                                             146542,
+                                             160529,
+                                             173391,
+                                             185363,
+                                             196608,
+                                             207243,
+                                             217358,
+                                             227023,
+                                             236293,
+                                             245213,
+                                             253819};
+
+/*Calc sqrt linear max error 10%*/
+static uint32_t sqrt_fast(uint32_t x) {
+    if (x > 15) {
+        const int log2_half = svt_log2f(x) >> 1;
+        const int mul2      = log2_half << 1;
+        int       base      = x >> (mul2 - 2);
+        assert(base < 16);
+        return sqrt_array_fp16[base] >> (17 - log2_half);
+    }
+    return sqrt_array_fp16[x] >> 16;
+}
+
+// T[X] =  exp(-(X)/16)  for x in [0..7], step 1/16 values in Fixed Points shift 16
+static const int32_t expf_tab_fp16[] = {
+    65536, 61565, 57835, 54331, 51039, 47947, 45042, 42313, 39749, 37341, 35078, 32953, 30957, 29081, 27319,
+    25664, 24109, 22648, 21276, 19987, 18776, 17638, 16570, 15566, 14623, 13737, 12904, 12122, 11388, 10698,
+    10050, 9441,  8869,  8331,  7827,  7352,  6907,  6488,  6095,  5726,  5379,  5053,  4747,  4459,  4189,
+    3935,  3697,  3473,  3262,  3065,  2879,  2704,  2541,  2387,  2242,  2106,  1979,  1859,  1746,  1640,
+    1541,  1447,  1360,  1277,  1200,  1127,  1059,  995,   934,   878,   824,   774,   728,   683,   642,
+    603,   566,   532,   500,   470,   441,   414,   389,   366,   343,   323,   303,   285,   267,   251,
+    236,   222,   208,   195,   184,   172,   162,   152,   143,   134,   126,   118,   111,   104,   98,
+    92,    86,    81,    76,    72,    67,    63,    59,    56,    52,    49,    46,    43,    41,    38,
+    36,    34,    31,    30,    28,    26,    24,    23,    21};
+
+static INLINE int32_t hadd_epi32_128(__m128i sum) {
+    sum = _mm_hadd_epi32(sum, sum);
+    sum = _mm_hadd_epi32(sum, sum);
+    return _mm_cvtsi128_si32(sum);
+}
+
+/* Horizontal sums of the four quarter accumulators:
+ * out[0] = top-left, out[1] = top-right, out[2] = bottom-left, out[3] = bottom-right */
+static INLINE void store_quad_errors(const __m256i top_l, const __m256i top_r, const __m256i bot_l,
+                                     const __m256i bot_r, int32_t out[4]) {
+    out[0] = hadd_epi32_128(_mm_add_epi32(_mm256_castsi256_si128(top_l), _mm256_extracti128_si256(top_l, 0x1)));
+    out[1] = hadd_epi32_128(_mm_add_epi32(_mm256_castsi256_si128(top_r), _mm256_extracti128_si256(top_r, 0x1)));
+    out[2] = hadd_epi32_128(_mm_add_epi32(_mm256_castsi256_si128(bot_l), _mm256_extracti128_si256(bot_l, 0x1)));
+    out[3] = hadd_epi32_128(_mm_add_epi32(_mm256_castsi256_si128(bot_r), _mm256_extracti128_si256(bot_r, 0x1)));
+}
+
+/* Squared error sums of the four quarters of a 32x32 (or 16x16) block, computed in a single pass.
+ * A 32-wide row fills one zmm register: its low half covers the left quarter and its high half
+ * the right one. For 16-wide blocks two rows are packed into one register instead. */
+static void calculate_squared_errors_quad_no_div_avx512(const uint8_t *s, int s_stride, const uint8_t *p, int p_stride,
+                                                        unsigned int block_width, int32_t out[4]) {
+    __m512i sum[2] = {_mm512_setzero_si512(), _mm512_setzero_si512()};
+
+    if (block_width == 32) {
+        for (unsigned int i = 0; i < 32; i++) {
+            const __m512i s_16 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)(s + i * s_stride)));
+            const __m512i p_16 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)(p + i * p_stride)));
+            const __m512i dif  = _mm512_sub_epi16(s_16, p_16);
+            sum[i >> 4]        = _mm512_add_epi32(sum[i >> 4], _mm512_madd_epi16(dif, dif));
+        }
+        store_quad_errors(_mm512_castsi512_si256(sum[0]),
+                          _mm512_extracti64x4_epi64(sum[0], 1),
+                          _mm512_castsi512_si256(sum[1]),
+                          _mm512_extracti64x4_epi64(sum[1], 1),
+                          out);
+    } else { //block_width == 16
+        for (unsigned int i = 0; i < 16; i += 2) {
+            const __m256i s_8  = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(s + i * s_stride))),
+                _mm_loadu_si128((const __m128i *)(s + (i + 1) * s_stride)),
+                0x1);
+            const __m256i p_8 = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(p + i * p_stride))),
+                _mm_loadu_si128((const __m128i *)(p + (i + 1) * p_stride)),
+                0x1);
+            const __m512i dif = _mm512_sub_epi16(_mm512_cvtepu8_epi16(s_8), _mm512_cvtepu8_epi16(p_8));
+            sum[i >> 3]       = _mm512_add_epi32(sum[i >> 3], _mm512_madd_epi16(dif, dif));
+        }
+        // Fold the two rows together, then left 8 pixels live in the low 128 bits of each 256-bit half
+        const __m256i top = _mm256_add_epi32(_mm512_castsi512_si256(sum[0]), _mm512_extracti64x4_epi64(sum[0], 1));
+        const __m256i bot = _mm256_add_epi32(_mm512_castsi512_si256(sum[1]), _mm512_extracti64x4_epi64(sum[1], 1));
+        out[0]            = hadd_epi32_128(_mm256_castsi256_si128(top));
+        out[1]            = hadd_epi32_128(_mm256_extracti128_si256(top, 0x1));
+        out[2]            = hadd_epi32_128(_mm256_castsi256_si128(bot));
+        out[3]            = hadd_epi32_128(_mm256_extracti128_si256(bot, 0x1));
+    }
+}
+
+static void calculate_squared_errors_quad_no_div_highbd_avx512(const uint16_t *s, int s_stride, const uint16_t *p,
+                                                               int p_stride, unsigned int block_width,
+                                                               int32_t out[4]) {
+    __m512i sum[2] = {_mm512_setzero_si512(), _mm512_setzero_si512()};
+
+    if (block_width == 32) {
+        for (unsigned int i = 0; i < 32; i++) {
+            const __m512i s_16 = _mm512_loadu_si512((const __m512i *)(s + i * s_stride));
+            const __m512i p_16 = _mm512_loadu_si512((const __m512i *)(p + i * p_stride));
+            const __m512i dif  = _mm512_sub_epi16(s_16, p_16);
+            sum[i >> 4]        = _mm512_add_epi32(sum[i >> 4], _mm512_madd_epi16(dif, dif));
+        }
+        store_quad_errors(_mm512_castsi512_si256(sum[0]),
+                          _mm512_extracti64x4_epi64(sum[0], 1),
+                          _mm512_castsi512_si256(sum[1]),
+                          _mm512_extracti64x4_epi64(sum[1], 1),
+                          out);
+    } else { //block_width == 16
+        for (unsigned int i = 0; i < 16; i += 2) {
+            const __m512i s_16 = _mm512_inserti64x4(
+                _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)(s + i * s_stride))),
+                _mm256_loadu_si256((const __m256i *)(s + (i + 1) * s_stride)),
+                1);
+            const __m512i p_16 = _mm512_inserti64x4(
+                _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)(p + i * p_stride))),
+                _mm256_loadu_si256((const __m256i *)(p + (i + 1) * p_stride)),
+                1);
+            const __m512i dif = _mm512_sub_epi16(s_16, p_16);
+            sum[i >> 3]       = _mm512_add_epi32(sum[i >> 3], _mm512_madd_epi16(dif, dif));
+        }
+        const __m256i top = _mm256_add_epi32(_mm512_castsi512_si256(sum[0]), _mm512_extracti64x4_epi64(sum[0], 1));
+        const __m256i bot = _mm256_add_epi32(_mm512_castsi512_si256(sum[1]), _mm512_extracti64x4_epi64(sum[1], 1));
+        out[0]            = hadd_epi32_128(_mm256_castsi256_si128(top));
+        out[1]            = hadd_epi32_128(_mm256_extracti128_si256(top, 0x1));
+        out[2]            = hadd_epi32_128(_mm256_castsi256_si128(bot));
+        out[3]            = hadd_epi32_128(_mm256_extracti128_si256(bot, 0x1));
+    }
+}
+
+/* Weights for one 16-pixel chunk of a row: a 32-wide block takes a single quarter weight per chunk,
+ * a 16-wide block spans both quarters of its half. */
+static INLINE void get_chunk_weights(const uint32_t adjusted_weight[4], unsigned int block_width, unsigned int j,
+                                     int subblock_idx_h, __m256i *weight_16, __m512i *weight_32) {
+    if (block_width == 16) {
+        const uint32_t w_l = adjusted_weight[subblock_idx_h];
+        const uint32_t w_r = adjusted_weight[subblock_idx_h + 1];
+        *weight_16         = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_set1_epi16((int16_t)w_l)), _mm_set1_epi16((int16_t)w_r), 0x1);
+        *weight_32 = _mm512_inserti64x4(
+            _mm512_castsi256_si512(_mm256_set1_epi32((int32_t)w_l)), _mm256_set1_epi32((int32_t)w_r), 1);
+    } else {
+        const uint32_t w = adjusted_weight[subblock_idx_h + (j >= block_width / 2)];
+        *weight_16       = _mm256_set1_epi16((int16_t)w);
+        *weight_32       = _mm512_set1_epi32((int32_t)w);
+    }
+}
+
+static void apply_weights_lbd_avx512(const uint8_t *y_pre, int y_pre_stride, unsigned int block_width,
+                                     unsigned int block_height, uint32_t *y_accum, uint16_t *y_count,
+                                     const uint32_t adjusted_weight[4]) {
+    assert(block_width % 16 == 0 && block_width <= 32);
+    __m256i weight_16[2][2];
+    __m512i weight_32[2][2];
+    for (int h = 0; h < 2; h++)
+        for (unsigned int j = 0; j < block_width; j += 16)
+            get_chunk_weights(adjusted_weight, block_width, j, h * 2, &weight_16[h][j >> 4], &weight_32[h][j >> 4]);
+
+    for (unsigned int i = 0; i < block_height; i++) {
+        const int h = i >= block_height / 2;
+        for (unsigned int j = 0; j < block_width; j += 16) {
+            const unsigned int k = i * y_pre_stride + j;
+
+            //y_count[k] += adjusted_weight;
+            __m256i count_array = _mm256_loadu_si256((__m256i *)(y_count + k));
+            count_array         = _mm256_add_epi16(count_array, weight_16[h][j >> 4]);
+            _mm256_storeu_si256((__m256i *)(y_count + k), count_array);
+
+            //y_accum[k] += adjusted_weight * pixel_value;
+            __m512i accumulator_array = _mm512_loadu_si512((__m512i *)(y_accum + k));
+            __m512i frame2_array_u32  = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i *)(y_pre + k)));
+            frame2_array_u32          = _mm512_mullo_epi32(frame2_array_u32, weight_32[h][j >> 4]);
+            accumulator_array         = _mm512_add_epi32(accumulator_array, frame2_array_u32);
+            _mm512_storeu_si512((__m512i *)(y_accum + k), accumulator_array);
+        }
+    }
+}
+
+static void apply_weights_hbd_avx512(const uint16_t *y_pre, int y_pre_stride, unsigned int block_width,
+                                     unsigned int block_height, uint32_t *y_accum, uint16_t *y_count,
+                                     const uint32_t adjusted_weight[4]) {
+    assert(block_width % 16 == 0 && block_width <= 32);
+    __m256i weight_16[2][2];
+    __m512i weight_32[2][2];
+    for (int h = 0; h < 2; h++)
+        for (unsigned int j = 0; j < block_width; j += 16)
+            get_chunk_weights(adjusted_weight, block_width, j, h * 2, &weight_16[h][j >> 4], &weight_32[h][j >> 4]);
+
+    for (unsigned int i = 0; i < block_height; i++) {
+        const int h = i >= block_height / 2;
+        for (unsigned int j = 0; j < block_width; j += 16) {
+            const unsigned int k = i * y_pre_stride + j;
+
+            //y_count[k] += adjusted_weight;
+            __m256i count_array = _mm256_loadu_si256((__m256i *)(y_count + k));
+            count_array         = _mm256_add_epi16(count_array, weight_16[h][j >> 4]);
+            _mm256_storeu_si256((__m256i *)(y_count + k), count_array);
+
+            //y_accum[k] += adjusted_weight * pixel_value;
+            __m512i accumulator_array = _mm512_loadu_si512((__m512i *)(y_accum + k));
+            __m512i frame2_array_u32  = _mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i *)(y_pre + k)));
+            frame2_array_u32          = _mm512_mullo_epi32(frame2_array_u32, weight_32[h][j >> 4]);
+            accumulator_array         = _mm512_add_epi32(accumulator_array, frame2_array_u32);
+            _mm512_storeu_si512((__m512i *)(y_accum + k), accumulator_array);
+        }
+    }
+}
+
+static void svt_av1_apply_zz_based_temporal_filter_planewise_medium_partial_avx512(
+    struct MeContext *me_ctx, const uint8_t *y_pre, int y_pre_stride, unsigned int block_width,
+    unsigned int block_height, uint32_t *y_accum, uint16_t *y_count, const uint32_t tf_decay_factor) {
+    unsigned int i, subblock_idx;
+
+    int32_t  idx_32x32 = me_ctx->tf_block_col + me_ctx->tf_block_row * 2;
+    uint32_t block_error_fp8[4];
+
+    if (me_ctx->tf_32x32_block_split_flag[idx_32x32]) {
+        for (i = 0; i < 4; ++i) { block_error_fp8[i] = (uint32_t)(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i]); }
+    } else {
+        block_error_fp8[0] = block_error_fp8[1] = block_error_fp8[2] = block_error_fp8[3] =
+            (uint32_t)(me_ctx->tf_32x32_block_error[idx_32x32] >> 2);
+    }
+
+    uint32_t adjusted_weight[4];
+
+    for (subblock_idx = 0; subblock_idx < 4; subblock_idx++) {
+        uint32_t avg_err_fp10 = (block_error_fp8[subblock_idx]) << 2;
+        FP_ASSERT((((int64_t)block_error_fp8[subblock_idx]) << 2) < ((int64_t)1 << 31));
+
+        uint32_t scaled_diff16 = AOMMIN(
+            /*((16*avg_err)<<8)*/ (avg_err_fp10) / AOMMAX((tf_decay_factor >> 10), 1), 7 * 16);
+        adjusted_weight[subblock_idx] = (expf_tab_fp16[scaled_diff16] * TF_WEIGHT_SCALE) >> 17;
+    }
+
+    apply_weights_lbd_avx512(y_pre, y_pre_stride, block_width, block_height, y_accum, y_count, adjusted_weight);
+}
+
+void svt_av1_apply_zz_based_temporal_filter_planewise_medium_avx512(
+    struct MeContext *me_ctx, const uint8_t *y_pre, int y_pre_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height, int ss_x, int ss_y, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+    svt_av1_apply_zz_based_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                           y_pre,
+                                                                           y_pre_stride,
+                                                                           (unsigned int)block_width,
+                                                                           (unsigned int)block_height,
+                                                                           y_accum,
+                                                                           y_count,
+                                                                           me_ctx->tf_decay_factor_fp16[C_Y]);
+
+    if (me_ctx->tf_chroma) {
+        svt_av1_apply_zz_based_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                               u_pre,
+                                                                               uv_pre_stride,
+                                                                               (unsigned int)block_width >> ss_x,
+                                                                               (unsigned int)block_height >> ss_y,
+                                                                               u_accum,
+                                                                               u_count,
+                                                                               me_ctx->tf_decay_factor_fp16[C_U]);
+
+        svt_av1_apply_zz_based_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                               v_pre,
+                                                                               uv_pre_stride,
+                                                                               (unsigned int)block_width >> ss_x,
+                                                                               (unsigned int)block_height >> ss_y,
+                                                                               v_accum,
+                                                                               v_count,
+                                                                               me_ctx->tf_decay_factor_fp16[C_V]);
+    }
+}
+
+static void svt_av1_apply_temporal_filter_planewise_medium_partial_avx512(
+    struct MeContext *me_ctx, const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre, int y_pre_stride,
+    unsigned int block_width, unsigned int block_height, uint32_t *y_accum, uint16_t *y_count, uint32_t tf_decay_factor,
+    uint32_t luma_window_error_quad_fp8[4], int is_chroma) {
+    unsigned int i, subblock_idx;
+
+    int32_t  idx_32x32               = me_ctx->tf_block_col + me_ctx->tf_block_row * 2;
+    uint32_t distance_threshold_fp16 = AOMMAX((me_ctx->tf_mv_dist_th << 16) / 10, 1 << 16);
+
+    //Calculation for every quarter
+    uint32_t  d_factor_fp8[4];
+    uint32_t  block_error_fp8[4];
+    uint32_t  chroma_window_error_quad_fp8[4];
+    uint32_t *window_error_quad_fp8 = is_chroma ? chroma_window_error_quad_fp8 : luma_window_error_quad_fp8;
+    int32_t   quad_error[4];
+
+    if (me_ctx->tf_32x32_block_split_flag[idx_32x32]) {
+        for (i = 0; i < 4; ++i) {
+            int32_t col = me_ctx->tf_16x16_mv_x[idx_32x32 * 4 + i];
+            int32_t row = me_ctx->tf_16x16_mv_y[idx_32x32 * 4 + i];
+            //const float  distance = sqrtf((float)col*col + row*row);
+            uint32_t distance_fp4 = sqrt_fast(((uint32_t)(col * col + row * row)) << 8);
+            d_factor_fp8[i]       = AOMMAX((distance_fp4 << 12) / (distance_threshold_fp16 >> 8), 1 << 8);
+            FP_ASSERT(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i] < ((uint64_t)1 << 31));
+            block_error_fp8[i] = (uint32_t)(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i]);
+        }
+    } else {
+        tf_decay_factor <<= 1;
+        int32_t col = me_ctx->tf_32x32_mv_x[idx_32x32];
+        int32_t row = me_ctx->tf_32x32_mv_y[idx_32x32];
+
+        uint32_t distance_fp4 = sqrt_fast(((uint32_t)(col * col + row * row)) << 8);
+        d_factor_fp8[0] = d_factor_fp8[1] = d_factor_fp8[2] = d_factor_fp8[3] = AOMMAX(
+            (distance_fp4 << 12) / (distance_threshold_fp16 >> 8), 1 << 8);
+        FP_ASSERT(me_ctx->tf_32x32_block_error[idx_32x32] < ((uint64_t)1 << 30));
+        block_error_fp8[0] = block_error_fp8[1] = block_error_fp8[2] = block_error_fp8[3] =
+            (uint32_t)(me_ctx->tf_32x32_block_error[idx_32x32] >> 2);
+    }
+
+    calculate_squared_errors_quad_no_div_avx512(y_src, y_src_stride, y_pre, y_pre_stride, block_width, quad_error);
+    // 16x16 windows are used as is, 8x8 windows are scaled to the same fp8 range (sum<<2)
+    for (i = 0; i < 4; ++i) window_error_quad_fp8[i] = (uint32_t)quad_error[i] << (block_width == 32 ? 0 : 2);
+
+    if (is_chroma) {
+        for (i = 0; i < 4; ++i) {
+            FP_ASSERT(((int64_t)window_error_quad_fp8[i] * 5 + luma_window_error_quad_fp8[i]) < ((int64_t)1 << 31));
+            window_error_quad_fp8[i] = (window_error_quad_fp8[i] * 5 + luma_window_error_quad_fp8[i]) / 6;
+        }
+    }
+
+    uint32_t adjusted_weight[4];
+
+    for (subblock_idx = 0; subblock_idx < 4; subblock_idx++) {
+        uint32_t combined_error_fp8 = (window_error_quad_fp8[subblock_idx] * TF_WINDOW_BLOCK_BALANCE_WEIGHT +
+                                       block_error_fp8[subblock_idx]) /
+            (TF_WINDOW_BLOCK_BALANCE_WEIGHT + 1);
+
+        uint64_t avg_err_fp10  = ((combined_error_fp8 >> 3) * (d_factor_fp8[subblock_idx] >> 3));
+        uint32_t scaled_diff16 = (uint32_t)AOMMIN(
+            /*((16*avg_err)<<8)*/ (avg_err_fp10) / AOMMAX((tf_decay_factor >> 10), 1), 7 * 16);
+        adjusted_weight[subblock_idx] = (expf_tab_fp16[scaled_diff16] * TF_WEIGHT_SCALE) >> 16;
+    }
+
+    apply_weights_lbd_avx512(y_pre, y_pre_stride, block_width, block_height, y_accum, y_count, adjusted_weight);
+}
+
+void svt_av1_apply_temporal_filter_planewise_medium_avx512(
+    struct MeContext *me_ctx, const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre, int y_pre_stride,
+    const uint8_t *u_src, const uint8_t *v_src, int uv_src_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height, int ss_x, int ss_y, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+    uint32_t luma_window_error_quad_fp8[4];
+
+    svt_av1_apply_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                  y_src,
+                                                                  y_src_stride,
+                                                                  y_pre,
+                                                                  y_pre_stride,
+                                                                  (unsigned int)block_width,
+                                                                  (unsigned int)block_height,
+                                                                  y_accum,
+                                                                  y_count,
+                                                                  me_ctx->tf_decay_factor_fp16[C_Y],
+                                                                  luma_window_error_quad_fp8,
+                                                                  0);
+
+    if (me_ctx->tf_chroma) {
+        svt_av1_apply_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                      u_src,
+                                                                      uv_src_stride,
+                                                                      u_pre,
+                                                                      uv_pre_stride,
+                                                                      (unsigned int)block_width >> ss_x,
+                                                                      (unsigned int)block_height >> ss_y,
+                                                                      u_accum,
+                                                                      u_count,
+                                                                      me_ctx->tf_decay_factor_fp16[C_U],
+                                                                      luma_window_error_quad_fp8,
+                                                                      1);
+
+        svt_av1_apply_temporal_filter_planewise_medium_partial_avx512(me_ctx,
+                                                                      v_src,
+                                                                      uv_src_stride,
+                                                                      v_pre,
+                                                                      uv_pre_stride,
+                                                                      (unsigned int)block_width >> ss_x,
+                                                                      (unsigned int)block_height >> ss_y,
+                                                                      v_accum,
+                                                                      v_count,
+                                                                      me_ctx->tf_decay_factor_fp16[C_V],
+                                                                      luma_window_error_quad_fp8,
+                                                                      1);
+    }
+}
+
+static void svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_partial_avx512(
+    struct MeContext *me_ctx, const uint16_t *y_pre, int y_pre_stride, unsigned int block_width,
+    unsigned int block_height, uint32_t *y_accum, uint16_t *y_count, const uint32_t tf_decay_factor) {
+    unsigned int i, subblock_idx;
+
+    int32_t  idx_32x32 = me_ctx->tf_block_col + me_ctx->tf_block_row * 2;
+    uint32_t block_error_fp8[4];
+
+    if (me_ctx->tf_32x32_block_split_flag[idx_32x32]) {
+        for (i = 0; i < 4; ++i) {
+            block_error_fp8[i] = (uint32_t)(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i] >> 4);
+        }
+    } else {
+        block_error_fp8[0] = block_error_fp8[1] = block_error_fp8[2] = block_error_fp8[3] =
+            (uint32_t)(me_ctx->tf_32x32_block_error[idx_32x32] >> 6);
+    }
+
+    uint32_t adjusted_weight[4];
+
+    for (subblock_idx = 0; subblock_idx < 4; subblock_idx++) {
+        uint32_t avg_err_fp10 = (block_error_fp8[subblock_idx]) << 2;
+        FP_ASSERT((((int64_t)block_error_fp8[subblock_idx]) << 2) < ((int64_t)1 << 31));
+
+        uint32_t scaled_diff16 = AOMMIN(
+            /*((16*avg_err)<<8)*/ (avg_err_fp10) / AOMMAX((tf_decay_factor >> 10), 1), 7 * 16);
+        adjusted_weight[subblock_idx] = (expf_tab_fp16[scaled_diff16] * TF_WEIGHT_SCALE) >> 17;
+    }
+
+    apply_weights_hbd_avx512(y_pre, y_pre_stride, block_width, block_height, y_accum, y_count, adjusted_weight);
+}
+
+void svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_avx512(
+    struct MeContext *me_ctx, const uint16_t *y_pre, int y_pre_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height, int ss_x, int ss_y, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    uint32_t encoder_bit_depth) {
+    (void)encoder_bit_depth;
+    svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                               y_pre,
+                                                                               y_pre_stride,
+                                                                               (unsigned int)block_width,
+                                                                               (unsigned int)block_height,
+                                                                               y_accum,
+                                                                               y_count,
+                                                                               me_ctx->tf_decay_factor_fp16[C_Y]);
+    if (me_ctx->tf_chroma) {
+        svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                                   u_pre,
+                                                                                   uv_pre_stride,
+                                                                                   (unsigned int)block_width >> ss_x,
+                                                                                   (unsigned int)block_height >> ss_y,
+                                                                                   u_accum,
+                                                                                   u_count,
+                                                                                   me_ctx->tf_decay_factor_fp16[C_U]);
+
+        svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                                   v_pre,
+                                                                                   uv_pre_stride,
+                                                                                   (unsigned int)block_width >> ss_x,
+                                                                                   (unsigned int)block_height >> ss_y,
+                                                                                   v_accum,
+                                                                                   v_count,
+                                                                                   me_ctx->tf_decay_factor_fp16[C_V]);
+    }
+}
+
+static void svt_av1_apply_temporal_filter_planewise_medium_hbd_partial_avx512(
+    struct MeContext *me_ctx, const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre, int y_pre_stride,
+    unsigned int block_width, unsigned int block_height, uint32_t *y_accum, uint16_t *y_count, uint32_t tf_decay_factor,
+    uint32_t luma_window_error_quad_fp8[4], int is_chroma, uint32_t encoder_bit_depth) {
+    unsigned int i, subblock_idx;
+
+    int32_t  idx_32x32               = me_ctx->tf_block_col + me_ctx->tf_block_row * 2;
+    int      shift_factor            = ((encoder_bit_depth - 8) * 2);
+    uint32_t distance_threshold_fp16 = AOMMAX((me_ctx->tf_mv_dist_th << 16) / 10, 1 << 16);
+    //Calculation for every quarter
+    uint32_t  d_factor_fp8[4];
+    uint32_t  block_error_fp8[4];
+    uint32_t  chroma_window_error_quad_fp8[4];
+    uint32_t *window_error_quad_fp8 = is_chroma ? chroma_window_error_quad_fp8 : luma_window_error_quad_fp8;
+    int32_t   quad_error[4];
+
+    if (me_ctx->tf_32x32_block_split_flag[idx_32x32]) {
+        for (i = 0; i < 4; ++i) {
+            int32_t col = me_ctx->tf_16x16_mv_x[idx_32x32 * 4 + i];
+            int32_t row = me_ctx->tf_16x16_mv_y[idx_32x32 * 4 + i];
+            //const float  distance = sqrtf((float)col*col + row*row);
+            uint32_t distance_fp4 = sqrt_fast(((uint32_t)(col * col + row * row)) << 8);
+            d_factor_fp8[i]       = AOMMAX((distance_fp4 << 12) / (distance_threshold_fp16 >> 8), 1 << 8);
+            FP_ASSERT(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i] < ((uint64_t)1 << 35));
+            block_error_fp8[i] = (uint32_t)(me_ctx->tf_16x16_block_error[idx_32x32 * 4 + i] >> 4);
+        }
+    } else {
+        tf_decay_factor <<= 1;
+        int32_t col = me_ctx->tf_32x32_mv_x[idx_32x32];
+        int32_t row = me_ctx->tf_32x32_mv_y[idx_32x32];
+
+        uint32_t distance_fp4 = sqrt_fast(((uint32_t)(col * col + row * row)) << 8);
+        d_factor_fp8[0] = d_factor_fp8[1] = d_factor_fp8[2] = d_factor_fp8[3] = AOMMAX(
+            (distance_fp4 << 12) / (distance_threshold_fp16 >> 8), 1 << 8);
+        FP_ASSERT(me_ctx->tf_32x32_block_error[idx_32x32] < ((uint64_t)1 << 35));
+        block_error_fp8[0] = block_error_fp8[1] = block_error_fp8[2] = block_error_fp8[3] =
+            (uint32_t)(me_ctx->tf_32x32_block_error[idx_32x32] >> 6);
+    }
+
+    calculate_squared_errors_quad_no_div_highbd_avx512(
+        y_src, y_src_stride, y_pre, y_pre_stride, block_width, quad_error);
+    for (i = 0; i < 4; ++i)
+        window_error_quad_fp8[i] = (uint32_t)(quad_error[i] >> shift_factor) << (block_width == 32 ? 0 : 2);
+
+    if (is_chroma) {
+        for (i = 0; i < 4; ++i) {
+            FP_ASSERT(((int64_t)window_error_quad_fp8[i] * 5 + luma_window_error_quad_fp8[i]) < ((int64_t)1 << 31));
+            window_error_quad_fp8[i] = (window_error_quad_fp8[i] * 5 + luma_window_error_quad_fp8[i]) / 6;
+        }
+    }
+
+    uint32_t adjusted_weight[4];
+
+    for (subblock_idx = 0; subblock_idx < 4; subblock_idx++) {
+        uint32_t combined_error_fp8 = (window_error_quad_fp8[subblock_idx] * TF_WINDOW_BLOCK_BALANCE_WEIGHT +
+                                       block_error_fp8[subblock_idx]) /
+            (TF_WINDOW_BLOCK_BALANCE_WEIGHT + 1);
+
+        uint64_t avg_err_fp10  = ((combined_error_fp8 >> 3) * (d_factor_fp8[subblock_idx] >> 3));
+        uint32_t scaled_diff16 = (uint32_t)AOMMIN(
+            /*((16*avg_err)<<8)*/ (avg_err_fp10) / AOMMAX((tf_decay_factor >> 10), 1), 7 * 16);
+        adjusted_weight[subblock_idx] = (expf_tab_fp16[scaled_diff16] * TF_WEIGHT_SCALE) >> 16;
+    }
+
+    apply_weights_hbd_avx512(y_pre, y_pre_stride, block_width, block_height, y_accum, y_count, adjusted_weight);
+}
+
+void svt_av1_apply_temporal_filter_planewise_medium_hbd_avx512(
+    struct MeContext *me_ctx, const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre, int y_pre_stride,
+    const uint16_t *u_src, const uint16_t *v_src, int uv_src_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height, int ss_x, int ss_y, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    uint32_t encoder_bit_depth) {
+    uint32_t luma_window_error_quad_fp8[4];
+
+    svt_av1_apply_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                      y_src,
+                                                                      y_src_stride,
+                                                                      y_pre,
+                                                                      y_pre_stride,
+                                                                      (unsigned int)block_width,
+                                                                      (unsigned int)block_height,
+                                                                      y_accum,
+                                                                      y_count,
+                                                                      me_ctx->tf_decay_factor_fp16[C_Y],
+                                                                      luma_window_error_quad_fp8,
+                                                                      0,
+                                                                      encoder_bit_depth);
+    if (me_ctx->tf_chroma) {
+        svt_av1_apply_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                          u_src,
+                                                                          uv_src_stride,
+                                                                          u_pre,
+                                                                          uv_pre_stride,
+                                                                          (unsigned int)block_width >> ss_x,
+                                                                          (unsigned int)block_height >> ss_y,
+                                                                          u_accum,
+                                                                          u_count,
+                                                                          me_ctx->tf_decay_factor_fp16[C_U],
+                                                                          luma_window_error_quad_fp8,
+                                                                          1,
+                                                                          encoder_bit_depth);
+
+        svt_av1_apply_temporal_filter_planewise_medium_hbd_partial_avx512(me_ctx,
+                                                                          v_src,
+                                                                          uv_src_stride,
+                                                                          v_pre,
+                                                                          uv_pre_stride,
+                                                                          (unsigned int)block_width >> ss_x,
+                                                                          (unsigned int)block_height >> ss_y,
+                                                                          v_accum,
+                                                                          v_count,
+                                                                          me_ctx->tf_decay_factor_fp16[C_V],
+                                                                          luma_window_error_quad_fp8,
+                                                                          1,
+                                                                          encoder_bit_depth);
+    }
+}
+
+static INLINE int32_t hadd_epi32_512(const __m512i val) {
+    const __m256i val2 = _mm256_add_epi32(_mm512_castsi512_si256(val), _mm512_extracti64x4_epi64(val, 1));
+    return hadd_epi32_128(_mm_add_epi32(_mm256_castsi256_si128(val2), _mm256_extracti128_si256(val2, 0x1)));
+}
+
+int32_t svt_estimate_noise_fp16_avx512(const uint8_t *src, uint16_t width, uint16_t height, uint16_t stride_y) {
+    int64_t sum = 0;
+    int64_t num = 0;
+
+    //  A | B | C
+    //  D | E | F
+    //  G | H | I
+    // g_x = (A - I) + (G - C) + 2*(D - F)
+    // g_y = (A - I) - (G - C) + 2*(B - H)
+    // v   = 4*E - 2*(D+F+B+H) + (A+C+G+I)
+
+    const __m512i zero            = _mm512_setzero_si512();
+    const __m512i one             = _mm512_set1_epi16(1);
+    const __m512i edge_treshold   = _mm512_set1_epi16(EDGE_THRESHOLD);
+    __m512i       num_accumulator = _mm512_setzero_si512();
+    __m512i       sum_accumulator = _mm512_setzero_si512();
+
+    for (int i = 1; i < height - 1; ++i) {
+        int j = 1;
+        for (; j + 32 < width - 1; j += 32) {
+            const int k = i * stride_y + j;
+
+            __m512i A = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k - stride_y - 1])));
+            __m512i B = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k - stride_y])));
+            __m512i C = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k - stride_y + 1])));
+            __m512i D = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k - 1])));
+            __m512i E = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k])));
+            __m512i F = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k + 1])));
+            __m512i G = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k + stride_y - 1])));
+            __m512i H = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k + stride_y])));
+            __m512i I = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *)(&src[k + stride_y + 1])));
+
+            __m512i A_m_I   = _mm512_sub_epi16(A, I);
+            __m512i G_m_C   = _mm512_sub_epi16(G, C);
+            __m512i D_m_Fx2 = _mm512_slli_epi16(_mm512_sub_epi16(D, F), 1);
+            __m512i B_m_Hx2 = _mm512_slli_epi16(_mm512_sub_epi16(B, H), 1);
+
+            __m512i gx_avx = _mm512_abs_epi16(_mm512_add_epi16(_mm512_add_epi16(A_m_I, G_m_C), D_m_Fx2));
+            __m512i gy_avx = _mm512_abs_epi16(_mm512_add_epi16(_mm512_sub_epi16(A_m_I, G_m_C), B_m_Hx2));
+            __m512i ga_avx = _mm512_add_epi16(gx_avx, gy_avx);
+
+            __m512i D_F_B_Hx2 = _mm512_slli_epi16(_mm512_add_epi16(_mm512_add_epi16(D, F), _mm512_add_epi16(B, H)), 1);
+            __m512i A_C_G_I   = _mm512_add_epi16(_mm512_add_epi16(A, C), _mm512_add_epi16(G, I));
+            __m512i v_avx512  = _mm512_abs_epi16(
+                _mm512_add_epi16(_mm512_sub_epi16(_mm512_slli_epi16(E, 2), D_F_B_Hx2), A_C_G_I));
+
+            //if (ga < EDGE_THRESHOLD)
+            const __mmask32 smooth = _mm512_cmpgt_epi16_mask(edge_treshold, ga_avx);
+            v_avx512               = _mm512_maskz_mov_epi16(smooth, v_avx512);
+
+            //num_accumulator and sum_accumulator have 32bit values
+            num_accumulator = _mm512_add_epi32(num_accumulator,
+                                               _mm512_madd_epi16(_mm512_maskz_mov_epi16(smooth, one), one));
+            sum_accumulator = _mm512_add_epi32(sum_accumulator, _mm512_unpacklo_epi16(v_avx512, zero));
+            sum_accumulator = _mm512_add_epi32(sum_accumulator, _mm512_unpackhi_epi16(v_avx512, zero));
+        }
+        for (; j < width - 1; ++j) {
+            const int k = i * stride_y + j;
+
+            // Sobel gradients
+            const int g_x = (src[k - stride_y - 1] - src[k - stride_y + 1]) +
+                (src[k + stride_y - 1] - src[k + stride_y + 1]) + 2 * (src[k - 1] - src[k + 1]);
+            const int g_y = (src[k - stride_y - 1] - src[k + stride_y - 1]) +
+                (src[k - stride_y + 1] - src[k + stride_y + 1]) + 2 * (src[k - stride_y] - src[k + stride_y]);
+            const int ga = abs(g_x) + abs(g_y);
+
+            if (ga < EDGE_THRESHOLD) { // Do not consider edge pixels to estimate the noise
+                // Find Laplacian
+                const int v = 4 * src[k] - 2 * (src[k - 1] + src[k + 1] + src[k - stride_y] + src[k + stride_y]) +
+                    (src[k - stride_y - 1] + src[k - stride_y + 1] + src[k + stride_y - 1] + src[k + stride_y + 1]);
+                sum += abs(v);
+                ++num;
+            }
+        }
+    }
+
+    sum += hadd_epi32_512(sum_accumulator);
+    num += hadd_epi32_512(num_accumulator);
+
+    // If very few smooth pels, return -1 since the estimate is unreliable
+    if (num < SMOOTH_THRESHOLD) {
+        return -65536 /*-1:fp16*/;
+    }
+
+    FP_ASSERT((((int64_t)sum * SQRT_PI_BY_2_FP16) / (6 * num)) < ((int64_t)1 << 31));
+    return (int32_t)((sum * SQRT_PI_BY_2_FP16) / (6 * num));
+}
+
+int32_t svt_estimate_noise_highbd_fp16_avx512(const uint16_t *src, int width, int height, int stride, int bd) {
+    int64_t sum = 0;
+    int64_t num = 0;
+
+    //  A | B | C
+    //  D | E | F
+    //  G | H | I
+    // g_x = (A - I) + (G - C) + 2*(D - F)
+    // g_y = (A - I) - (G - C) + 2*(B - H)
+    // v   = 4*E - 2*(D+F+B+H) + (A+C+G+I)
+
+    const __m512i zero            = _mm512_setzero_si512();
+    const __m512i one             = _mm512_set1_epi16(1);
+    const __m512i edge_treshold   = _mm512_set1_epi16(EDGE_THRESHOLD);
+    __m512i       num_accumulator = _mm512_setzero_si512();
+    __m512i       sum_accumulator = _mm512_setzero_si512();
+    const __m512i rounding        = _mm512_set1_epi16(1 << ((bd - 8) - 1));
+
+    for (int i = 1; i < height - 1; ++i) {
+        int j = 1;
+        for (; j + 32 < width - 1; j += 32) {
+            const int k = i * stride + j;
+
+            __m512i A = _mm512_loadu_si512((__m512i *)(&src[k - stride - 1]));
+            __m512i B = _mm512_loadu_si512((__m512i *)(&src[k - stride]));
+            __m512i C = _mm512_loadu_si512((__m512i *)(&src[k - stride + 1]));
+            __m512i D = _mm512_loadu_si512((__m512i *)(&src[k - 1]));
+            __m512i E = _mm512_loadu_si512((__m512i *)(&src[k]));
+            __m512i F = _mm512_loadu_si512((__m512i *)(&src[k + 1]));
+            __m512i G = _mm512_loadu_si512((__m512i *)(&src[k + stride - 1]));
+            __m512i H = _mm512_loadu_si512((__m512i *)(&src[k + stride]));
+            __m512i I = _mm512_loadu_si512((__m512i *)(&src[k + stride + 1]));
+
+            __m512i A_m_I   = _mm512_sub_epi16(A, I);
+            __m512i G_m_C   = _mm512_sub_epi16(G, C);
+            __m512i D_m_Fx2 = _mm512_slli_epi16(_mm512_sub_epi16(D, F), 1);
+            __m512i B_m_Hx2 = _mm512_slli_epi16(_mm512_sub_epi16(B, H), 1);
+
+            __m512i gx_avx = _mm512_abs_epi16(_mm512_add_epi16(_mm512_add_epi16(A_m_I, G_m_C), D_m_Fx2));
+            __m512i gy_avx = _mm512_abs_epi16(_mm512_add_epi16(_mm512_sub_epi16(A_m_I, G_m_C), B_m_Hx2));
+            __m512i ga_avx = _mm512_srai_epi16(_mm512_add_epi16(_mm512_add_epi16(gx_avx, gy_avx), rounding), (bd - 8));
+
+            __m512i D_F_B_Hx2 = _mm512_slli_epi16(_mm512_add_epi16(_mm512_add_epi16(D, F), _mm512_add_epi16(B, H)), 1);
+            __m512i A_C_G_I   = _mm512_add_epi16(_mm512_add_epi16(A, C), _mm512_add_epi16(G, I));
+            __m512i v_avx512  = _mm512_abs_epi16(
+                _mm512_add_epi16(_mm512_sub_epi16(_mm512_slli_epi16(E, 2), D_F_B_Hx2), A_C_G_I));
+
+            //if (ga < EDGE_THRESHOLD)
+            const __mmask32 smooth = _mm512_cmpgt_epi16_mask(edge_treshold, ga_avx);
+            v_avx512               = _mm512_srai_epi16(
+                _mm512_add_epi16(_mm512_maskz_mov_epi16(smooth, v_avx512), rounding), (bd - 8));
+
+            //num_accumulator and sum_accumulator have 32bit values
+            num_accumulator = _mm512_add_epi32(num_accumulator,
+                                               _mm512_madd_epi16(_mm512_maskz_mov_epi16(smooth, one), one));
+            sum_accumulator = _mm512_add_epi32(sum_accumulator, _mm512_unpacklo_epi16(v_avx512, zero));
+            sum_accumulator = _mm512_add_epi32(sum_accumulator, _mm512_unpackhi_epi16(v_avx512, zero));
+        }
+        for (; j < width - 1; ++j) {
+            const int k = i * stride + j;
+
+            // Sobel gradients
+            const int g_x = (src[k - stride - 1] - src[k - stride + 1]) + (src[k + stride - 1] - src[k + stride + 1]) +
+                2 * (src[k - 1] - src[k + 1]);
+            const int g_y = (src[k - stride - 1] - src[k + stride - 1]) + (src[k - stride + 1] - src[k + stride + 1]) +
+                2 * (src[k - stride] - src[k + stride]);
+            const int ga = ROUND_POWER_OF_TWO(abs(g_x) + abs(g_y),
+                                              bd - 8); // divide by 2^2 and round up
+            if (ga < EDGE_THRESHOLD) { // Do not consider edge pixels to estimate the noise
+                // Find Laplacian
+                const int v = 4 * src[k] - 2 * (src[k - 1] + src[k + 1] + src[k - stride] + src[k + stride]) +
+                    (src[k - stride - 1] + src[k - stride + 1] + src[k + stride - 1] + src[k + stride + 1]);
+                sum += ROUND_POWER_OF_TWO(abs(v), bd - 8);
+                ++num;
+            }
+        }
+    }
+
+    sum += hadd_epi32_512(sum_accumulator);
+    num += hadd_epi32_512(num_accumulator);
+
+    // If very few smooth pels, return -1 since the estimate is unreliable
+    if (num < SMOOTH_THRESHOLD) {
+        return -65536 /*-1:fp16*/;
+    }
+
+    FP_ASSERT((((int64_t)sum * SQRT_PI_BY_2_FP16) / (6 * num)) < ((int64_t)1 << 31));
+    return (int32_t)((sum * SQRT_PI_BY_2_FP16) / (6 * num));
+}
+
+#endif // EN_AVX512_SUPPORT
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <nmmintrin.h>
+
+#include "aom_dsp_rtcd.h"
+#include "hash.h"
+
+uint32_t svt_av1_get_crc32c_value_sse4_2(const uint32_t *words, int count) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (int i = 0; i < count; i++) crc = _mm_crc32_u32(crc, words[i]);
+    return crc ^ 0xFFFFFFFF;
+}
+
+void svt_av1_generate_block_2x2_hash_row_sse4_2(const uint8_t *src, int stride, int width, uint32_t *hash1,
+                                                uint32_t *hash2, int8_t *row_same, int8_t *col_same) {
+    const __m128i one  = _mm_set1_epi8(1);
+    const __m128i mult = _mm_set1_epi32((int)CRC32C_HASH2_MULTIPLIER);
+    DECLARE_ALIGNED(16, uint32_t, words[2][16]);
+    int x_pos = 0;
+
+    for (; x_pos + 16 <= width; x_pos += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + x_pos));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + x_pos + 1));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + stride + x_pos));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(src + stride + x_pos + 1));
+
+        const __m128i row = _mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(c, d));
+        const __m128i col = _mm_and_si128(_mm_cmpeq_epi8(a, c), _mm_cmpeq_epi8(b, d));
+        _mm_storeu_si128((__m128i *)(row_same + x_pos), _mm_and_si128(row, one));
+        _mm_storeu_si128((__m128i *)(col_same + x_pos), _mm_and_si128(col, one));
+
+        // Gather the 4 pixels of each 2x2 block in one 32-bit word.
+        const __m128i ab_lo = _mm_unpacklo_epi8(a, b);
+        const __m128i ab_hi = _mm_unpackhi_epi8(a, b);
+        const __m128i cd_lo = _mm_unpacklo_epi8(c, d);
+        const __m128i cd_hi = _mm_unpackhi_epi8(c, d);
+        const __m128i w0    = _mm_unpacklo_epi16(ab_lo, cd_lo);
+        const __m128i w1    = _mm_unpackhi_epi16(ab_lo, cd_lo);
+        const __m128i w2    = _mm_unpacklo_epi16(ab_hi, cd_hi);
+        const __m128i w3    = _mm_unpackhi_epi16(ab_hi, cd_hi);
+        _mm_store_si128((__m128i *)&words[0][0], w0);
+        _mm_store_si128((__m128i *)&words[0][4], w1);
+        _mm_store_si128((__m128i *)&words[0][8], w2);
+        _mm_store_si128((__m128i *)&words[0][12], w3);
+        _mm_store_si128((__m128i *)&words[1][0], _mm_mullo_epi32(w0, mult));
+        _mm_store_si128((__m128i *)&words[1][4], _mm_mullo_epi32(w1, mult));
+        _mm_store_si128((__m128i *)&words[1][8], _mm_mullo_epi32(w2, mult));
+        _mm_store_si128((__m128i *)&words[1][12], _mm_mullo_epi32(w3, mult));
+
+        for (int i = 0; i < 16; i++) {
+            hash1[x_pos + i] = _mm_crc32_u32(0xFFFFFFFF, words[0][i]) ^ 0xFFFFFFFF;
+            hash2[x_pos + i] = _mm_crc32_u32(0xFFFFFFFF, words[1][i]) ^ 0xFFFFFFFF;
+        }
+    }
+
+    if (x_pos < width)
+        svt_av1_generate_block_2x2_hash_row_c(src + x_pos,
+                                              stride,
+                                              width - x_pos,
+                                              hash1 + x_pos,
+                                              hash2 + x_pos,
+                                              row_same + x_pos,
+                                              col_same + x_pos);
+}
+
+void svt_av1_generate_block_hash_row_sse4_2(const uint32_t *src_hash1, const uint32_t *src_hash2, int src_size,
+                                            int stride, int width, uint32_t *dst_hash1, uint32_t *dst_hash2) {
+    const uint32_t *src1_tl = src_hash1;
+    const uint32_t *src1_tr = src_hash1 + src_size;
+    const uint32_t *src1_bl = src_hash1 + src_size * stride;
+    const uint32_t *src1_br = src1_bl + src_size;
+    const uint32_t *src2_tl = src_hash2;
+    const uint32_t *src2_tr = src_hash2 + src_size;
+    const uint32_t *src2_bl = src_hash2 + src_size * stride;
+    const uint32_t *src2_br = src2_bl + src_size;
+    const __m128i   mult    = _mm_set1_epi32((int)CRC32C_HASH2_MULTIPLIER);
+    DECLARE_ALIGNED(16, uint32_t, words[4][4]);
+    int x_pos = 0;
+
+    for (; x_pos + 4 <= width; x_pos += 4) {
+        _mm_store_si128((__m128i *)words[0],
+                        _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(src2_tl + x_pos)), mult));
+        _mm_store_si128((__m128i *)words[1],
+                        _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(src2_tr + x_pos)), mult));
+        _mm_store_si128((__m128i *)words[2],
+                        _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(src2_bl + x_pos)), mult));
+        _mm_store_si128((__m128i *)words[3],
+                        _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(src2_br + x_pos)), mult));
+
+        for (int i = 0; i < 4; i++) {
+            const int x   = x_pos + i;
+            uint32_t  crc = _mm_crc32_u32(0xFFFFFFFF, src1_tl[x]);
+            crc           = _mm_crc32_u32(crc, src1_tr[x]);
+            crc           = _mm_crc32_u32(crc, src1_bl[x]);
+            crc           = _mm_crc32_u32(crc, src1_br[x]);
+            dst_hash1[x]  = crc ^ 0xFFFFFFFF;
+
+            crc          = _mm_crc32_u32(0xFFFFFFFF, words[0][i]);
+            crc          = _mm_crc32_u32(crc, words[1][i]);
+            crc          = _mm_crc32_u32(crc, words[2][i]);
+            crc          = _mm_crc32_u32(crc, words[3][i]);
+            dst_hash2[x] = crc ^ 0xFFFFFFFF;
+        }
+    }
+
+    if (x_pos < width)
+        svt_av1_generate_block_hash_row_c(src_hash1 + x_pos,
+                                          src_hash2 + x_pos,
+                                          src_size,
+                                          stride,
+                                          width - x_pos,
+                                          dst_hash1 + x_pos,
+                                          dst_hash2 + x_pos);
+}
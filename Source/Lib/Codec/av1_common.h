@@ -42,6 +42,10 @@ typedef struct WnFilterCtrls {
     // frames) if 1, enable Wiener filtering to be used for chroma planes, else use for luma plane
     // only
     Bool use_chroma;
+    // Start from the filter of the co-located rest. unit in the nearest reference of the same temporal layer, and
+    // skip the coeff generation when that filter removes at least warm_start_th % of the unfiltered SSE
+    Bool    warm_start;
+    uint8_t warm_start_th;
 } WnFilterCtrls;
 
 typedef struct SgFilterCtrls {
@@ -57,6 +61,10 @@ typedef struct SgFilterCtrls {
     int8_t refine[PLANE_TYPES]; //refinement for alpha/beta   1:do the refinment  0:no refinement
     // if 1, enable Wiener filtering to be used for chroma planes, else use for luma plane only
     Bool use_chroma;
+    // Test the ep of the co-located rest. unit in the nearest reference of the same temporal layer first, and skip
+    // the ep search when it removes at least warm_start_th % of the unfiltered SSE
+    Bool    warm_start;
+    uint8_t warm_start_th;
 } SgFilterCtrls;
 typedef struct Av1Common {
     int32_t  mi_rows;
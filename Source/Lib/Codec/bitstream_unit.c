@@ -11,6 +11,7 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "bitstream_unit.h"
 #include "definitions.h"
@@ -129,8 +130,47 @@ month=Jul,
 URL="http://researchcommons.waikato.ac.nz/Bitstream/handle/10289/78/content.pdf"
 }*/
 
+/*Converts a 64-bit value to big-endian byte order.*/
+static INLINE uint64_t od_ec_to_be64(uint64_t x) {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return x;
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(x);
+#elif defined(__GNUC__)
+    return __builtin_bswap64(x);
+#else
+    x = ((x & 0x00FF00FF00FF00FFULL) << 8) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+    x = ((x & 0x0000FFFF0000FFFFULL) << 16) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+    return (x << 32) | (x >> 32);
+#endif
+}
+
+/*Adds a carry to the byte at offs, rippling it towards the start of the buffer
+for as long as bytes overflow.*/
+static INLINE void od_ec_propagate_carry_bwd(uint8_t *buf, uint32_t offs) {
+    uint16_t sum;
+    do {
+        sum         = (uint16_t)buf[offs] + 1;
+        buf[offs--] = (uint8_t)sum;
+    } while (sum >> 8);
+}
+
+/*Writes the num_bytes_ready low bytes of output at offs in big-endian order
+using a single 8-byte store, then resolves the carry into the bytes already
+written.
+The caller guarantees that at least 8 bytes are available at offs.*/
+static INLINE void od_ec_write_out_buf(uint8_t *out, uint32_t offs, uint64_t output, uint64_t carry,
+                                       uint32_t num_bytes_ready) {
+    const uint64_t reg = od_ec_to_be64(output << ((8 - num_bytes_ready) << 3));
+    memcpy(&out[offs], &reg, sizeof(reg));
+    if (carry) {
+        assert(offs > 0);
+        od_ec_propagate_carry_bwd(out, offs - 1);
+    }
+}
+
 /*Takes updated low and range values, renormalizes them so that
-32768 <= rng < 65536 (flushing bytes from low to the pre-carry buffer if
+32768 <= rng < 65536 (flushing bytes from low to the output buffer if
 necessary), and stores them back in the encoder context.
 low: The new value of low.
 rng: The new value of the range.*/
@@ -138,51 +178,45 @@ static void od_ec_enc_normalize(OdEcEnc *enc, OdEcWindow low, unsigned rng) {
     int32_t d;
     int32_t c;
     int32_t s;
+    if (enc->error)
+        return;
     c = enc->cnt;
     assert(rng <= 65535U);
     d = 16 - OD_ILOG_NZ(rng);
     s = c + d;
-    /*TODO: Right now we flush every time we have at least one byte available.
-    Instead we should use an OdEcWindow and flush right before we're about to
-    shift bits off the end of the window.
-    For a 32-bit window this is about the same amount of work, but for a 64-bit
-    window it should be a fair win.*/
-    if (s >= 0) {
-        uint16_t *buf;
-        uint32_t  storage;
-        uint32_t  offs;
-        unsigned  m;
-        buf     = enc->precarry_buf;
-        storage = enc->precarry_storage;
-        offs    = enc->offs;
-        if (offs + 2 > storage) {
-            storage = 2 * storage + 2;
-            buf     = realloc(enc->precarry_buf, sizeof(*buf) * storage);
-            if (!buf) {
+    /*Bytes are only flushed once low cannot hold another symbol: one byte of
+    the 64-bit window is kept for the carry and 16 bits are kept for the next
+    renormalization shift, so we flush once s reaches 64 - 8 - 16 = 40.*/
+    if (s >= 40) {
+        uint8_t *out     = enc->buf;
+        uint32_t storage = enc->storage;
+        uint32_t offs    = enc->offs;
+        if (offs + 8 > storage) {
+            storage = 2 * storage + 8;
+            out     = (uint8_t *)realloc(out, sizeof(*out) * storage);
+            if (!out) {
                 enc->error = -1;
-                enc->offs  = 0;
                 return;
             }
-            enc->precarry_buf     = buf;
-            enc->precarry_storage = storage;
+            enc->buf     = out;
+            enc->storage = storage;
         }
-        c += 16;
-        m = (1 << c) - 1;
-        if (s >= 8) {
-            assert(offs < storage);
-            buf[offs++] = (uint16_t)(low >> c);
-            low &= m;
-            c -= 8;
-            m >>= 8;
-        }
-        assert(offs < storage);
-        buf[offs++] = (uint16_t)(low >> c);
-        s           = c + d - 24;
-        low &= m;
-        enc->offs = offs;
+        /*cnt always lags one byte behind (it starts at -9), hence the + 1.*/
+        const uint32_t num_bytes_ready = (s >> 3) + 1;
+        /*Number of bits of low that are not ready yet, accounting for the
+        24 cushion bits of the 64-bit window.*/
+        c += 24 - (num_bytes_ready << 3);
+        uint64_t output = low >> c;
+        low &= ((uint64_t)1 << c) - 1;
+        const uint64_t mask  = (uint64_t)1 << (num_bytes_ready << 3);
+        const uint64_t carry = output & mask;
+        output &= mask - 1;
+        od_ec_write_out_buf(out, offs, output, carry, num_bytes_ready);
+        enc->offs = offs + num_bytes_ready;
+        s         = c + d - 24;
     }
     enc->low = low << d;
-    enc->rng = (int16_t)(rng << d);
+    enc->rng = (uint16_t)(rng << d);
     enc->cnt = (int16_t)s;
 }
 
@@ -196,12 +230,6 @@ void svt_od_ec_enc_init(OdEcEnc *enc, uint32_t size) {
         enc->storage = 0;
         enc->error   = -1;
     }
-    enc->precarry_buf     = (uint16_t *)malloc(sizeof(*enc->precarry_buf) * size);
-    enc->precarry_storage = size;
-    if (size > 0 && enc->precarry_buf == NULL) {
-        enc->precarry_storage = 0;
-        enc->error            = -1;
-    }
 }
 
 /*Reinitializes the encoder.*/
@@ -220,10 +248,7 @@ void svt_od_ec_enc_reset(OdEcEnc *enc) {
 }
 
 /*Frees the buffers used by the encoder.*/
-void svt_od_ec_enc_clear(OdEcEnc *enc) {
-    free(enc->precarry_buf);
-    free(enc->buf);
-}
+void svt_od_ec_enc_clear(OdEcEnc *enc) { free(enc->buf); }
 
 /*Encodes a symbol given its frequency in Q15.
 fl: CDF_PROB_TOP minus the cumulative frequency of all symbols that come
@@ -305,7 +330,6 @@ void svt_od_ec_encode_cdf_q15(OdEcEnc *enc, int32_t s, const uint16_t *icdf, int
 uint8_t *svt_od_ec_enc_done(OdEcEnc *enc, uint32_t *nbytes) {
     uint8_t   *out;
     uint32_t   storage;
-    uint16_t  *buf;
     uint32_t   offs;
     OdEcWindow m;
     OdEcWindow e;
@@ -323,8 +347,6 @@ uint8_t *svt_od_ec_enc_done(OdEcEnc *enc, uint32_t *nbytes) {
         SVT_ERROR("efficiency: %f bits/symbol\n", (double)tell / enc->nb_symbols);
     }
 #endif
-    /*We output the minimum number of bits that ensures that the symbols encoded
-    thus far will be decoded correctly regardless of the bits that follow.*/
     l = enc->low;
     c = enc->cnt;
     s = 10;
@@ -332,37 +354,13 @@ uint8_t *svt_od_ec_enc_done(OdEcEnc *enc, uint32_t *nbytes) {
     e = ((l + m) & ~m) | (m + 1);
     s += c;
     offs = enc->offs;
-    buf  = enc->precarry_buf;
-    if (s > 0) {
-        unsigned n;
-        storage = enc->precarry_storage;
-        if (offs + ((s + 7) >> 3) > storage) {
-            storage = storage * 2 + ((s + 7) >> 3);
-            buf     = realloc(enc->precarry_buf, sizeof(*buf) * storage);
-            if (!buf) {
-                enc->error = -1;
-                return NULL;
-            }
-            enc->precarry_buf     = buf;
-            enc->precarry_storage = storage;
-        }
-        n = (1 << (c + 16)) - 1;
-        do {
-            assert(offs < storage);
-            buf[offs++] = (uint16_t)(e >> (c + 16));
-            e &= n;
-            s -= 8;
-            c -= 8;
-            n >>= 8;
-        } while (s > 0);
-    }
     /*Make sure there's enough room for the entropy-coded bits.*/
     out     = enc->buf;
     storage = enc->storage;
     c       = OD_MAXI((s + 7) >> 3, 0);
     if (offs + c > storage) {
         storage = offs + c;
-        out     = realloc(enc->buf, sizeof(*buf) * storage);
+        out     = (uint8_t *)realloc(out, sizeof(*out) * storage);
         if (!out) {
             enc->error = -1;
             return NULL;
@@ -370,23 +368,29 @@ uint8_t *svt_od_ec_enc_done(OdEcEnc *enc, uint32_t *nbytes) {
         enc->buf     = out;
         enc->storage = storage;
     }
-    *nbytes = offs;
-    /*Perform carry propagation.*/
-    assert(offs <= storage);
-    out = out + storage - offs;
-    c   = 0;
-    while (offs > 0) {
-        offs--;
-        c         = buf[offs] + c;
-        out[offs] = (uint8_t)c;
-        c >>= 8;
+    /*We output the minimum number of bits that ensures that the symbols encoded
+    thus far will be decoded correctly regardless of the bits that follow.*/
+    c = enc->cnt;
+    if (s > 0) {
+        uint64_t n = ((uint64_t)1 << (c + 16)) - 1;
+        do {
+            assert(offs < storage);
+            const uint16_t val = (uint16_t)(e >> (c + 16));
+            out[offs]          = (uint8_t)val;
+            if (val & 0x100) {
+                assert(offs > 0);
+                od_ec_propagate_carry_bwd(out, offs - 1);
+            }
+            offs++;
+            e &= n;
+            s -= 8;
+            c -= 8;
+            n >>= 8;
+        } while (s > 0);
     }
-    /*Note: Unless there's an allocation error, if you keep encoding into the
-    current buffer and call this function again later, everything will work
-    just fine (you won't get a new packet out, but you will get a single
-    buffer with the new data appended to the old).
-    However, this function is O(N) where N is the amount of data coded so far,
-    so calling it more than once for a given packet is a bad idea.*/
+    *nbytes = offs;
+    /*Note: the final bytes are written (and carries resolved) in place in the
+    output buffer, so this must only be called once per packet.*/
     return out;
 }
 
@@ -157,9 +157,10 @@ The 0* term provides compile-time type checking */
 #define EC_PROB_SHIFT 6
 #define EC_MIN_PROB 4 // must be <= (1<<EC_PROB_SHIFT)/16
 
-/*OPT: OdEcWindow must be at least 32 bits, but if you have fast arithmetic
-on a larger type, you can speed up the decoder by using it here.*/
-typedef uint32_t OdEcWindow;
+/*The encoder keeps a 64-bit window so that bytes are only flushed once
+several of them are ready, and carries are resolved in place in the output
+buffer instead of through a separate pre-carry buffer.*/
+typedef uint64_t OdEcWindow;
 
 #define OD_EC_WINDOW_SIZE ((int32_t)sizeof(OdEcWindow) * CHAR_BIT)
 
@@ -178,17 +179,11 @@ typedef struct OdEcEnc OdEcEnc;
 /*The entropy encoder context.*/
 struct OdEcEnc {
     /*Buffered output.
-        This contains only the raw bits until the final call to svt_od_ec_enc_done(),
-        where all the arithmetic-coded data gets prepended to it.*/
+        Bytes are written here in their final order; a carry out of the window
+        is propagated backwards into the bytes already written.*/
     uint8_t *buf;
     /*The size of the buffer.*/
     uint32_t storage;
-    /*The offset at which the last byte containing raw bits was written.*/
-
-    /*A buffer for output bytes with their associated carry flags.*/
-    uint16_t *precarry_buf;
-    /*The size of the pre-carry buffer.*/
-    uint32_t precarry_storage;
     /*The offset at which the next entropy-coded byte will be written.*/
     uint32_t offs;
     /*The low end of the current range.*/
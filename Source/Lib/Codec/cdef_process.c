@@ -348,6 +348,32 @@ static void cdef_seg_search(PictureControlSet *pcs, SequenceControlSet *scs, uin
     }
 }
 
+/* Select the unit info of the nearest reference in the same temporal layer as the starting point of the
+   restoration search. The reference must have stored its unit info for the same rest. unit layout. */
+static void set_rest_warm_start_info(PictureControlSet *pcs) {
+    PictureParentControlSet *ppcs = pcs->ppcs;
+    Av1Common               *cm   = ppcs->av1_cm;
+
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; ++plane) pcs->rest_warm_start_info[plane] = NULL;
+    if (!(cm->wn_filter_ctrls.enabled && cm->wn_filter_ctrls.warm_start) &&
+        !(cm->sg_filter_ctrls.enabled && cm->sg_filter_ctrls.warm_start))
+        return;
+    if (ppcs->slice_type == I_SLICE)
+        return;
+    for (uint8_t list = REF_LIST_0; list <= REF_LIST_1; ++list) {
+        const uint8_t ref_count = list == REF_LIST_0 ? ppcs->ref_list0_count : ppcs->ref_list1_count;
+        for (uint8_t ref_idx = 0; ref_idx < ref_count; ++ref_idx) {
+            EbReferenceObject *ref_obj = (EbReferenceObject *)pcs->ref_pic_ptr_array[list][ref_idx]->object_ptr;
+            if (ref_obj->tmp_layer_idx != pcs->temporal_layer_index)
+                continue;
+            for (int32_t plane = 0; plane < MAX_MB_PLANE; ++plane)
+                if (ref_obj->unit_info_count[plane] == pcs->rst_info[plane].units_per_tile)
+                    pcs->rest_warm_start_info[plane] = ref_obj->unit_info[plane];
+            return;
+        }
+    }
+}
+
 /******************************************************
  * CDEF Kernel
  ******************************************************/
@@ -462,6 +488,10 @@ void *svt_aom_cdef_kernel(void *input_ptr) {
             pcs->rest_extend_flag[0]                         = FALSE;
             pcs->rest_extend_flag[1]                         = FALSE;
             pcs->rest_extend_flag[2]                         = FALSE;
+            pcs->rest_unit_next[0]                           = 0;
+            pcs->rest_unit_next[1]                           = 0;
+            pcs->rest_unit_next[2]                           = 0;
+            set_rest_warm_start_info(pcs);
 
             uint32_t segment_index;
             for (segment_index = 0; segment_index < pcs->rest_segments_total_count; ++segment_index) {
@@ -26,6 +26,13 @@ extern "C" {
      *******************************************/
 void svt_aom_mode_decision_sb_light_pd0(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
                                         const MdcSbData *const mdcResultTbPtr);
+Bool svt_aom_light_pd0_depth_early_exit(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
+                                        uint32_t blk_idx_mds);
+void svt_aom_init_sb_light_pd0(PictureControlSet *pcs, ModeDecisionContext *ctx);
+void svt_aom_mode_decision_leaves_light_pd0(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
+                                            const MdcSbData *const mdc_sb_data, uint32_t leaf_start,
+                                            uint32_t leaf_end, uint32_t *next_non_skip_blk_idx_mds,
+                                            Bool *md_early_exit_sq);
 void svt_aom_mode_decision_sb_light_pd1(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
                                         const MdcSbData *const mdcResultTbPtr);
 void svt_aom_mode_decision_sb(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
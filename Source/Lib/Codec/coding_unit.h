@@ -162,8 +162,6 @@ typedef struct IntraBcContext {
     // [two buffers used ping-pong]
     uint32_t      *hash_value_buffer[2][2];
     uint8_t        is_exhaustive_allowed;
-    CRC_CALCULATOR crc_calculator1;
-    CRC_CALCULATOR crc_calculator2;
     // use approximate rate for inter cost (set at pic-level b/c some pic-level initializations will
     // be removed)
     uint8_t approx_inter_rate;
@@ -38,6 +38,7 @@
 #define HAS_AVX512BW EB_CPU_FLAGS_AVX512BW
 #define HAS_AVX512VL EB_CPU_FLAGS_AVX512VL
 #define HAS_NEON EB_CPU_FLAGS_NEON
+#define HAS_ARM_CRC32 EB_CPU_FLAGS_ARM_CRC32
 #define HAS_NEON_DOTPROD EB_CPU_FLAGS_NEON_DOTPROD
 #define HAS_SVE EB_CPU_FLAGS_SVE
 
@@ -49,6 +49,7 @@ void svt_aom_assert_err(uint32_t condition, char *err_msg);
 #define TPL_DEP_COST_SCALE_LOG2 4
 #define MAX_TX_WEIGHT 500
 #define MAX_TPL_LA_SW MAX_TPL_GROUP_SIZE // Max TPL look ahead sliding window size
+#define MAX_TPL_FRAMES_IN_FLIGHT 4 // Max TPL group pictures dispensed concurrently
 #define DEPTH_PROB_PRECISION 10000
 #define UPDATED_LINKS 100 //max number of pictures a dep-Cnt-cleanUp triggering picture can process
 #define MAX_TILE_CNTS 128 // Annex A.3
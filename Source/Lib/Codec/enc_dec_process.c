@@ -16,6 +16,8 @@
 #include "enc_dec_tasks.h"
 #include "enc_dec_results.h"
 #include "coding_loop.h"
+#include "full_loop.h"
+#include "md_early_term.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "utility.h"
 //To fix warning C4013: 'svt_convert_16bit_to_8bit' undefined; assuming extern returning int
@@ -36,6 +38,9 @@ static void enc_dec_context_dctor(EbPtr p) {
     EbThreadContext *thread_ctx = (EbThreadContext *)p;
     EncDecContext   *obj        = (EncDecContext *)thread_ctx->priv;
     EB_DELETE(obj->md_ctx);
+    EB_DELETE(obj->sub_sb_md_ctx);
+    EB_DESTROY_MUTEX(obj->sub_sb_job.mutex);
+    EB_DESTROY_SEMAPHORE(obj->sub_sb_job.done_semaphore);
     EB_DELETE(obj->residual_buffer);
     EB_DELETE(obj->transform_buffer);
     EB_DELETE(obj->inverse_quant_buffer);
@@ -118,6 +123,14 @@ EbErrorType svt_aom_enc_dec_context_ctor(EbThreadContext *thread_ctx, const EbEn
                .bot_padding        = 0,
                .split_mode         = FALSE,
            });
+    // DEFAULT is only used for 10bit inputs, so the 10bit MD buffers are always needed; the 8bit ones
+    // are only needed if the preset selects 8bit or dual MD for some pictures
+    uint8_t hbd_md = enable_hbd_mode_decision == DEFAULT ? EB_10_BIT_MD : enable_hbd_mode_decision;
+    if (enable_hbd_mode_decision == DEFAULT)
+        for (uint8_t is_base = 0; is_base < 2; is_base++)
+            for (uint8_t is_islice = 0; is_islice < 2; is_islice++)
+                if (svt_aom_get_hbd_md(static_config->enc_mode, is_base, is_islice) != EB_10_BIT_MD)
+                    hbd_md = EB_DUAL_BIT_MD;
     // Mode Decision Context
     EB_NEW(ed_ctx->md_ctx,
            svt_aom_mode_decision_context_ctor,
@@ -128,15 +141,34 @@ EbErrorType svt_aom_enc_dec_context_ctor(EbThreadContext *thread_ctx, const EbEn
            static_config->encoder_bit_depth,
            0,
            0,
-           enable_hbd_mode_decision == DEFAULT ? 2 : enable_hbd_mode_decision,
-           static_config->screen_content_mode,
+           hbd_md,
            enc_handle_ptr->scs_instance_array[0]->scs->seq_qp_mod);
+    if (index == 0)
+        SVT_DEBUG("Mode decision context: %.2f MB per EncDec thread\n",
+                  (double)svt_aom_mode_decision_context_footprint(ed_ctx->md_ctx) / (1 << 20));
 
     if (enable_hbd_mode_decision)
         ed_ctx->md_ctx->input_sample16bit_buffer = ed_ctx->input_sample16bit_buffer;
 
     ed_ctx->md_ctx->ed_ctx = ed_ctx;
 
+    if (enc_handle_ptr->scs_instance_array[0]->scs->sub_sb_parallel_md) {
+        EB_NEW(ed_ctx->sub_sb_md_ctx,
+               svt_aom_mode_decision_context_ctor,
+               color_format,
+               enc_handle_ptr->scs_instance_array[0]->scs->super_block_size,
+               static_config->enc_mode,
+               enc_handle_ptr->scs_instance_array[0]->scs->max_block_cnt,
+               static_config->encoder_bit_depth,
+               0,
+               0,
+               hbd_md,
+               enc_handle_ptr->scs_instance_array[0]->scs->seq_qp_mod);
+        ed_ctx->sub_sb_md_ctx->ed_ctx = ed_ctx;
+        EB_CREATE_MUTEX(ed_ctx->sub_sb_job.mutex);
+        EB_CREATE_SEMAPHORE(ed_ctx->sub_sb_job.done_semaphore, 0, 1);
+    }
+
     return EB_ErrorNone;
 }
 
@@ -311,6 +343,15 @@ static Bool assign_enc_dec_segments(EncDecSegments *segmentPtr, uint16_t *segmen
 
         break;
 
+    case ENCDEC_TASKS_WAVEFRONT_RESUME:
+
+        // Resume the segment that was waiting on the reference rows
+        *segmentInOutIndex       = taskPtr->wavefront_segment_index;
+        taskPtr->input_type      = ENCDEC_TASKS_CONTINUE;
+        continue_processing_flag = TRUE;
+
+        break;
+
     case ENCDEC_TASKS_CONTINUE:
 
         // Update the Dependency List for Right and Bottom Neighbors
@@ -1601,6 +1642,16 @@ EbErrorType psnr_calculations(PictureControlSet *pcs, SequenceControlSet *scs, B
     return EB_ErrorNone;
 }
 
+// Copy the luma of a PA pyramid level to the GM reference info of the picture
+static void copy_gm_ref_level(EbPictureBufferDesc *src, EbPictureBufferDesc *dst) {
+    const uint16_t width  = MIN(src->width, dst->width);
+    const uint16_t height = MIN(src->height, dst->height);
+    uint8_t       *s      = src->buffer_y + src->org_x + src->org_y * src->stride_y;
+    uint8_t       *d      = dst->buffer_y + dst->org_x + dst->org_y * dst->stride_y;
+    for (uint16_t j = 0; j < height; j++) svt_memcpy(d + j * dst->stride_y, s + j * src->stride_y, width);
+    svt_aom_generate_padding(dst->buffer_y, dst->stride_y, dst->width, dst->height, dst->org_x, dst->org_y);
+}
+
 void pad_ref_and_set_flags(PictureControlSet *pcs, SequenceControlSet *scs) {
     EbReferenceObject *ref_object = (EbReferenceObject *)pcs->ppcs->ref_pic_wrapper->object_ptr;
 
@@ -1784,16 +1835,13 @@ void pad_ref_and_set_flags(PictureControlSet *pcs, SequenceControlSet *scs) {
             for (int j = 0; j < inp->max_height; j++)
                 memcpy(dst + j * ref->stride_y, src + j * inp->stride_y, inp->max_width);
         }
-        if (gm_need_quart) {
-            EbPictureBufferDesc *ref = ref_object->quarter_reference_picture;
-            svt_aom_assert_err(pcs->ppcs->quarter_src_pic->luma_size == ref->luma_size, "ERR BUF");
-            memcpy(ref->buffer_y, pcs->ppcs->quarter_src_pic->buffer_y, ref->luma_size);
-        }
-        if (gm_need_sixteen) {
-            EbPictureBufferDesc *ref = ref_object->sixteenth_reference_picture;
-            svt_aom_assert_err(pcs->ppcs->sixteenth_src_pic->luma_size == ref->luma_size, "ERR BUF");
-            memcpy(ref->buffer_y, pcs->ppcs->sixteenth_src_pic->buffer_y, ref->luma_size);
-        }
+        // The downsampled levels come from the PA pyramid of the picture, which is still held until
+        // packetization
+        EbPaReferenceObject *pa_ref_obj = (EbPaReferenceObject *)pcs->ppcs->pa_ref_pic_wrapper->object_ptr;
+        if (gm_need_quart)
+            copy_gm_ref_level(pa_ref_obj->quarter_downsampled_picture_ptr, ref_object->quarter_reference_picture);
+        if (gm_need_sixteen)
+            copy_gm_ref_level(pa_ref_obj->sixteenth_downsampled_picture_ptr, ref_object->sixteenth_reference_picture);
     }
 }
 /*
@@ -2675,6 +2723,10 @@ static void perform_pred_depth_refinement(SequenceControlSet *scs, PictureContro
                             }
                         }
 
+                        // Learned early termination of the sub-depth(s)
+                        if (e_depth != 0 && add_sub_depth && ctx->avail_blk_flag[blk_index] && blk_geom->sq_size > 4)
+                            add_sub_depth = !svt_aom_etm_prune_sub_depth(pcs, ctx, blk_index);
+
                         if (e_depth || s_depth)
                             pred_depth_only = 0;
 
@@ -3058,6 +3110,365 @@ static void lpd1_detector_skip_pd0(PictureControlSet *pcs, ModeDecisionContext *
     }
 }
 
+/*
+ * Cross-picture wavefront: extend one range of rows of an 8-bit reference plane with the same
+ * padding svt_aom_pad_picture_to_multiple_of_min_blk_size_dimensions() and
+ * svt_aom_generate_padding() apply to the whole plane.
+ */
+static void pad_ref_plane_rows(uint8_t *buf, uint32_t stride, uint32_t width, uint32_t height, uint32_t org_x,
+                               uint32_t org_y, uint32_t pad_right, uint32_t pad_bottom, uint32_t row_start,
+                               uint32_t row_end) {
+    const uint32_t src_width  = width - pad_right;
+    const uint32_t src_height = height - pad_bottom;
+    uint8_t       *pic        = buf + org_x + org_y * stride;
+
+    for (uint32_t row = row_start; row < row_end; row++) {
+        uint8_t *line = pic + row * stride;
+        if (row >= src_height)
+            svt_memcpy(line, pic + (src_height - 1) * stride, width);
+        else if (pad_right)
+            EB_MEMSET(line + src_width, line[src_width - 1], pad_right);
+        EB_MEMSET(line - org_x, line[0], org_x);
+        EB_MEMSET(line + width, line[width - 1], org_x);
+    }
+    if (row_start == 0)
+        for (uint32_t i = 1; i <= org_y; i++) svt_memcpy(buf + (org_y - i) * stride, buf + org_y * stride, stride);
+    if (row_end == height)
+        for (uint32_t i = 1; i <= org_y; i++)
+            svt_memcpy(buf + (org_y + height - 1 + i) * stride, buf + (org_y + height - 1) * stride, stride);
+}
+
+static void pad_ref_rows(SequenceControlSet *scs, EbPictureBufferDesc *ref_pic, uint32_t row_start,
+                         uint32_t row_end) {
+    const uint32_t color_format = ref_pic->color_format;
+    const uint16_t ss_x         = (color_format == EB_YUV444 ? 1 : 2) - 1;
+    const uint16_t ss_y         = (color_format >= EB_YUV422 ? 1 : 2) - 1;
+    const uint32_t row_end_uv   = row_end == ref_pic->height ? (uint32_t)(ref_pic->height + ss_y) >> ss_y
+                                                             : row_end >> ss_y;
+
+    pad_ref_plane_rows(ref_pic->buffer_y,
+                       ref_pic->stride_y,
+                       ref_pic->width,
+                       ref_pic->height,
+                       ref_pic->org_x,
+                       ref_pic->org_y,
+                       scs->pad_right,
+                       scs->pad_bottom,
+                       row_start,
+                       row_end);
+    pad_ref_plane_rows(ref_pic->buffer_cb,
+                       ref_pic->stride_cb,
+                       (ref_pic->width + ss_x) >> ss_x,
+                       (ref_pic->height + ss_y) >> ss_y,
+                       (ref_pic->org_x + ss_x) >> ss_x,
+                       (ref_pic->org_y + ss_y) >> ss_y,
+                       scs->pad_right >> ss_x,
+                       scs->pad_bottom >> ss_y,
+                       row_start >> ss_y,
+                       row_end_uv);
+    pad_ref_plane_rows(ref_pic->buffer_cr,
+                       ref_pic->stride_cr,
+                       (ref_pic->width + ss_x) >> ss_x,
+                       (ref_pic->height + ss_y) >> ss_y,
+                       (ref_pic->org_x + ss_x) >> ss_x,
+                       (ref_pic->org_y + ss_y) >> ss_y,
+                       scs->pad_right >> ss_x,
+                       scs->pad_bottom >> ss_y,
+                       row_start >> ss_y,
+                       row_end_uv);
+}
+
+/*
+ * Cross-picture wavefront: account for one coded SB of a reference picture. An SB row is final once
+ * the row below it is coded (its deblocking reaches into the row above), so the final rows are
+ * padded, their SB statistics copied to the reference object, and the EncDec tasks parked on the
+ * reference are posted again.
+ */
+static void publish_wavefront_progress(SequenceControlSet *scs, PictureControlSet *pcs, uint32_t sb_index,
+                                       uint32_t pic_width_in_sb) {
+    PictureParentControlSet *ppcs        = pcs->ppcs;
+    EbReferenceObject       *obj         = (EbReferenceObject *)ppcs->ref_pic_wrapper->object_ptr;
+    const uint32_t           sb_row      = sb_index / pic_width_in_sb;
+    const uint32_t           sb_rows     = (ppcs->aligned_height + 63) >> 6;
+    EbObjectWrapper         *waiters     = NULL;
+    EbPictureBufferDesc     *ref_pic     = obj->reference_picture;
+    uint32_t                 rows_final;
+
+    obj->sb_intra[sb_index]     = pcs->sb_intra[sb_index];
+    obj->sb_skip[sb_index]      = pcs->sb_skip[sb_index];
+    obj->sb_64x64_mvp[sb_index] = pcs->sb_64x64_mvp[sb_index];
+
+    svt_block_on_mutex(obj->wavefront_mutex);
+    obj->wavefront_row_sb_done[sb_row]++;
+    while (obj->wavefront_rows_coded < sb_rows &&
+           obj->wavefront_row_sb_done[obj->wavefront_rows_coded] == pic_width_in_sb)
+        obj->wavefront_rows_coded++;
+    if (obj->wavefront_rows_coded == sb_rows)
+        rows_final = sb_rows;
+    else
+        rows_final = obj->wavefront_rows_coded ? obj->wavefront_rows_coded - 1u : 0;
+    if (rows_final > obj->wavefront_rows_ready) {
+        if (obj->wavefront_rows_ready == 0) {
+            // The deblocking levels of the references are read at the start of the dependent pictures
+            struct LoopFilter *const lf = &ppcs->frm_hdr.loop_filter_params;
+            obj->filter_level[0]        = lf->filter_level[0];
+            obj->filter_level[1]        = lf->filter_level[1];
+            obj->filter_level_u         = lf->filter_level_u;
+            obj->filter_level_v         = lf->filter_level_v;
+        }
+        pad_ref_rows(scs,
+                     ref_pic,
+                     obj->wavefront_rows_ready << 6,
+                     MIN(rows_final << 6, ref_pic->height));
+        obj->wavefront_rows_ready = (uint16_t)rows_final;
+        waiters                   = obj->wavefront_waiters;
+        obj->wavefront_waiters    = NULL;
+    }
+    svt_release_mutex(obj->wavefront_mutex);
+
+    while (waiters) {
+        EncDecTasks     *task = (EncDecTasks *)waiters->object_ptr;
+        EbObjectWrapper *next = task->wavefront_next;
+        task->input_type      = ENCDEC_TASKS_WAVEFRONT_RESUME;
+        svt_post_full_object(waiters);
+        waiters = next;
+    }
+}
+
+/*
+ * Cross-picture wavefront: check that the references hold the rows the segment may reference (its
+ * last SB row plus the configured margin). If not, the task is parked on the first reference
+ * missing rows and TRUE is returned; the task is posted again when that reference progresses.
+ */
+static Bool park_on_wavefront_refs(PictureControlSet *pcs, EncDecSegments *segments_ptr, uint16_t segment_index,
+                                   EbObjectWrapper *task_wrapper) {
+    PictureParentControlSet *ppcs = pcs->ppcs;
+    if (ppcs->slice_type == I_SLICE)
+        return FALSE;
+    const uint32_t segment_row = segment_index / segments_ptr->segment_band_count;
+    const uint32_t last_row    = ((segment_row + 1) * segments_ptr->sb_row_count + segments_ptr->segment_row_count -
+                               1) / segments_ptr->segment_row_count - 1;
+    const uint32_t rows_needed = MIN(last_row + 1 + pcs->scs->cross_pic_wavefront, segments_ptr->sb_row_count);
+
+    for (uint8_t list = REF_LIST_0; list <= REF_LIST_1; list++) {
+        const uint8_t ref_count = list == REF_LIST_0 ? ppcs->ref_list0_count : ppcs->ref_list1_count;
+        for (uint8_t ref_idx = 0; ref_idx < ref_count; ref_idx++) {
+            EbReferenceObject *obj = (EbReferenceObject *)pcs->ref_pic_ptr_array[list][ref_idx]->object_ptr;
+            svt_block_on_mutex(obj->wavefront_mutex);
+            if (obj->wavefront_rows_ready < rows_needed) {
+                EncDecTasks *task             = (EncDecTasks *)task_wrapper->object_ptr;
+                task->wavefront_segment_index = segment_index;
+                task->wavefront_next          = obj->wavefront_waiters;
+                obj->wavefront_waiters        = task_wrapper;
+                svt_release_mutex(obj->wavefront_mutex);
+                return TRUE;
+            }
+            svt_release_mutex(obj->wavefront_mutex);
+        }
+    }
+    return FALSE;
+}
+
+/*
+ * Copy the light-PD0 results of the tested blocks in [mds_start, mds_end) from src to dst. Light-PD0
+ * only tests square blocks. The buffers owned by the dst blocks are kept.
+ */
+static void copy_light_pd0_blocks(ModeDecisionContext *dst, const ModeDecisionContext *src,
+                                  const MdcSbData *mdc_sb_data, uint32_t mds_start, uint32_t mds_end) {
+    for (uint32_t blk_idx = 0; blk_idx < mdc_sb_data->leaf_count; blk_idx++) {
+        const uint32_t mds = mdc_sb_data->leaf_data_array[blk_idx].mds_idx;
+        if (mds < mds_start || mds >= mds_end)
+            continue;
+        BlkStruct *dst_blk = &dst->md_blk_arr_nsq[mds];
+        BlkStruct  blk     = src->md_blk_arr_nsq[mds];
+        blk.av1xd          = dst_blk->av1xd;
+        for (int plane = 0; plane < 3; plane++) {
+            blk.neigh_left_recon[plane]       = dst_blk->neigh_left_recon[plane];
+            blk.neigh_top_recon[plane]        = dst_blk->neigh_top_recon[plane];
+            blk.neigh_left_recon_16bit[plane] = dst_blk->neigh_left_recon_16bit[plane];
+            blk.neigh_top_recon_16bit[plane]  = dst_blk->neigh_top_recon_16bit[plane];
+        }
+        blk.coeff_tmp             = dst_blk->coeff_tmp;
+        blk.recon_tmp             = dst_blk->recon_tmp;
+        blk.palette_info          = dst_blk->palette_info;
+        blk.palette_mem           = dst_blk->palette_mem;
+        *dst_blk                  = blk;
+        dst->avail_blk_flag[mds] = src->avail_blk_flag[mds];
+        dst->cost_avail[mds]     = src->cost_avail[mds];
+    }
+}
+
+/*
+ * Sub-SB parallel MD: search one PD0 quadrant of the job in ctx. The SB level configuration of the
+ * owner is replayed, and only the root blocks of the SB are visible, so the result does not depend
+ * on the thread searching the quadrant. The quadrant is then merged into the owner context.
+ */
+static void search_sub_sb_quadrant(SubSbMdJob *job, ModeDecisionContext *ctx, uint8_t quadrant) {
+    PictureControlSet         *pcs   = job->pcs;
+    SequenceControlSet        *scs   = pcs->scs;
+    const ModeDecisionContext *owner = job->owner_ctx;
+
+    ctx->encoder_bit_depth           = owner->encoder_bit_depth;
+    ctx->corrupted_mv_check          = owner->corrupted_mv_check;
+    ctx->hbd_md                      = owner->hbd_md;
+    ctx->md_rate_est_ctx             = owner->md_rate_est_ctx;
+    ctx->bypass_encdec               = owner->bypass_encdec;
+    ctx->rtc_use_N4_dct_dct_shortcut = owner->rtc_use_N4_dct_dct_shortcut;
+    ctx->tile_index                  = owner->tile_index;
+    ctx->sb_index                    = owner->sb_index;
+    ctx->sb_ptr                      = owner->sb_ptr;
+    ctx->sb_origin_x                 = owner->sb_origin_x;
+    ctx->sb_origin_y                 = owner->sb_origin_y;
+    ctx->wavefront_mv_row_limit      = owner->wavefront_mv_row_limit;
+    ctx->static_sb                   = owner->static_sb;
+    svt_aom_mode_decision_configure_sb(ctx, pcs, ctx->sb_ptr->qindex, owner->me_q_index);
+    svt_aom_sig_deriv_enc_dec_common(scs, pcs, ctx);
+    ctx->lpd0_ctrls         = owner->lpd0_ctrls;
+    ctx->lpd1_ctrls         = owner->lpd1_ctrls;
+    ctx->is_subres_safe     = owner->is_subres_safe;
+    ctx->need_hbd_comp_mds3 = 0;
+    ctx->pd_pass            = PD_PASS_0;
+    ctx->fixed_partition    = false;
+    svt_aom_sig_deriv_enc_dec_light_pd0(scs, pcs, ctx);
+
+    memset(ctx->avail_blk_flag, FALSE, sizeof(uint8_t) * scs->max_block_cnt);
+    memset(ctx->cost_avail, FALSE, sizeof(uint8_t) * scs->max_block_cnt);
+    copy_light_pd0_blocks(ctx, owner, job->mdc_sb_data, 0, job->root_mds_end);
+
+    Bool     md_early_exit_sq          = 0;
+    uint32_t next_non_skip_blk_idx_mds = 0;
+    svt_aom_init_sb_light_pd0(pcs, ctx);
+    svt_aom_mode_decision_leaves_light_pd0(scs,
+                                           pcs,
+                                           ctx,
+                                           job->mdc_sb_data,
+                                           job->leaf_start[quadrant],
+                                           job->leaf_end[quadrant],
+                                           &next_non_skip_blk_idx_mds,
+                                           &md_early_exit_sq);
+    copy_light_pd0_blocks(
+        job->owner_ctx, ctx, job->mdc_sb_data, job->mds_start[quadrant], job->mds_end[quadrant]);
+}
+
+/*
+ * Sub-SB parallel MD: search the quadrants of the job until none is left to claim. The last
+ * quadrant to complete wakes up the owner.
+ */
+static void search_sub_sb_quadrants(SubSbMdJob *job, ModeDecisionContext *ctx) {
+    for (;;) {
+        svt_block_on_mutex(job->mutex);
+        if (job->next_quadrant == job->quadrant_count) {
+            svt_release_mutex(job->mutex);
+            return;
+        }
+        const uint8_t quadrant = job->next_quadrant++;
+        svt_release_mutex(job->mutex);
+
+        search_sub_sb_quadrant(job, ctx, quadrant);
+
+        svt_block_on_mutex(job->mutex);
+        const Bool last_quadrant = ++job->done_count == job->quadrant_count;
+        svt_release_mutex(job->mutex);
+        if (last_quadrant)
+            svt_post_semaphore(job->done_semaphore);
+    }
+}
+
+/*
+ * Light-PD0 of an SB with sub-SB parallel MD. The root blocks are searched first; unless the split
+ * is pruned by the root cost, the 32x32 quadrants are then shared with the idle EncDec threads and
+ * searched without the costs of their siblings. The root split decision is taken once all the
+ * quadrants are merged.
+ */
+static void mode_decision_sb_light_pd0_sub_sb(SequenceControlSet *scs, PictureControlSet *pcs,
+                                              EncDecContext *ed_ctx, EbObjectWrapper *pcs_wrapper,
+                                              const MdcSbData *const mdc_sb_data) {
+    ModeDecisionContext       *ctx             = ed_ctx->md_ctx;
+    SubSbMdJob                *job             = &ed_ctx->sub_sb_job;
+    const EbMdcLeafData *const leaf_data_array = mdc_sb_data->leaf_data_array;
+    const uint32_t             leaf_count      = mdc_sb_data->leaf_count;
+
+    uint32_t mds_start[4], mds_end[4], leaf_start[4], leaf_end[4];
+    uint32_t leaf_idx = 0;
+    mds_start[0]      = get_blk_geom_mds(0)->d1_depth_offset;
+    while (leaf_idx < leaf_count && leaf_data_array[leaf_idx].mds_idx < mds_start[0]) leaf_idx++;
+    const uint32_t root_leaf_count = leaf_idx;
+    for (int q = 0; q < 4; q++) {
+        if (q)
+            mds_start[q] = mds_end[q - 1];
+        mds_end[q]   = mds_start[q] + get_blk_geom_mds(mds_start[q])->ns_depth_offset;
+        leaf_start[q] = leaf_idx;
+        while (leaf_idx < leaf_count && leaf_data_array[leaf_idx].mds_idx < mds_end[q]) leaf_idx++;
+        leaf_end[q] = leaf_idx;
+    }
+
+    Bool     md_early_exit_sq          = 0;
+    uint32_t next_non_skip_blk_idx_mds = 0;
+    svt_aom_init_sb_light_pd0(pcs, ctx);
+    svt_aom_mode_decision_leaves_light_pd0(
+        scs, pcs, ctx, mdc_sb_data, 0, root_leaf_count, &next_non_skip_blk_idx_mds, &md_early_exit_sq);
+    // Search the rest sequentially when there is a single depth, or when the root cost prunes the split
+    if (!root_leaf_count || root_leaf_count == leaf_count ||
+        svt_aom_light_pd0_depth_early_exit(scs, pcs, ctx, leaf_data_array[root_leaf_count].mds_idx)) {
+        svt_aom_mode_decision_leaves_light_pd0(scs,
+                                               pcs,
+                                               ctx,
+                                               mdc_sb_data,
+                                               root_leaf_count,
+                                               leaf_count,
+                                               &next_non_skip_blk_idx_mds,
+                                               &md_early_exit_sq);
+        return;
+    }
+
+    svt_block_on_mutex(job->mutex);
+    job->pcs            = pcs;
+    job->owner_ctx      = ctx;
+    job->mdc_sb_data    = mdc_sb_data;
+    job->quadrant_count = 0;
+    for (int q = 0; q < 4; q++) {
+        if (leaf_start[q] == leaf_end[q])
+            continue;
+        job->leaf_start[job->quadrant_count] = leaf_start[q];
+        job->leaf_end[job->quadrant_count]   = leaf_end[q];
+        job->mds_start[job->quadrant_count]  = mds_start[q];
+        job->mds_end[job->quadrant_count]    = mds_end[q];
+        job->quadrant_count++;
+    }
+    job->root_mds_end        = mds_start[0];
+    job->next_quadrant       = 0;
+    job->done_count          = 0;
+    const uint8_t task_count = (uint8_t)MAX(job->quadrant_count - 1 - job->pending_tasks, 0);
+    job->pending_tasks += task_count;
+    svt_release_mutex(job->mutex);
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        EbObjectWrapper *enc_dec_tasks_wrapper;
+        svt_get_empty_object(ed_ctx->enc_dec_feedback_fifo_ptr, &enc_dec_tasks_wrapper);
+        EncDecTasks *enc_dec_tasks      = (EncDecTasks *)enc_dec_tasks_wrapper->object_ptr;
+        enc_dec_tasks->pcs_wrapper      = pcs_wrapper;
+        enc_dec_tasks->input_type       = ENCDEC_TASKS_SUB_SB_INPUT;
+        enc_dec_tasks->tile_group_index = ed_ctx->tile_group_index;
+        enc_dec_tasks->sub_sb_job       = job;
+        svt_post_full_object(enc_dec_tasks_wrapper);
+    }
+    search_sub_sb_quadrants(job, ed_ctx->sub_sb_md_ctx);
+    svt_block_on_semaphore(job->done_semaphore);
+
+    // Root split decision, reached when the last searched block closes all the depths of the SB
+    const uint32_t   last_mds = leaf_data_array[leaf_count - 1].mds_idx;
+    const BlockGeom *blk_geom = get_blk_geom_mds(last_mds);
+    uint32_t         blk_mds  = last_mds;
+    while (blk_geom->is_last_quadrant && blk_geom->parent_depth_idx_mds != 0) {
+        blk_mds  = blk_geom->parent_depth_idx_mds;
+        blk_geom = get_blk_geom_mds(blk_mds);
+    }
+    if (!mdc_sb_data->split_flag[leaf_count - 1] && blk_geom->is_last_quadrant)
+        svt_aom_d2_parent_depth_decision(pcs, ctx, blk_mds);
+    ctx->blk_geom = get_blk_geom_mds(last_mds);
+    ctx->blk_ptr  = &ctx->md_blk_arr_nsq[last_mds];
+}
+
 /* Light-PD0 classifier. */
 static void lpd0_detector(PictureControlSet *pcs, ModeDecisionContext *md_ctx, uint32_t pic_width_in_sb) {
     Lpd0Ctrls *lpd0_ctrls = &md_ctx->lpd0_ctrls;
@@ -3240,12 +3651,34 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
         SequenceControlSet             *scs           = pcs->scs;
         ModeDecisionContext            *md_ctx        = ed_ctx->md_ctx;
         struct PictureParentControlSet *ppcs          = pcs->ppcs;
+        if (enc_dec_tasks->input_type == ENCDEC_TASKS_HASH_INPUT) {
+            svt_av1_generate_block_hash_band(&pcs->hash_level, (uint16_t)enc_dec_tasks->enc_dec_segment_row);
+            svt_block_on_mutex(pcs->hash_mutex);
+            Bool last_band = ++pcs->hash_bands_done == pcs->hash_level.band_count;
+            svt_release_mutex(pcs->hash_mutex);
+            if (last_band)
+                svt_post_semaphore(pcs->hash_done_semaphore);
+            svt_release_object(enc_dec_tasks_wrapper);
+            continue;
+        }
+        if (enc_dec_tasks->input_type == ENCDEC_TASKS_SUB_SB_INPUT) {
+            SubSbMdJob *job = enc_dec_tasks->sub_sb_job;
+            svt_block_on_mutex(job->mutex);
+            job->pending_tasks--;
+            svt_release_mutex(job->mutex);
+            search_sub_sb_quadrants(job, ed_ctx->sub_sb_md_ctx);
+            svt_release_object(enc_dec_tasks_wrapper);
+            continue;
+        }
         md_ctx->encoder_bit_depth                     = (uint8_t)scs->static_config.encoder_bit_depth;
         md_ctx->corrupted_mv_check                    = (pcs->ppcs->aligned_width >= (1 << (MV_IN_USE_BITS - 3))) ||
             (pcs->ppcs->aligned_height >= (1 << (MV_IN_USE_BITS - 3)));
         ed_ctx->tile_group_index = enc_dec_tasks->tile_group_index;
         ed_ctx->coded_sb_count   = 0;
         segments_ptr             = pcs->enc_dec_segment_ctrl[ed_ctx->tile_group_index];
+        // Set when the task is parked on its references (cross-picture wavefront), in which case it
+        // is posted again by the reference EncDec instead of being released
+        Bool wavefront_parked = FALSE;
         // SB Constants
         uint8_t  sb_size                = (uint8_t)scs->sb_size;
         uint8_t  sb_size_log2           = (uint8_t)svt_log2f(sb_size);
@@ -3313,6 +3746,11 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
             // Segment-loop
             while (assign_enc_dec_segments(
                        segments_ptr, &segment_index, enc_dec_tasks, ed_ctx->enc_dec_feedback_fifo_ptr) == TRUE) {
+                if (scs->cross_pic_wavefront &&
+                    park_on_wavefront_refs(pcs, segments_ptr, segment_index, enc_dec_tasks_wrapper)) {
+                    wavefront_parked = TRUE;
+                    break;
+                }
                 x_sb_start_index = segments_ptr->x_start_array[segment_index];
                 y_sb_start_index = segments_ptr->y_start_array[segment_index];
                 sb_start_index   = y_sb_start_index * tile_group_width_in_sb + x_sb_start_index;
@@ -3359,6 +3797,13 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
                         ed_ctx->md_ctx->tile_index  = sb_ptr->tile_info.tile_rs_index;
                         ed_ctx->md_ctx->sb_origin_x = sb_origin_x;
                         ed_ctx->md_ctx->sb_origin_y = sb_origin_y;
+                        // Reference rows the SB may reference under the cross-picture wavefront
+                        const uint32_t wavefront_rows = (sb_origin_y >> 6) + 1 + scs->cross_pic_wavefront;
+                        md_ctx->wavefront_mv_row_limit = scs->cross_pic_wavefront && pcs->slice_type != I_SLICE &&
+                                wavefront_rows < segments_ptr->sb_row_count
+                            ? (int32_t)(wavefront_rows << 6) - WAVEFRONT_MV_MARGIN
+                            : WAVEFRONT_NO_ROW_LIMIT;
+                        md_ctx->static_sb = ppcs->static_sb_skip && ppcs->b64_static[sb_index];
                         mdc_ptr                     = &(ed_ctx->md_ctx->mdc_sb_array);
                         ed_ctx->sb_index            = sb_index;
                         if (pcs->cdf_ctrl.enabled) {
@@ -3422,11 +3867,23 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
                             svt_aom_get_me_qindex(pcs, sb_ptr, scs->seq_header.sb_size == BLOCK_128X128));
                         // signals set once per SB (i.e. not per PD)
                         svt_aom_sig_deriv_enc_dec_common(scs, pcs, ed_ctx->md_ctx);
+                        // Static SBs are coded as a single 64x64 block, so PD0 is skipped
+                        if (md_ctx->static_sb) {
+                            md_ctx->depth_removal_ctrls.enabled              = 1;
+                            md_ctx->depth_removal_ctrls.disallow_below_64x64 = 1;
+                        }
 
-                        if (pcs->ppcs->palette_level)
+                        if (pcs->ppcs->palette_level) {
+                            // The palette search buffers are allocated by the first picture using palette
+                            if (!ed_ctx->md_ctx->palette_buffer)
+                                svt_aom_md_rtime_alloc_palette_buffers(ed_ctx->md_ctx);
                             // Status of palette info alloc
                             for (int i = 0; i < scs->max_block_cnt; ++i)
                                 ed_ctx->md_ctx->md_blk_arr_nsq[i].palette_mem = 0;
+                        }
+                        // The MD early termination samples are allocated by the first SB when dumping features
+                        if (scs->enc_ctx->etm_dump_file && !md_ctx->etm_samples)
+                            svt_aom_md_rtime_alloc_etm_samples(md_ctx);
 
                         // Initialize is_subres_safe
                         ed_ctx->md_ctx->is_subres_safe = (uint8_t)~0;
@@ -3471,7 +3928,14 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
 
                                 // Build the t=0 cand_block_array
                                 build_cand_block_array(scs, pcs, md_ctx, true);
-                                svt_aom_mode_decision_sb_light_pd0(scs, pcs, ed_ctx->md_ctx, mdc_ptr);
+                                // The quadrants are searched independently only when no neighbour
+                                // (intra) information is used
+                                if (scs->sub_sb_parallel_md && md_ctx->skip_intra && !md_ctx->hbd_md &&
+                                    scs->super_block_size == 64 && pcs->ppcs->sb_geom[sb_index].is_complete_sb)
+                                    mode_decision_sb_light_pd0_sub_sb(
+                                        scs, pcs, ed_ctx, enc_dec_tasks->pcs_wrapper, mdc_ptr);
+                                else
+                                    svt_aom_mode_decision_sb_light_pd0(scs, pcs, ed_ctx->md_ctx, mdc_ptr);
                                 // Re-build mdc_blk_ptr for the 2nd PD Pass [PD_PASS_1]
                                 // Reset neighnor information to current SB @ position (0,0)
                                 if (!ed_ctx->md_ctx->skip_intra)
@@ -3535,6 +3999,8 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
                             svt_aom_sig_deriv_enc_dec_light_pd1(pcs, ed_ctx->md_ctx);
                         else
                             svt_aom_sig_deriv_enc_dec(scs, pcs, ed_ctx->md_ctx);
+                        if (md_ctx->static_sb)
+                            svt_aom_sig_deriv_enc_dec_static_sb(pcs, ed_ctx->md_ctx);
                         // If there is only one depth and no NSQ search at PD1, then the partition structure
                         // is fixed.
                         md_ctx->fixed_partition = md_ctx->pred_depth_only && md_ctx->md_disallow_nsq_search;
@@ -3550,6 +4016,8 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
                             svt_aom_mode_decision_sb_light_pd1(scs, pcs, ed_ctx->md_ctx, mdc_ptr);
                         else
                             svt_aom_mode_decision_sb(scs, pcs, ed_ctx->md_ctx, mdc_ptr);
+                        if (md_ctx->etm_sample_count)
+                            svt_aom_etm_dump_samples(pcs, md_ctx);
                         // if (/*ppcs->is_ref &&*/ md_ctx->hbd_md == 0 &&
                         // scs->static_config.encoder_bit_depth > EB_EIGHT_BIT)
                         //     md_ctx->bypass_encdec = 0;
@@ -3558,6 +4026,8 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
                             svt_aom_encode_decode(scs, pcs, sb_ptr, sb_index, sb_origin_x, sb_origin_y, ed_ctx);
                         }
                         svt_aom_encdec_update(scs, pcs, sb_ptr, sb_index, sb_origin_x, sb_origin_y, ed_ctx);
+                        if (scs->cross_pic_wavefront && ppcs->is_ref)
+                            publish_wavefront_progress(scs, pcs, sb_index, pic_width_in_sb);
 
                         ed_ctx->coded_sb_count++;
                     }
@@ -3661,7 +4131,8 @@ void *svt_aom_mode_decision_kernel(void *input_ptr) {
             }
         }
         // Release Mode Decision Results
-        svt_release_object(enc_dec_tasks_wrapper);
+        if (!wavefront_parked)
+            svt_release_object(enc_dec_tasks_wrapper);
     }
     return NULL;
 }
@@ -28,6 +28,27 @@
 extern "C" {
 #endif
 
+/**************************************
+ * Sub-SB parallel MD job: the PD0 quadrants of the SB being coded by
+ * an EncDec thread, searched by any EncDec thread that claims them
+ **************************************/
+typedef struct SubSbMdJob {
+    EbHandle                  mutex;
+    EbHandle                  done_semaphore;
+    struct PictureControlSet *pcs;
+    ModeDecisionContext      *owner_ctx; // receives the quadrant results
+    const MdcSbData          *mdc_sb_data;
+    uint32_t                  root_mds_end; // end of the blocks above the quadrants
+    uint32_t                  leaf_start[4];
+    uint32_t                  leaf_end[4];
+    uint32_t                  mds_start[4];
+    uint32_t                  mds_end[4];
+    uint8_t                   quadrant_count;
+    uint8_t                   next_quadrant;
+    uint8_t                   done_count;
+    uint8_t                   pending_tasks; // posted to the other threads, not yet picked up
+} SubSbMdJob;
+
 /**************************************
      * Enc Dec Context
      **************************************/
@@ -37,6 +58,9 @@ typedef struct EncDecContext {
     EbFifo              *enc_dec_feedback_fifo_ptr;
     EbFifo              *picture_demux_output_fifo_ptr; // to picture-manager
     ModeDecisionContext *md_ctx;
+    // Sub-SB parallel MD: context the claimed quadrants are searched in, and job of the SBs coded by this thread
+    ModeDecisionContext *sub_sb_md_ctx;
+    SubSbMdJob           sub_sb_job;
     const BlockGeom     *blk_geom;
     // Coding Unit Workspace---------------------------
     EbPictureBufferDesc *residual_buffer;
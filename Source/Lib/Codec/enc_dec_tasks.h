@@ -22,6 +22,9 @@ extern "C" {
 #define ENCDEC_TASKS_ENCDEC_INPUT 1
 #define ENCDEC_TASKS_CONTINUE 2
 #define ENCDEC_TASKS_SUPERRES_INPUT 3
+#define ENCDEC_TASKS_HASH_INPUT 4 // one row band of an IntraBC hash level
+#define ENCDEC_TASKS_WAVEFRONT_RESUME 5 // a segment parked on the reference rows is ready (cross-picture wavefront)
+#define ENCDEC_TASKS_SUB_SB_INPUT 6 // PD0 quadrants of an SB shared by another EncDec thread (sub-SB parallel MD)
 
 /**************************************
  * Process Results
@@ -32,6 +35,11 @@ typedef struct EncDecTasks {
     uint32_t         input_type;
     int16_t          enc_dec_segment_row;
     uint16_t         tile_group_index;
+    // Cross-picture wavefront: segment to resume, and next task parked on the same reference
+    uint16_t         wavefront_segment_index;
+    EbObjectWrapper *wavefront_next;
+    // Sub-SB parallel MD: job holding the quadrants to search
+    struct SubSbMdJob *sub_sb_job;
 } EncDecTasks;
 
 typedef struct EncDecTasksInitData {
@@ -107,7 +107,7 @@ uint8_t svt_aom_get_gm_core_level(EncMode enc_mode, bool super_res_off) {
             gm_level = 1;
         else if (enc_mode <= ENC_MR)
             gm_level = 2;
-        else if (enc_mode <= ENC_M2)
+        else if (enc_mode <= ENC_M3)
             gm_level = 4;
         else
             gm_level = 0;
@@ -130,7 +130,9 @@ uint8_t svt_aom_derive_gm_level(PictureParentControlSet *pcs, bool super_res_off
     // pics might be scaled in different size
     // super-res is ok for its reference pics are always upscaled
     // to original size
-    if (!is_islice)
+    // the cross-picture wavefront restricts MVs to the reconstructed reference rows, which a
+    // non-translational model cannot honour
+    if (!is_islice && !pcs->scs->cross_pic_wavefront)
         gm_level = svt_aom_get_gm_core_level(enc_mode, super_res_off);
     return gm_level;
 }
@@ -551,6 +553,54 @@ static void svt_aom_set_me_8x8_var_ctrls(MeContext *me_ctx, uint8_t level) {
     default: assert(0);
     }
 }
+static void svt_aom_set_me_epzs_ctrls(MeContext *me_ctx, uint8_t level) {
+    MeEpzsCtrls *epzs_ctrls = &me_ctx->me_epzs_ctrls;
+
+    switch (level) {
+    case 0: epzs_ctrls->enabled = 0; break;
+    case 1:
+        epzs_ctrls->enabled       = 1;
+        epzs_ctrls->min_sa_area   = 64;
+        epzs_ctrls->max_hex_steps = 8;
+        epzs_ctrls->early_exit_th = BLOCK_SIZE_64 * BLOCK_SIZE_64;
+        break;
+    case 2:
+        epzs_ctrls->enabled       = 1;
+        epzs_ctrls->min_sa_area   = 64;
+        epzs_ctrls->max_hex_steps = 4;
+        epzs_ctrls->early_exit_th = BLOCK_SIZE_64 * BLOCK_SIZE_64 * 2;
+        break;
+    default: assert(0);
+    }
+}
+static void svt_aom_set_me_hash_ctrls(MeContext *me_ctx, uint8_t level) {
+    MeHashCtrls *me_hash_ctrls = &me_ctx->me_hash_ctrls;
+
+    switch (level) {
+    case 0: me_hash_ctrls->enabled = 0; break;
+    case 1: me_hash_ctrls->enabled = 1; break;
+    default: assert(0);
+    }
+}
+static void svt_aom_set_me_tf_mv_ctrls(MeContext *me_ctx, uint8_t level) {
+    MeTfMvCtrls *tf_mv_ctrls = &me_ctx->tf_mv_ctrls;
+
+    switch (level) {
+    case 0:
+        tf_mv_ctrls->enabled         = 0;
+        tf_mv_ctrls->skip_hme_sad_th = 0;
+        break;
+    case 1:
+        tf_mv_ctrls->enabled         = 1;
+        tf_mv_ctrls->skip_hme_sad_th = 0;
+        break;
+    case 2:
+        tf_mv_ctrls->enabled         = 1;
+        tf_mv_ctrls->skip_hme_sad_th = BLOCK_SIZE_64 * BLOCK_SIZE_64 * 2;
+        break;
+    default: assert(0);
+    }
+}
 /*configure PreHme control*/
 static void svt_aom_set_prehme_ctrls(MeContext *me_ctx, uint8_t level) {
     PreHmeCtrls *ctrl = &me_ctx->prehme_ctrl;
@@ -811,6 +861,25 @@ void svt_aom_sig_deriv_me(SequenceControlSet *scs, PictureParentControlSet *pcs,
 
     uint8_t me_8x8_var_lvl = 2;
     svt_aom_set_me_8x8_var_ctrls(me_ctx, me_8x8_var_lvl);
+
+    uint8_t me_epzs_lvl = 0;
+    if (enc_mode >= ENC_M12)
+        me_epzs_lvl = 2;
+    else if (enc_mode >= ENC_M10)
+        me_epzs_lvl = 1;
+    svt_aom_set_me_epzs_ctrls(me_ctx, me_epzs_lvl);
+
+    // The hash tables are built on the full resolution references only
+    uint8_t me_hash_lvl = (scs->static_config.enable_hash_me || sc_class1) && !pcs->frame_superres_enabled &&
+            !pcs->frame_resize_enabled
+        ? 1
+        : 0;
+    svt_aom_set_me_hash_ctrls(me_ctx, me_hash_lvl);
+    // The TF motion is only stored for the full resolution pictures
+    uint8_t me_tf_mv_lvl = 0;
+    if (!pcs->frame_superres_enabled && !pcs->frame_resize_enabled)
+        me_tf_mv_lvl = enc_mode <= ENC_M3 ? 1 : 2;
+    svt_aom_set_me_tf_mv_ctrls(me_ctx, me_tf_mv_lvl);
     if (enc_mode <= ENC_M5)
         me_ctx->prune_me_candidates_th = 0;
     else
@@ -882,6 +951,9 @@ void svt_aom_sig_deriv_me_tf(PictureParentControlSet *pcs, MeContext *me_ctx) {
     svt_aom_set_mv_based_sa_ctrls(me_ctx, 0);
 
     svt_aom_set_me_8x8_var_ctrls(me_ctx, 0);
+    svt_aom_set_me_epzs_ctrls(me_ctx, 0);
+    svt_aom_set_me_hash_ctrls(me_ctx, 0);
+    svt_aom_set_me_tf_mv_ctrls(me_ctx, 0);
     me_ctx->me_early_exit_th            = enc_mode <= ENC_M6 || resolution <= INPUT_SIZE_720p_RANGE
                    ? 0
                    : BLOCK_SIZE_64 * BLOCK_SIZE_64 * 4;
@@ -1359,6 +1431,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 1;
         ctrls->max_one_refinement_step = 0;
         ctrls->use_prev_frame_coeffs   = 0;
+        ctrls->warm_start              = 0;
+        ctrls->warm_start_th           = 0;
         break;
     case 2:
         ctrls->enabled                 = 1;
@@ -1367,6 +1441,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 1;
         ctrls->max_one_refinement_step = 1;
         ctrls->use_prev_frame_coeffs   = 0;
+        ctrls->warm_start              = 0;
+        ctrls->warm_start_th           = 0;
         break;
     case 3:
         ctrls->enabled                 = 1;
@@ -1375,6 +1451,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 1;
         ctrls->max_one_refinement_step = 1;
         ctrls->use_prev_frame_coeffs   = 0;
+        ctrls->warm_start              = 0;
+        ctrls->warm_start_th           = 0;
         break;
     case 4:
         ctrls->enabled                 = 1;
@@ -1383,6 +1461,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 0;
         ctrls->max_one_refinement_step = 1;
         ctrls->use_prev_frame_coeffs   = 0;
+        ctrls->warm_start              = 1;
+        ctrls->warm_start_th           = 1;
         break;
     case 5:
         ctrls->enabled                 = 1;
@@ -1391,6 +1471,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 0;
         ctrls->max_one_refinement_step = 1;
         ctrls->use_prev_frame_coeffs   = 0;
+        ctrls->warm_start              = 1;
+        ctrls->warm_start_th           = 1;
         break;
     case 6:
         ctrls->enabled                 = 1;
@@ -1399,6 +1481,8 @@ static void svt_aom_set_wn_filter_ctrls(Av1Common *cm, uint8_t wn_filter_lvl) {
         ctrls->use_refinement          = 0;
         ctrls->max_one_refinement_step = 1;
         ctrls->use_prev_frame_coeffs   = 1;
+        ctrls->warm_start              = 0;
+        ctrls->warm_start_th           = 0;
         break;
     default: assert(0); break;
     }
@@ -1410,56 +1494,64 @@ static void svt_aom_set_sg_filter_ctrls(Av1Common *cm, uint8_t sg_filter_lvl) {
     switch (sg_filter_lvl) {
     case 0: ctrls->enabled = 0; break;
     case 1:
-        ctrls->enabled     = 1;
-        ctrls->use_chroma  = 1;
-        ctrls->step_range  = 16;
-        ctrls->start_ep[0] = 0;
-        ctrls->end_ep[0]   = 16;
-        ctrls->ep_inc[0]   = 1;
-        ctrls->start_ep[1] = 0;
-        ctrls->end_ep[1]   = 16;
-        ctrls->ep_inc[1]   = 1;
-        ctrls->refine[0]   = 1;
-        ctrls->refine[1]   = 1;
+        ctrls->enabled       = 1;
+        ctrls->use_chroma    = 1;
+        ctrls->step_range    = 16;
+        ctrls->start_ep[0]   = 0;
+        ctrls->end_ep[0]     = 16;
+        ctrls->ep_inc[0]     = 1;
+        ctrls->start_ep[1]   = 0;
+        ctrls->end_ep[1]     = 16;
+        ctrls->ep_inc[1]     = 1;
+        ctrls->refine[0]     = 1;
+        ctrls->refine[1]     = 1;
+        ctrls->warm_start    = 0;
+        ctrls->warm_start_th = 0;
         break;
     case 2:
-        ctrls->enabled     = 1;
-        ctrls->use_chroma  = 1;
-        ctrls->step_range  = 16;
-        ctrls->start_ep[0] = 0;
-        ctrls->end_ep[0]   = 16;
-        ctrls->ep_inc[0]   = 1;
-        ctrls->start_ep[1] = 4;
-        ctrls->end_ep[1]   = 5;
-        ctrls->ep_inc[1]   = 1;
-        ctrls->refine[0]   = 1;
-        ctrls->refine[1]   = 0;
+        ctrls->enabled       = 1;
+        ctrls->use_chroma    = 1;
+        ctrls->step_range    = 16;
+        ctrls->start_ep[0]   = 0;
+        ctrls->end_ep[0]     = 16;
+        ctrls->ep_inc[0]     = 1;
+        ctrls->start_ep[1]   = 4;
+        ctrls->end_ep[1]     = 5;
+        ctrls->ep_inc[1]     = 1;
+        ctrls->refine[0]     = 1;
+        ctrls->refine[1]     = 0;
+        ctrls->warm_start    = 0;
+        ctrls->warm_start_th = 0;
         break;
     case 3:
-        ctrls->enabled     = 1;
-        ctrls->use_chroma  = 1;
-        ctrls->step_range  = 16;
-        ctrls->start_ep[0] = 0;
-        ctrls->end_ep[0]   = 16;
-        ctrls->ep_inc[0]   = 8;
-        ctrls->start_ep[1] = 4;
-        ctrls->end_ep[1]   = 5;
-        ctrls->ep_inc[1]   = 1;
-        ctrls->refine[0]   = 1;
-        ctrls->refine[1]   = 0;
+        ctrls->enabled       = 1;
+        ctrls->use_chroma    = 1;
+        ctrls->step_range    = 16;
+        ctrls->start_ep[0]   = 0;
+        ctrls->end_ep[0]     = 16;
+        ctrls->ep_inc[0]     = 8;
+        ctrls->start_ep[1]   = 4;
+        ctrls->end_ep[1]     = 5;
+        ctrls->ep_inc[1]     = 1;
+        ctrls->refine[0]     = 1;
+        ctrls->refine[1]     = 0;
+        ctrls->warm_start    = 1;
+        ctrls->warm_start_th = 1;
         break;
     case 4:
-        ctrls->enabled     = 1;
-        ctrls->use_chroma  = 0;
-        ctrls->step_range  = 16;
-        ctrls->start_ep[0] = 0;
-        ctrls->end_ep[0]   = 16;
-        ctrls->ep_inc[0]   = 8;
-        ctrls->start_ep[1] = 4;
-        ctrls->end_ep[1]   = 5;
-        ctrls->ep_inc[1]   = 1;
-        ctrls->refine[0]   = 1;
-        ctrls->refine[1]   = 0;
+        ctrls->enabled       = 1;
+        ctrls->use_chroma    = 0;
+        ctrls->step_range    = 16;
+        ctrls->start_ep[0]   = 0;
+        ctrls->end_ep[0]     = 16;
+        ctrls->ep_inc[0]     = 8;
+        ctrls->start_ep[1]   = 4;
+        ctrls->end_ep[1]     = 5;
+        ctrls->ep_inc[1]     = 1;
+        ctrls->refine[0]     = 1;
+        ctrls->refine[1]     = 0;
+        ctrls->warm_start    = 1;
+        ctrls->warm_start_th = 1;
         break;
     default: assert(0); break;
     }
@@ -1882,6 +1974,8 @@ void svt_aom_sig_deriv_multi_processes(SequenceControlSet *scs, PictureParentCon
     }
     set_intrabc_level(pcs, scs, intrabc_level);
     frm_hdr->allow_intrabc = pcs->intraBC_ctrls.enabled;
+    // Static SB skip; the map is built during ME against the LAST reference
+    pcs->static_sb_skip = scs->static_sb_skip && !is_islice && !pcs->is_overlay;
     // Set palette_level
     if (sc_class1) {
         if (rtc_tune)
@@ -1931,6 +2025,10 @@ void svt_aom_sig_deriv_multi_processes(SequenceControlSet *scs, PictureParentCon
             pcs->cdef_level = (int8_t)(scs->static_config.cdef_level);
     } else
         pcs->cdef_level = 0;
+    // Under the cross-picture wavefront, the rows of a reference picture are used by other pictures
+    // as soon as they are deblocked, so the frame level filters are off for reference pictures
+    if (scs->cross_pic_wavefront && pcs->is_ref)
+        pcs->cdef_level = 0;
 
     set_cdef_controls(pcs, pcs->cdef_level, fast_decode);
 
@@ -1947,10 +2045,18 @@ void svt_aom_sig_deriv_multi_processes(SequenceControlSet *scs, PictureParentCon
         wn = svt_aom_get_wn_filter_level(enc_mode, init_input_resolution, is_not_last_layer, is_base);
         sg = svt_aom_get_sg_filter_level(enc_mode, init_input_resolution, fast_decode);
     }
+    if (scs->cross_pic_wavefront && pcs->is_ref)
+        wn = sg = 0;
 
     Av1Common *cm = pcs->av1_cm;
     svt_aom_set_wn_filter_ctrls(cm, wn);
     svt_aom_set_sg_filter_ctrls(cm, sg);
+    // The references may still be in progress when their restoration filters would be read
+    if (scs->cross_pic_wavefront) {
+        cm->wn_filter_ctrls.use_prev_frame_coeffs = 0;
+        cm->wn_filter_ctrls.warm_start            = 0;
+        cm->sg_filter_ctrls.warm_start            = 0;
+    }
 
     // Set whether restoration filtering is enabled for this frame
     pcs->enable_restoration = (wn > 0 || sg > 0);
@@ -1958,7 +2064,8 @@ void svt_aom_sig_deriv_multi_processes(SequenceControlSet *scs, PictureParentCon
     // Set frame end cdf update mode      Settings
     // 0                                     OFF
     // 1                                     ON
-    pcs->frame_end_cdf_update_mode = 1;
+    // The cross-picture wavefront cannot wait for the end of frame CDFs of the references
+    pcs->frame_end_cdf_update_mode = scs->cross_pic_wavefront ? 0 : 1;
 
     (void)context_ptr;
 
@@ -1969,14 +2076,7 @@ void svt_aom_sig_deriv_multi_processes(SequenceControlSet *scs, PictureParentCon
     pcs->tune_tpl_for_chroma = 0;
 #endif
     if (scs->enable_hbd_mode_decision == DEFAULT)
-        if (enc_mode <= ENC_M2)
-            pcs->hbd_md = 1;
-        else if (enc_mode <= ENC_M4)
-            pcs->hbd_md = 2;
-        else if (enc_mode <= ENC_M7)
-            pcs->hbd_md = is_base ? 2 : 0;
-        else
-            pcs->hbd_md = is_islice ? 2 : 0;
+        pcs->hbd_md = svt_aom_get_hbd_md(enc_mode, is_base, is_islice);
     else
         pcs->hbd_md = scs->enable_hbd_mode_decision;
 
@@ -2020,15 +2120,16 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->params_refinement_steps      = 5;
         gm_ctrls->downsample_level             = GM_FULL;
 
-        gm_ctrls->corners       = 4;
-        gm_ctrls->chess_rfn     = 0;
-        gm_ctrls->match_sz      = 13;
-        gm_ctrls->inj_psq_glb   = FALSE;
-        gm_ctrls->use_ref_info  = 0;
-        gm_ctrls->layer_offset  = 0;
-        gm_ctrls->pp_enabled    = 0;
-        gm_ctrls->ref_idx0_only = 0;
-        gm_ctrls->qp_offset     = 0;
+        gm_ctrls->corners                = 4;
+        gm_ctrls->chess_rfn              = 0;
+        gm_ctrls->match_sz               = 13;
+        gm_ctrls->inj_psq_glb            = FALSE;
+        gm_ctrls->use_ref_info           = 0;
+        gm_ctrls->layer_offset           = 0;
+        gm_ctrls->pp_enabled             = 0;
+        gm_ctrls->ref_idx0_only          = 0;
+        gm_ctrls->qp_offset              = 0;
+        gm_ctrls->ransac_adaptive_trials = 0;
         break;
     case 2:
         gm_ctrls->enabled                      = 1;
@@ -2049,6 +2150,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 1;
         gm_ctrls->ref_idx0_only                = 0;
         gm_ctrls->qp_offset                    = 0;
+        gm_ctrls->ransac_adaptive_trials       = 0;
         break;
     case 3:
         gm_ctrls->enabled                      = 1;
@@ -2069,6 +2171,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 1;
         gm_ctrls->ref_idx0_only                = 0;
         gm_ctrls->qp_offset                    = 0;
+        gm_ctrls->ransac_adaptive_trials       = 0;
         break;
     case 4:
         gm_ctrls->enabled                      = 1;
@@ -2089,6 +2192,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 1;
         gm_ctrls->ref_idx0_only                = 1;
         gm_ctrls->qp_offset                    = 0;
+        gm_ctrls->ransac_adaptive_trials       = 1;
         break;
     case 5:
         gm_ctrls->enabled                      = 1;
@@ -2109,6 +2213,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 1;
         gm_ctrls->ref_idx0_only                = 1;
         gm_ctrls->qp_offset                    = 0;
+        gm_ctrls->ransac_adaptive_trials       = 1;
         break;
     case 6:
         gm_ctrls->enabled                      = 1;
@@ -2129,6 +2234,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 1;
         gm_ctrls->ref_idx0_only                = 1;
         gm_ctrls->qp_offset                    = 1;
+        gm_ctrls->ransac_adaptive_trials       = 1;
         break;
     case 7:
         gm_ctrls->enabled                      = 1;
@@ -2149,6 +2255,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 0;
         gm_ctrls->ref_idx0_only                = 1;
         gm_ctrls->qp_offset                    = 1;
+        gm_ctrls->ransac_adaptive_trials       = 1;
         break;
     case 8:
         gm_ctrls->enabled                      = 1;
@@ -2169,6 +2276,7 @@ void svt_aom_set_gm_controls(PictureParentControlSet *pcs, uint8_t gm_level) {
         gm_ctrls->pp_enabled                   = 0;
         gm_ctrls->ref_idx0_only                = 1;
         gm_ctrls->qp_offset                    = 1;
+        gm_ctrls->ransac_adaptive_trials       = 1;
         break;
 
     default: assert(0); break;
@@ -7663,6 +7771,21 @@ void svt_aom_sig_deriv_enc_dec_light_pd1(PictureControlSet *pcs, ModeDecisionCon
     ctx->rate_est_ctrls.update_skip_coeff_ctx       = 0;
     ctx->subres_ctrls.odd_to_even_deviation_th      = 0;
 }
+/*
+ * Override the PD1 signals for a static SB: no intra, no MV search and a single DCT_DCT transform
+ * at the 64x64 depth. The residual is still coded so reference drift is corrected.
+ */
+void svt_aom_sig_deriv_enc_dec_static_sb(PictureControlSet *pcs, ModeDecisionContext *ctx) {
+    set_intra_ctrls(pcs, ctx, 0);
+    md_sq_motion_search_controls(ctx, 0);
+    svt_aom_md_pme_search_controls(ctx, 0);
+    md_subpel_me_controls(pcs, ctx, 0, false);
+    svt_aom_set_inter_intra_ctrls(ctx, 0);
+    svt_aom_set_obmc_controls(ctx, 0);
+    svt_aom_set_txt_controls(ctx, 0);
+    set_txs_controls(pcs, ctx, 0);
+    ctx->md_disallow_nsq_search = 1;
+}
 void svt_aom_sig_deriv_enc_dec(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx) {
     EncMode                  enc_mode             = pcs->enc_mode;
     uint8_t                  pd_pass              = ctx->pd_pass;
@@ -8350,6 +8473,23 @@ uint8_t get_filter_intra_level(EncMode enc_mode) {
     return filter_intra_level;
 }
 
+/*
+ * Default hbd_md level (0: 8bit MD, 1: 10bit MD, 2: dual 8bit/10bit MD) used when
+ * enable_hbd_mode_decision is DEFAULT
+ */
+uint8_t svt_aom_get_hbd_md(EncMode enc_mode, uint8_t is_base, uint8_t is_islice) {
+    uint8_t hbd_md;
+    if (enc_mode <= ENC_M2)
+        hbd_md = 1;
+    else if (enc_mode <= ENC_M4)
+        hbd_md = 2;
+    else if (enc_mode <= ENC_M7)
+        hbd_md = is_base ? 2 : 0;
+    else
+        hbd_md = is_islice ? 2 : 0;
+    return hbd_md;
+}
+
 uint8_t svt_aom_get_inter_intra_level(EncMode enc_mode, uint8_t is_base, uint8_t transition_present) {
     uint8_t inter_intra_level = 0;
     if (enc_mode <= ENC_MRS)
@@ -8522,6 +8662,9 @@ void svt_aom_sig_deriv_mode_decision_config(SequenceControlSet *scs, PictureCont
             pcs->wm_level = pcs->wm_level == 1 ? pcs->wm_level : pcs->wm_level == 0 ? MAX_WARP_LVL : pcs->wm_level - 1;
         }
     }
+    // Local warp may reach past the reference rows allowed by the cross-picture wavefront
+    if (scs->cross_pic_wavefront)
+        pcs->wm_level = 0;
 
     Bool enable_wm = pcs->wm_level ? 1 : 0;
     // Note: local warp should be disabled when super-res or resize is ON
@@ -9149,6 +9292,10 @@ void svt_aom_sig_deriv_mode_decision_config(SequenceControlSet *scs, PictureCont
                                   sc_class1,
                                   (pcs->temporal_layer_index == 0));
     }
+    // The cross-picture wavefront needs the reference rows deblocked as they are coded, so the
+    // frame based DLF levels are mapped to the first SB based level
+    if (pcs->scs->cross_pic_wavefront && pcs->ppcs->is_ref && (dlf_level == 1 || dlf_level == 2))
+        dlf_level = 3;
     svt_aom_set_dlf_controls(pcs->ppcs, dlf_level);
 }
 /****************************************************
@@ -9169,4 +9316,7 @@ void svt_aom_set_mfmv_config(SequenceControlSet *scs) {
             scs->mfmv_enabled = 0;
     } else
         scs->mfmv_enabled = scs->static_config.enable_mfmv;
+    // The motion field projection reads the MVs of whole reference pictures
+    if (scs->cross_pic_wavefront)
+        scs->mfmv_enabled = 0;
 }
@@ -14,6 +14,7 @@
 #include "encode_context.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "svt_threads.h"
+#include "md_early_term.h"
 
 static EbErrorType create_stats_buffer(FIRSTPASS_STATS **frame_stats_buffer, STATS_BUFFER_CTX *stats_buf_context,
                                        int num_lap_buffers) {
@@ -59,6 +60,9 @@ static void encode_context_dctor(EbPtr p) {
 #endif
     EB_DESTROY_MUTEX(obj->sc_buffer_mutex);
     EB_DESTROY_MUTEX(obj->stat_file_mutex);
+    if (obj->etm_dump_file)
+        fclose(obj->etm_dump_file);
+    EB_DESTROY_MUTEX(obj->etm_dump_mutex);
     EB_DESTROY_MUTEX(obj->frame_updated_mutex);
     EB_DELETE(obj->prediction_structure_group_ptr);
     EB_DELETE_PTR_ARRAY(obj->picture_decision_reorder_queue, PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH);
@@ -146,6 +150,8 @@ EbErrorType svt_aom_encode_context_ctor(EncodeContext *enc_ctx, EbPtr object_ini
     enc_ctx->recode_tolerance = 25;
     enc_ctx->rc_cfg.min_cr    = 0;
     EB_CREATE_MUTEX(enc_ctx->stat_file_mutex);
+    enc_ctx->etm_dump_file = svt_aom_etm_open_dump();
+    EB_CREATE_MUTEX(enc_ctx->etm_dump_mutex);
     enc_ctx->num_lap_buffers = 0; // lap not supported for now
     int *num_lap_buffers     = &enc_ctx->num_lap_buffers;
     create_stats_buffer(&enc_ctx->frame_stats_buffer, &enc_ctx->stats_buf_context, *num_lap_buffers);
@@ -170,6 +170,9 @@ typedef struct EncodeContext {
     uint64_t         picture_number_alt; // The picture number overlay includes all the overlay frames
 
     EbHandle stat_file_mutex;
+    // MD early termination feature dump (NULL when off)
+    FILE    *etm_dump_file;
+    EbHandle etm_dump_mutex;
 
     Bool                 is_mini_gop_changed;
     uint64_t             poc_map_idx[MAX_TPL_LA_SW];
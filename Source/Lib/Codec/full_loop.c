@@ -2621,13 +2621,51 @@ static void compute_depth_costs(ModeDecisionContext *ctx, PictureParentControlSe
                 *above_depth_cost == MAX_MODE_COST));
 }
 
+/*
+ * Compare the cost of the 4 quadrants ending at curr_depth_mds to the cost of their parent, and update
+ * the parent cost/splitting info to reflect the chosen partition. Returns TRUE if the parent is kept unsplit.
+ */
+Bool svt_aom_d2_parent_depth_decision(PictureControlSet *pcs, ModeDecisionContext *ctx, uint32_t curr_depth_mds) {
+    uint64_t         parent_depth_cost = 0, current_depth_cost = 0;
+    const BlockGeom *blk_geom             = get_blk_geom_mds(curr_depth_mds);
+    uint32_t         parent_depth_idx_mds = blk_geom->parent_depth_idx_mds;
+    compute_depth_costs(ctx,
+                        pcs->ppcs,
+                        curr_depth_mds,
+                        parent_depth_idx_mds,
+                        blk_geom->ns_depth_offset,
+                        &parent_depth_cost,
+                        &current_depth_cost);
+    if (ctx->inter_depth_bias && current_depth_cost != MAX_MODE_COST) {
+        current_depth_cost = (current_depth_cost * ctx->inter_depth_bias) / 1000;
+    }
+    int parent_bias = parent_depth_cost != MAX_MODE_COST ? ctx->d2_parent_bias : 1000;
+    if (parent_depth_cost == MAX_MODE_COST && current_depth_cost == MAX_MODE_COST) {
+        // If parent and current depth are both invalid, don't update the cost
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].part       = PARTITION_SPLIT;
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = TRUE;
+    } else if (((parent_bias * parent_depth_cost) / 1000) <= current_depth_cost) {
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = FALSE;
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].cost       = parent_depth_cost;
+        ctx->cost_avail[parent_depth_idx_mds]                = 1;
+        assert(parent_depth_cost != MAX_MODE_COST);
+        return TRUE;
+    } else {
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].cost       = current_depth_cost;
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].part       = PARTITION_SPLIT;
+        ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = TRUE;
+        ctx->cost_avail[parent_depth_idx_mds]                = 1;
+        assert(current_depth_cost != MAX_MODE_COST);
+    }
+    return FALSE;
+}
+
 /*
  * Compare costs between depths, then update cost/splitting info in the parent blocks
  * to reflect chosen partition.  Cost comparison only performed when the all quadrants
  * of a given depth have been evaluted.
  */
 uint32_t svt_aom_d2_inter_depth_block_decision(PictureControlSet *pcs, ModeDecisionContext *ctx, uint32_t blk_mds) {
-    uint64_t         parent_depth_cost = 0, current_depth_cost = 0;
     Bool             last_depth_flag = (ctx->md_blk_arr_nsq[blk_mds].split_flag == FALSE);
     uint32_t         last_blk_index = blk_mds, current_depth_idx_mds = blk_mds;
     const BlockGeom *blk_geom = get_blk_geom_mds(blk_mds);
@@ -2635,34 +2673,8 @@ uint32_t svt_aom_d2_inter_depth_block_decision(PictureControlSet *pcs, ModeDecis
         while (blk_geom->is_last_quadrant) {
             //get parent idx
             uint32_t parent_depth_idx_mds = blk_geom->parent_depth_idx_mds;
-            compute_depth_costs(ctx,
-                                pcs->ppcs,
-                                current_depth_idx_mds,
-                                parent_depth_idx_mds,
-                                blk_geom->ns_depth_offset,
-                                &parent_depth_cost,
-                                &current_depth_cost);
-            if (ctx->inter_depth_bias && current_depth_cost != MAX_MODE_COST) {
-                current_depth_cost = (current_depth_cost * ctx->inter_depth_bias) / 1000;
-            }
-            int parent_bias = parent_depth_cost != MAX_MODE_COST ? ctx->d2_parent_bias : 1000;
-            if (parent_depth_cost == MAX_MODE_COST && current_depth_cost == MAX_MODE_COST) {
-                // If parent and current depth are both invalid, don't update the cost
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].part       = PARTITION_SPLIT;
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = TRUE;
-            } else if (((parent_bias * parent_depth_cost) / 1000) <= current_depth_cost) {
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = FALSE;
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].cost       = parent_depth_cost;
-                last_blk_index                                       = parent_depth_idx_mds;
-                ctx->cost_avail[parent_depth_idx_mds]                = 1;
-                assert(parent_depth_cost != MAX_MODE_COST);
-            } else {
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].cost       = current_depth_cost;
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].part       = PARTITION_SPLIT;
-                ctx->md_blk_arr_nsq[parent_depth_idx_mds].split_flag = TRUE;
-                ctx->cost_avail[parent_depth_idx_mds]                = 1;
-                assert(current_depth_cost != MAX_MODE_COST);
-            }
+            if (svt_aom_d2_parent_depth_decision(pcs, ctx, current_depth_idx_mds))
+                last_blk_index = parent_depth_idx_mds;
 
             //setup next parent inter depth
             blk_geom              = get_blk_geom_mds(parent_depth_idx_mds);
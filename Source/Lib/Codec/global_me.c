@@ -51,6 +51,7 @@ void svt_aom_gm_pre_processor(PictureParentControlSet *pcs, PictureParentControl
     pcs->gm_ctrls.inj_psq_glb                  = TRUE;
     pcs->gm_ctrls.use_ref_info                 = 0;
     pcs->gm_ctrls.layer_offset                 = 0;
+    pcs->gm_ctrls.ransac_adaptive_trials       = 1;
 
     PictureParentControlSet *ref_pcs_list[2];
     PictureParentControlSet *cur_pcs   = pcs_list[0];
@@ -135,10 +136,6 @@ void svt_aom_global_motion_estimation(PictureParentControlSet *pcs, EbPictureBuf
     sixteenth_picture_ptr = (EbPictureBufferDesc *)pa_reference_object->sixteenth_downsampled_picture_ptr;
     PictureControlSet *cpcs;
     cpcs = pcs->child_pcs;
-    if (pcs->gm_ctrls.use_ref_info) {
-        quarter_picture_ptr   = pcs->quarter_src_pic;
-        sixteenth_picture_ptr = pcs->sixteenth_src_pic;
-    }
     uint32_t num_of_list_to_search = (pcs->slice_type == P_SLICE) ? 1 /*List 0 only*/ : 2 /*List 0 + 1*/;
     // Initilize global motion to be OFF for all references frames.
     memset(pcs->is_global_motion, FALSE, MAX_NUM_OF_REF_PIC_LIST * REF_LIST_MAX_DEPTH);
@@ -436,6 +433,24 @@ void compute_global_motion(PictureParentControlSet *pcs, int *frm_corners, int n
 #define GLOBAL_TRANS_TYPES_ENC 3
 
         const GlobalMotionEstimationType gm_estimation_type = GLOBAL_MOTION_FEATURE_BASED;
+        // The reference corners and their matches do not depend on the model, so they are derived
+        // once and shared by all the models tested
+        int *correspondences     = (int *)malloc(num_frm_corners * 4 * sizeof(*correspondences));
+        int  num_correspondences = svt_av1_compute_gm_correspondences(pcs->gm_ctrls.corners,
+                                                                     det_frm_buffer,
+                                                                     det_input_pic->width,
+                                                                     det_input_pic->height,
+                                                                     det_input_pic->stride_y,
+                                                                     frm_corners,
+                                                                     num_frm_corners,
+                                                                     det_ref_buffer,
+                                                                     det_ref_pic->stride_y,
+                                                                     EB_EIGHT_BIT,
+                                                                     correspondences,
+                                                                     pcs->gm_ctrls.match_sz);
+        // SAD of the unwarped reference, derived on first use
+        uint32_t ref_sad_error = 0;
+        bool     ref_sad_done  = false;
         for (model = ROTZOOM; model <= (pcs->gm_ctrls.rotzoom_model_only ? ROTZOOM : GLOBAL_TRANS_TYPES_ENC); ++model) {
             int64_t best_warp_error = INT64_MAX;
             // Initially set all params to identity.
@@ -447,21 +462,13 @@ void compute_global_motion(PictureParentControlSet *pcs, int *frm_corners, int n
             }
 
             svt_av1_compute_global_motion(model,
-                                          pcs->gm_ctrls.corners,
-                                          det_frm_buffer,
-                                          det_input_pic->width,
-                                          det_input_pic->height,
-                                          det_input_pic->stride_y,
-                                          frm_corners,
-                                          num_frm_corners,
-                                          det_ref_buffer,
-                                          det_ref_pic->stride_y,
-                                          EB_EIGHT_BIT,
+                                          correspondences,
+                                          num_correspondences,
                                           gm_estimation_type,
                                           inliers_by_motion,
                                           params_by_motion,
                                           RANSAC_NUM_MOTIONS,
-                                          pcs->gm_ctrls.match_sz);
+                                          pcs->gm_ctrls.ransac_adaptive_trials);
 
             for (unsigned i = 0; i < RANSAC_NUM_MOTIONS; ++i) {
                 if (inliers_by_motion[i] == 0)
@@ -507,8 +514,11 @@ void compute_global_motion(PictureParentControlSet *pcs, int *frm_corners, int n
             if (global_motion.wmtype == IDENTITY)
                 continue;
 
-            const uint32_t ref_sad_error = svt_nxm_sad_kernel(
-                ref_buffer, ref_pic->stride_y, frm_buffer, input_pic->stride_y, input_pic->height, input_pic->width);
+            if (!ref_sad_done) {
+                ref_sad_error = svt_nxm_sad_kernel(
+                    ref_buffer, ref_pic->stride_y, frm_buffer, input_pic->stride_y, input_pic->height, input_pic->width);
+                ref_sad_done = true;
+            }
 
             if (ref_sad_error == 0)
                 continue;
@@ -525,6 +535,7 @@ void compute_global_motion(PictureParentControlSet *pcs, int *frm_corners, int n
                 break;
             }
         }
+        free(correspondences);
     }
 
     *best_wm = global_motion;
@@ -263,41 +263,40 @@ static void get_inliers_from_indices(MotionModel *params, int *correspondences)
     svt_aom_free(inliers_tmp);
 }
 
-static int compute_global_motion_feature_based(TransformationType type, uint8_t corners, unsigned char *frm_buffer,
-                                               int frm_width, int frm_height, int frm_stride, int *frm_corners,
-                                               int num_frm_corners, uint8_t *ref, int ref_stride, int bit_depth,
-                                               int *num_inliers_by_motion, MotionModel *params_by_motion,
-                                               int num_motions, uint8_t match_sz) {
+int svt_av1_compute_gm_correspondences(uint8_t corners, unsigned char *frm_buffer, int frm_width, int frm_height,
+                                       int frm_stride, int *frm_corners, int num_frm_corners, uint8_t *ref,
+                                       int ref_stride, int bit_depth, int *correspondences, uint8_t match_sz) {
     (void)bit_depth;
     assert(bit_depth == EB_EIGHT_BIT);
-    int            i;
-    int            num_ref_corners;
-    int            num_correspondences;
-    int           *correspondences;
-    int            ref_corners[2 * MAX_CORNERS];
-    unsigned char *ref_buffer = ref;
-    RansacFunc     ransac     = svt_av1_get_ransac_type(type);
+    int num_ref_corners;
+    int ref_corners[2 * MAX_CORNERS];
 
-    num_ref_corners = svt_av1_fast_corner_detect(
-        ref_buffer, frm_width, frm_height, ref_stride, ref_corners, MAX_CORNERS);
+    num_ref_corners = svt_av1_fast_corner_detect(ref, frm_width, frm_height, ref_stride, ref_corners, MAX_CORNERS);
 
     num_ref_corners = num_ref_corners * corners / 4;
 
     // find correspondences between the two images
-    correspondences     = (int *)malloc(num_frm_corners * 4 * sizeof(*correspondences));
-    num_correspondences = svt_av1_determine_correspondence(frm_buffer,
-                                                           (int *)frm_corners,
-                                                           num_frm_corners,
-                                                           ref_buffer,
-                                                           (int *)ref_corners,
-                                                           num_ref_corners,
-                                                           frm_width,
-                                                           frm_height,
-                                                           frm_stride,
-                                                           ref_stride,
-                                                           correspondences,
-                                                           match_sz);
-    ransac(correspondences, num_correspondences, num_inliers_by_motion, params_by_motion, num_motions);
+    return svt_av1_determine_correspondence(frm_buffer,
+                                            (int *)frm_corners,
+                                            num_frm_corners,
+                                            ref,
+                                            (int *)ref_corners,
+                                            num_ref_corners,
+                                            frm_width,
+                                            frm_height,
+                                            frm_stride,
+                                            ref_stride,
+                                            correspondences,
+                                            match_sz);
+}
+
+static int compute_global_motion_feature_based(TransformationType type, int *correspondences, int num_correspondences,
+                                               int *num_inliers_by_motion, MotionModel *params_by_motion,
+                                               int num_motions, uint8_t adaptive_trials) {
+    int        i;
+    RansacFunc ransac = svt_av1_get_ransac_type(type);
+
+    ransac(correspondences, num_correspondences, num_inliers_by_motion, params_by_motion, num_motions, adaptive_trials);
 
     // Set num_inliers = 0 for motions with too few inliers so they are ignored.
     for (i = 0; i < num_motions; ++i) {
@@ -308,8 +307,6 @@ static int compute_global_motion_feature_based(TransformationType type, uint8_t
         }
     }
 
-    free(correspondences);
-
     // Return true if any one of the motions has inliers.
     for (i = 0; i < num_motions; ++i) {
         if (num_inliers_by_motion[i] > 0)
@@ -318,28 +315,18 @@ static int compute_global_motion_feature_based(TransformationType type, uint8_t
     return 0;
 }
 
-int svt_av1_compute_global_motion(TransformationType type, uint8_t corners, unsigned char *frm_buffer, int frm_width,
-                                  int frm_height, int frm_stride, int *frm_corners, int num_frm_corners, uint8_t *ref,
-                                  int ref_stride, int bit_depth, GlobalMotionEstimationType gm_estimation_type,
-                                  int *num_inliers_by_motion, MotionModel *params_by_motion, int num_motions,
-                                  uint8_t match_sz) {
+int svt_av1_compute_global_motion(TransformationType type, int *correspondences, int num_correspondences,
+                                  GlobalMotionEstimationType gm_estimation_type, int *num_inliers_by_motion,
+                                  MotionModel *params_by_motion, int num_motions, uint8_t adaptive_trials) {
     switch (gm_estimation_type) {
     case GLOBAL_MOTION_FEATURE_BASED:
         return compute_global_motion_feature_based(type,
-                                                   corners,
-                                                   frm_buffer,
-                                                   frm_width,
-                                                   frm_height,
-                                                   frm_stride,
-                                                   frm_corners,
-                                                   num_frm_corners,
-                                                   ref,
-                                                   ref_stride,
-                                                   bit_depth,
+                                                   correspondences,
+                                                   num_correspondences,
                                                    num_inliers_by_motion,
                                                    params_by_motion,
                                                    num_motions,
-                                                   match_sz);
+                                                   adaptive_trials);
     default: assert(0 && "Unknown global motion estimation type");
     }
     return 0;
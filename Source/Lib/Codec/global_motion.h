@@ -66,8 +66,9 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                          int d_stride, int n_refinements, uint8_t chess_refn, int64_t best_frame_error);
 
 /*
-  Computes "num_motions" candidate global motion parameters between two frames.
-  The array "params_by_motion" should be length 8 * "num_motions". The ordering
+  Computes "num_motions" candidate global motion parameters from the
+  "num_correspondences" matches found between two frames by
+  svt_av1_compute_gm_correspondences(). The array "params_by_motion" should be length 8 * "num_motions". The ordering
   of each set of parameters is best described  by the homography:
 
         [x'     (m2 m3 m0   [x
@@ -80,11 +81,21 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
   number of inlier feature points for each motion. Params for which the
   num_inliers entry is 0 should be ignored by the caller.
 */
-int svt_av1_compute_global_motion(TransformationType type, uint8_t corners, unsigned char *frm_buffer, int frm_width,
-                                  int frm_height, int frm_stride, int *frm_corners, int num_frm_corners, uint8_t *ref,
-                                  int ref_stride, int bit_depth, GlobalMotionEstimationType gm_estimation_type,
-                                  int *num_inliers_by_motion, MotionModel *params_by_motion, int num_motions,
-                                  uint8_t match_sz);
+int svt_av1_compute_global_motion(TransformationType type, int *correspondences, int num_correspondences,
+                                  GlobalMotionEstimationType gm_estimation_type, int *num_inliers_by_motion,
+                                  MotionModel *params_by_motion, int num_motions, uint8_t adaptive_trials);
+
+/*
+  Detects the corners of "ref" and matches them against the "num_frm_corners"
+  corners of the source frame. Each correspondence is stored as 4 ints (source
+  x, y, reference x, y), so "correspondences" must hold 4 * "num_frm_corners"
+  entries. Returns the number of correspondences found. The matches do not
+  depend on the motion model, so they are computed once per reference and
+  shared by all the models tested.
+*/
+int svt_av1_compute_gm_correspondences(uint8_t corners, unsigned char *frm_buffer, int frm_width, int frm_height,
+                                       int frm_stride, int *frm_corners, int num_frm_corners, uint8_t *ref,
+                                       int ref_stride, int bit_depth, int *correspondences, uint8_t match_sz);
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -18,18 +18,18 @@
 extern "C" {
 #endif
 
-typedef struct _crc_calculator {
-    uint32_t remainder;
-    uint32_t trunc_poly;
-    uint32_t bits;
-    uint32_t table[256];
-    uint32_t final_result_mask;
-} CRC_CALCULATOR;
-
-// Initialize the crc calculator. It must be executed at least once before
-// calling svt_av1_get_crc_value().
-void     svt_av1_crc_calculator_init(CRC_CALCULATOR *p_crc_calculator, uint32_t bits, uint32_t truncPoly);
-uint32_t svt_av1_get_crc_value(void *crc_calculator, uint8_t *p, int length);
+// The IntraBC block hashes are CRC32C (Castagnoli polynomial, reflected) values
+// computed over 32-bit words, so that they map directly onto the SSE4.2 and
+// Armv8 CRC32C instructions. The C version is table driven.
+uint32_t svt_av1_crc32c_word_c(uint32_t crc, uint32_t word);
+
+// Two hashes are kept per block. CRC is linear over GF(2), so two CRCs of the
+// same data with different seeds collide together. The words of the second
+// hash are therefore first scrambled by an odd multiplier, a bijection which
+// is not linear over GF(2).
+#define CRC32C_HASH2_MULTIPLIER 0x9E3779B1u
+static INLINE uint32_t svt_av1_crc32c_hash2_word(uint32_t word) { return word * CRC32C_HASH2_MULTIPLIER; }
+
 #define AOM_BUFFER_SIZE_FOR_BLOCK_HASH (4096)
 
 #ifdef __cplusplus
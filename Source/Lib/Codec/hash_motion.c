@@ -12,32 +12,10 @@
 #include "hash.h"
 #include "hash_motion.h"
 #include "pcs.h"
+#include "aom_dsp_rtcd.h"
 
 void             svt_aom_free(void *memblk);
 static const int crc_bits        = 16;
-static const int block_size_bits = 3;
-
-static void hash_table_clear_all(HashTable *p_hash_table) {
-    if (p_hash_table->p_lookup_table == NULL)
-        return;
-    int max_addr = 1 << (crc_bits + block_size_bits);
-    for (int i = 0; i < max_addr; i++) {
-        if (p_hash_table->p_lookup_table[i] != NULL) {
-            svt_aom_vector_destroy(p_hash_table->p_lookup_table[i]);
-            free(p_hash_table->p_lookup_table[i]);
-            p_hash_table->p_lookup_table[i] = NULL;
-        }
-    }
-}
-
-static void get_pixels_in_1d_char_array_by_block_2x2(uint8_t *y_src, int stride, uint8_t *p_pixels_in1D) {
-    uint8_t *p_pel = y_src;
-    int      index = 0;
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 2; j++) p_pixels_in1D[index++] = p_pel[j];
-        p_pel += stride;
-    }
-}
 
 static void get_pixels_in_1d_short_array_by_block_2x2(uint16_t *y_src, int stride, uint16_t *p_pixels_in1D) {
     uint16_t *p_pel = y_src;
@@ -48,28 +26,17 @@ static void get_pixels_in_1d_short_array_by_block_2x2(uint16_t *y_src, int strid
     }
 }
 
-static int is_block_2x2_row_same_value(uint8_t *p) {
-    if (p[0] != p[1] || p[2] != p[3])
-        return 0;
-    return 1;
-}
-
-static int is_block16_2x2_row_same_value(uint16_t *p) {
-    if (p[0] != p[1] || p[2] != p[3])
-        return 0;
-    return 1;
-}
-
-static int is_block_2x2_col_same_value(uint8_t *p) {
-    if ((p[0] != p[2]) || (p[1] != p[3]))
-        return 0;
-    return 1;
+static INLINE uint32_t get_block_2x2_word(const uint8_t *p, int stride) {
+    return p[0] | (p[1] << 8) | (p[stride] << 16) | ((uint32_t)p[stride + 1] << 24);
 }
 
-static int is_block16_2x2_col_same_value(uint16_t *p) {
-    if ((p[0] != p[2]) || (p[1] != p[3]))
-        return 0;
-    return 1;
+// Hash a 2x2 block of 16-bit pixels, stored as two 32-bit words (one per row).
+static void get_block16_2x2_hash_value(const uint16_t *p, uint32_t *hash_value1, uint32_t *hash_value2) {
+    uint32_t words[2] = {p[0] | ((uint32_t)p[1] << 16), p[2] | ((uint32_t)p[3] << 16)};
+    *hash_value1      = svt_av1_get_crc32c_value(words, 2);
+    words[0]          = svt_av1_crc32c_hash2_word(words[0]);
+    words[1]          = svt_av1_crc32c_hash2_word(words[1]);
+    *hash_value2      = svt_av1_get_crc32c_value(words, 2);
 }
 
 // the hash value (hash_value1 consists two parts, the first 3 bits relate to
@@ -88,150 +55,177 @@ static int hash_block_size_to_index(int block_size) {
 }
 
 void svt_av1_hash_table_destroy(HashTable *p_hash_table) {
-    hash_table_clear_all(p_hash_table);
-    EB_FREE_ARRAY(p_hash_table->p_lookup_table);
-    p_hash_table->p_lookup_table = NULL;
+    EB_FREE_ARRAY(p_hash_table->bucket_start);
+    EB_FREE_ARRAY(p_hash_table->entries);
+    p_hash_table->entry_capacity = 0;
+    p_hash_table->entry_count    = 0;
+    p_hash_table->level_mask     = 0;
 }
 
 EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable *p_hash_table) {
-    EbErrorType err_code = EB_ErrorNone;
-    ;
-
-    if (p_hash_table->p_lookup_table != NULL) {
-        hash_table_clear_all(p_hash_table);
-        return err_code;
-    }
-    const int max_addr = 1 << (crc_bits + block_size_bits);
-    //p_hash_table->p_lookup_table = (Vector **)malloc(sizeof(p_hash_table->p_lookup_table[0]) * max_addr);
-    EB_CALLOC_ARRAY(p_hash_table->p_lookup_table, max_addr);
-
-    return err_code;
-}
-
-static void hash_table_add_to_table(HashTable *p_hash_table, uint32_t hash_value, BlockHash *curr_block_hash) {
-    if (p_hash_table->p_lookup_table[hash_value] == NULL) {
-        p_hash_table->p_lookup_table[hash_value] = malloc(sizeof(p_hash_table->p_lookup_table[0][0]));
-        svt_aom_vector_setup(p_hash_table->p_lookup_table[hash_value], 10, sizeof(curr_block_hash[0]));
-        svt_aom_vector_push_back(p_hash_table->p_lookup_table[hash_value], curr_block_hash);
-    } else {
-        svt_aom_vector_push_back(p_hash_table->p_lookup_table[hash_value], curr_block_hash);
-    }
+    // The buckets of a level are only valid once the level is added, so
+    // resetting the table for a new picture does not need to touch them.
+    p_hash_table->entry_count = 0;
+    p_hash_table->level_mask  = 0;
+    if (p_hash_table->bucket_start == NULL)
+        EB_MALLOC_ARRAY(p_hash_table->bucket_start, HASH_TABLE_LEVELS * HASH_TABLE_LEVEL_STRIDE);
+    return EB_ErrorNone;
 }
 
 int32_t svt_av1_hash_table_count(const HashTable *p_hash_table, uint32_t hash_value) {
-    if (p_hash_table->p_lookup_table[hash_value] == NULL) {
+    const uint32_t level = hash_value >> crc_bits;
+    if (!(p_hash_table->level_mask & (1 << level)))
         return 0;
-    } else
-        return (int32_t)(p_hash_table->p_lookup_table[hash_value]->size);
+    const uint32_t *start = p_hash_table->bucket_start + level * HASH_TABLE_LEVEL_STRIDE +
+        (hash_value & ((1 << crc_bits) - 1));
+    return (int32_t)(start[1] - start[0]);
 }
 
-Iterator svt_av1_hash_get_first_iterator(HashTable *p_hash_table, uint32_t hash_value) {
+const BlockHash *svt_av1_hash_get_first_block(const HashTable *p_hash_table, uint32_t hash_value) {
     assert(svt_av1_hash_table_count(p_hash_table, hash_value) > 0);
-    return svt_aom_vector_begin(p_hash_table->p_lookup_table[hash_value]);
+    const uint32_t level = hash_value >> crc_bits;
+    return p_hash_table->entries +
+        p_hash_table->bucket_start[level * HASH_TABLE_LEVEL_STRIDE + (hash_value & ((1 << crc_bits) - 1))];
+}
+
+void svt_av1_generate_block_2x2_hash_row_c(const uint8_t *src, int stride, int width, uint32_t *hash1,
+                                           uint32_t *hash2, int8_t *row_same, int8_t *col_same) {
+    for (int x_pos = 0; x_pos < width; x_pos++) {
+        const uint8_t *p = src + x_pos;
+        row_same[x_pos]  = p[0] == p[1] && p[stride] == p[stride + 1];
+        col_same[x_pos]  = p[0] == p[stride] && p[1] == p[stride + 1];
+
+        const uint32_t word = get_block_2x2_word(p, stride);
+        hash1[x_pos]        = svt_av1_crc32c_word_c(0xFFFFFFFF, word) ^ 0xFFFFFFFF;
+        hash2[x_pos] = svt_av1_crc32c_word_c(0xFFFFFFFF, svt_av1_crc32c_hash2_word(word)) ^ 0xFFFFFFFF;
+    }
+}
+
+void svt_av1_generate_block_hash_row_c(const uint32_t *src_hash1, const uint32_t *src_hash2, int src_size,
+                                       int stride, int width, uint32_t *dst_hash1, uint32_t *dst_hash2) {
+    const int below = src_size * stride;
+    for (int x_pos = 0; x_pos < width; x_pos++) {
+        uint32_t crc = 0xFFFFFFFF;
+        crc          = svt_av1_crc32c_word_c(crc, src_hash1[x_pos]);
+        crc          = svt_av1_crc32c_word_c(crc, src_hash1[x_pos + src_size]);
+        crc          = svt_av1_crc32c_word_c(crc, src_hash1[x_pos + below]);
+        crc          = svt_av1_crc32c_word_c(crc, src_hash1[x_pos + below + src_size]);
+        dst_hash1[x_pos] = crc ^ 0xFFFFFFFF;
+
+        crc              = 0xFFFFFFFF;
+        crc              = svt_av1_crc32c_word_c(crc, svt_av1_crc32c_hash2_word(src_hash2[x_pos]));
+        crc              = svt_av1_crc32c_word_c(crc, svt_av1_crc32c_hash2_word(src_hash2[x_pos + src_size]));
+        crc              = svt_av1_crc32c_word_c(crc, svt_av1_crc32c_hash2_word(src_hash2[x_pos + below]));
+        crc              = svt_av1_crc32c_word_c(crc, svt_av1_crc32c_hash2_word(src_hash2[x_pos + below + src_size]));
+        dst_hash2[x_pos] = crc ^ 0xFFFFFFFF;
+    }
 }
 
 void svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture, uint32_t *pic_block_hash[2],
-                                           int8_t *pic_block_same_info[3], PictureControlSet *pcs) {
-    const int width  = 2;
-    const int height = 2;
-    const int x_end  = picture->y_crop_width - width + 1;
-    const int y_end  = picture->y_crop_height - height + 1;
+                                           int8_t *pic_block_same_info[3], int y_start, int y_end) {
+    const int pic_width = picture->y_crop_width;
+    const int x_end     = picture->y_crop_width - 2 + 1;
+    y_end               = AOMMIN(y_end, picture->y_crop_height - 2 + 1);
 
-    const int length = width * 2;
     if (picture->flags & YV12_FLAG_HIGHBITDEPTH) {
         uint16_t p[4];
-        int      pos = 0;
-        for (int y_pos = 0; y_pos < y_end; y_pos++) {
+        for (int y_pos = y_start; y_pos < y_end; y_pos++) {
+            int pos = y_pos * pic_width;
             for (int x_pos = 0; x_pos < x_end; x_pos++) {
                 get_pixels_in_1d_short_array_by_block_2x2(
                     CONVERT_TO_SHORTPTR(picture->y_buffer) + y_pos * picture->y_stride + x_pos, picture->y_stride, p);
-                pic_block_same_info[0][pos] = is_block16_2x2_row_same_value(p);
-                pic_block_same_info[1][pos] = is_block16_2x2_col_same_value(p);
-
-                pic_block_hash[0][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
-                pic_block_hash[1][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
+                pic_block_same_info[0][pos] = p[0] == p[1] && p[2] == p[3];
+                pic_block_same_info[1][pos] = p[0] == p[2] && p[1] == p[3];
+                get_block16_2x2_hash_value(p, &pic_block_hash[0][pos], &pic_block_hash[1][pos]);
                 pos++;
             }
-            pos += width - 1;
         }
     } else {
-        uint8_t p[4];
-        int     pos = 0;
-        for (int y_pos = 0; y_pos < y_end; y_pos++) {
-            for (int x_pos = 0; x_pos < x_end; x_pos++) {
-                get_pixels_in_1d_char_array_by_block_2x2(
-                    picture->y_buffer + y_pos * picture->y_stride + x_pos, picture->y_stride, p);
-                pic_block_same_info[0][pos] = is_block_2x2_row_same_value(p);
-                pic_block_same_info[1][pos] = is_block_2x2_col_same_value(p);
-
-                pic_block_hash[0][pos] = svt_av1_get_crc_value(&pcs->crc_calculator1, p, length * sizeof(p[0]));
-                pic_block_hash[1][pos] = svt_av1_get_crc_value(&pcs->crc_calculator2, p, length * sizeof(p[0]));
-                pos++;
-            }
-            pos += width - 1;
+        for (int y_pos = y_start; y_pos < y_end; y_pos++) {
+            const int pos = y_pos * pic_width;
+            svt_av1_generate_block_2x2_hash_row(picture->y_buffer + y_pos * picture->y_stride,
+                                                picture->y_stride,
+                                                x_end,
+                                                &pic_block_hash[0][pos],
+                                                &pic_block_hash[1][pos],
+                                                &pic_block_same_info[0][pos],
+                                                &pic_block_same_info[1][pos]);
         }
     }
 }
 
 void svt_av1_generate_block_hash_value(const Yv12BufferConfig *picture, int block_size, uint32_t *src_pic_block_hash[2],
                                        uint32_t *dst_pic_block_hash[2], int8_t *src_pic_block_same_info[3],
-                                       int8_t *dst_pic_block_same_info[3], PictureControlSet *pcs) {
+                                       int8_t *dst_pic_block_same_info[3], int y_start, int y_end) {
     const int pic_width = picture->y_crop_width;
     const int x_end     = picture->y_crop_width - block_size + 1;
-    const int y_end     = picture->y_crop_height - block_size + 1;
-
-    const int src_size  = block_size >> 1;
-    const int quad_size = block_size >> 2;
-
-    uint32_t  p[4];
-    const int length = sizeof(p);
-
-    int pos = 0;
-    for (int y_pos = 0; y_pos < y_end; y_pos++) {
-        for (int x_pos = 0; x_pos < x_end; x_pos++) {
-            p[0]                       = src_pic_block_hash[0][pos];
-            p[1]                       = src_pic_block_hash[0][pos + src_size];
-            p[2]                       = src_pic_block_hash[0][pos + src_size * pic_width];
-            p[3]                       = src_pic_block_hash[0][pos + src_size * pic_width + src_size];
-            dst_pic_block_hash[0][pos] = svt_av1_get_crc_value(&pcs->crc_calculator1, (uint8_t *)p, length);
-
-            p[0]                       = src_pic_block_hash[1][pos];
-            p[1]                       = src_pic_block_hash[1][pos + src_size];
-            p[2]                       = src_pic_block_hash[1][pos + src_size * pic_width];
-            p[3]                       = src_pic_block_hash[1][pos + src_size * pic_width + src_size];
-            dst_pic_block_hash[1][pos] = svt_av1_get_crc_value(&pcs->crc_calculator2, (uint8_t *)p, length);
-
-            dst_pic_block_same_info[0][pos] = src_pic_block_same_info[0][pos] &&
-                src_pic_block_same_info[0][pos + quad_size] && src_pic_block_same_info[0][pos + src_size] &&
-                src_pic_block_same_info[0][pos + src_size * pic_width] &&
-                src_pic_block_same_info[0][pos + src_size * pic_width + quad_size] &&
-                src_pic_block_same_info[0][pos + src_size * pic_width + src_size];
-
-            dst_pic_block_same_info[1][pos] = src_pic_block_same_info[1][pos] &&
-                src_pic_block_same_info[1][pos + src_size] && src_pic_block_same_info[1][pos + quad_size * pic_width] &&
-                src_pic_block_same_info[1][pos + quad_size * pic_width + src_size] &&
-                src_pic_block_same_info[1][pos + src_size * pic_width] &&
-                src_pic_block_same_info[1][pos + src_size * pic_width + src_size];
-            pos++;
-        }
-        pos += block_size - 1;
+    y_end               = AOMMIN(y_end, picture->y_crop_height - block_size + 1);
+
+    const int src_size     = block_size >> 1;
+    const int quad_size    = block_size >> 2;
+    const int below        = src_size * pic_width;
+    const int size_minus_1 = block_size - 1;
+
+    for (int y_pos = y_start; y_pos < y_end; y_pos++) {
+        const int pos = y_pos * pic_width;
+        svt_av1_generate_block_hash_row(&src_pic_block_hash[0][pos],
+                                        &src_pic_block_hash[1][pos],
+                                        src_size,
+                                        pic_width,
+                                        x_end,
+                                        &dst_pic_block_hash[0][pos],
+                                        &dst_pic_block_hash[1][pos]);
+
+        // The same-info flags are 0/1, so the checks are written with bitwise
+        // operators to let the compiler vectorize them.
+        const int8_t *src_row = &src_pic_block_same_info[0][pos];
+        const int8_t *src_col = &src_pic_block_same_info[1][pos];
+        int8_t       *dst_row = &dst_pic_block_same_info[0][pos];
+        int8_t       *dst_col = &dst_pic_block_same_info[1][pos];
+        int8_t       *dst_add = &dst_pic_block_same_info[2][pos];
+        for (int x_pos = 0; x_pos < x_end; x_pos++)
+            dst_row[x_pos] = src_row[x_pos] & src_row[x_pos + quad_size] & src_row[x_pos + src_size] &
+                src_row[x_pos + below] & src_row[x_pos + below + quad_size] & src_row[x_pos + below + src_size];
+        for (int x_pos = 0; x_pos < x_end; x_pos++)
+            dst_col[x_pos] = src_col[x_pos] & src_col[x_pos + src_size] & src_col[x_pos + quad_size * pic_width] &
+                src_col[x_pos + quad_size * pic_width + src_size] & src_col[x_pos + below] &
+                src_col[x_pos + below + src_size];
+
+        // A block is added to the hash map when it is not flat in both
+        // directions, or when it is aligned to its size.
+        const int8_t row_aligned = (y_pos & size_minus_1) == 0;
+        for (int x_pos = 0; x_pos < x_end; x_pos++)
+            dst_add[x_pos] = (int8_t)(((dst_row[x_pos] | dst_col[x_pos]) ^ 1) |
+                                      (row_aligned & ((x_pos & size_minus_1) == 0)));
     }
+}
 
-    if (block_size >= 4) {
-        const int size_minus_1 = block_size - 1;
-        pos                    = 0;
-        for (int y_pos = 0; y_pos < y_end; y_pos++) {
-            for (int x_pos = 0; x_pos < x_end; x_pos++) {
-                dst_pic_block_same_info[2][pos] = (!dst_pic_block_same_info[0][pos] &&
-                                                   !dst_pic_block_same_info[1][pos]) ||
-                    (((x_pos & size_minus_1) == 0) && ((y_pos & size_minus_1) == 0));
-                pos++;
-            }
-            pos += block_size - 1;
-        }
-    }
+void svt_av1_generate_block_hash_band(const BlockHashLevel *level, uint16_t band_idx) {
+    const int y_count = level->picture.y_crop_height - level->block_size + 1;
+    const int y_start = y_count * band_idx / level->band_count;
+    const int y_end   = y_count * (band_idx + 1) / level->band_count;
+    if (level->block_size == 2)
+        svt_av1_generate_block_2x2_hash_value(
+            &level->picture, (uint32_t **)level->dst_hash, (int8_t **)level->dst_same_info, y_start, y_end);
+    else
+        svt_av1_generate_block_hash_value(&level->picture,
+                                          level->block_size,
+                                          (uint32_t **)level->src_hash,
+                                          (uint32_t **)level->dst_hash,
+                                          (int8_t **)level->src_same_info,
+                                          (int8_t **)level->dst_same_info,
+                                          y_start,
+                                          y_end);
+}
+
+// Grow the entry arena geometrically; it is kept for the next pictures.
+static EbErrorType hash_table_reserve(HashTable *p_hash_table, uint32_t count) {
+    if (count <= p_hash_table->entry_capacity)
+        return EB_ErrorNone;
+    const uint32_t capacity = AOMMAX(count, p_hash_table->entry_capacity + (p_hash_table->entry_capacity >> 1));
+    EB_REALLOC_ARRAY(p_hash_table->entries, capacity);
+    p_hash_table->entry_capacity = capacity;
+    return EB_ErrorNone;
 }
 
 void svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table, uint32_t *pic_hash[2],
@@ -243,33 +237,101 @@ void svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(HashTab
     const int8_t   *src_is_added = pic_is_same;
     const uint32_t *src_hash[2]  = {pic_hash[0], pic_hash[1]};
 
-    int add_value = hash_block_size_to_index(block_size);
-    assert(add_value >= 0);
-    add_value <<= crc_bits;
+    const int level = hash_block_size_to_index(block_size);
+    assert(level >= 0);
     const int crc_mask = (1 << crc_bits) - 1;
+    uint32_t *start    = p_hash_table->bucket_start + level * HASH_TABLE_LEVEL_STRIDE;
 
+    // Counting sort of the level in its buckets: count the entries of each
+    // bucket, turn the counts into end offsets, then fill the buckets from the
+    // back while walking the blocks backwards, which keeps each bucket in the
+    // column by column scan order of the blocks.
+    memset(start, 0, sizeof(*start) * HASH_TABLE_LEVEL_STRIDE);
     for (int x_pos = 0; x_pos < x_end; x_pos++) {
         for (int y_pos = 0; y_pos < y_end; y_pos++) {
+            const int pos = y_pos * pic_width + x_pos;
+            if (src_is_added[pos])
+                start[src_hash[0][pos] & crc_mask]++;
+        }
+    }
+    uint32_t end = p_hash_table->entry_count;
+    for (int i = 0; i <= crc_mask; i++) {
+        end += start[i];
+        start[i] = end;
+    }
+    start[crc_mask + 1] = end;
+
+    // On failure the level is simply left out of the table.
+    if (hash_table_reserve(p_hash_table, end) != EB_ErrorNone)
+        return;
+
+    BlockHash *entries = p_hash_table->entries;
+    for (int x_pos = x_end - 1; x_pos >= 0; x_pos--) {
+        for (int y_pos = y_end - 1; y_pos >= 0; y_pos--) {
             const int pos = y_pos * pic_width + x_pos;
             // valid data
             if (src_is_added[pos]) {
-                BlockHash curr_block_hash;
-                curr_block_hash.x = x_pos;
-                curr_block_hash.y = y_pos;
+                BlockHash *curr_block_hash   = &entries[--start[src_hash[0][pos] & crc_mask]];
+                curr_block_hash->x           = x_pos;
+                curr_block_hash->y           = y_pos;
+                curr_block_hash->hash_value2 = src_hash[1][pos];
+            }
+        }
+    }
+    p_hash_table->entry_count = end;
+    p_hash_table->level_mask |= 1 << level;
+}
 
-                const uint32_t hash_value1  = (src_hash[0][pos] & crc_mask) + add_value;
-                curr_block_hash.hash_value2 = src_hash[1][pos];
+EbErrorType svt_av1_build_picture_block_hash_map(HashTable *p_hash_table, const Yv12BufferConfig *picture,
+                                                 int block_size) {
+    const int pic_width  = picture->y_crop_width;
+    const int pic_height = picture->y_crop_height;
+    const int pic_size   = pic_width * pic_height;
+
+    svt_aom_rtime_alloc_svt_av1_hash_table_create(p_hash_table);
+    if (pic_width < block_size || pic_height < block_size)
+        return EB_ErrorNone;
+
+    // Two sets (source and destination level) of 2 hash and 3 same-info planes
+    uint8_t *scratch;
+    EB_MALLOC_ARRAY(scratch, (size_t)pic_size * 2 * (2 * sizeof(uint32_t) + 3 * sizeof(int8_t)));
+    uint32_t *block_hash_values[2][2];
+    int8_t   *is_block_same[2][3];
+    uint8_t  *buf = scratch;
+    for (int k = 0; k < 2; k++) {
+        for (int j = 0; j < 2; j++, buf += pic_size * sizeof(uint32_t)) block_hash_values[k][j] = (uint32_t *)buf;
+    }
+    for (int k = 0; k < 2; k++) {
+        for (int j = 0; j < 3; j++, buf += pic_size) is_block_same[k][j] = (int8_t *)buf;
+    }
 
-                hash_table_add_to_table(p_hash_table, hash_value1, &curr_block_hash);
-            }
+    BlockHashLevel level;
+    level.picture    = *picture;
+    level.band_count = 1;
+    uint8_t dst_idx  = 0;
+    for (int size = 2; size <= block_size; size <<= 1, dst_idx = !dst_idx) {
+        const uint8_t src_idx = !dst_idx;
+        level.block_size      = size;
+        for (int j = 0; j < 2; j++) {
+            level.src_hash[j] = block_hash_values[src_idx][j];
+            level.dst_hash[j] = block_hash_values[dst_idx][j];
         }
+        for (int j = 0; j < 3; j++) {
+            level.src_same_info[j] = is_block_same[src_idx][j];
+            level.dst_same_info[j] = is_block_same[dst_idx][j];
+        }
+        svt_av1_generate_block_hash_band(&level, 0);
     }
+    // only the requested block size goes in the table
+    svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(
+        p_hash_table, block_hash_values[!dst_idx], is_block_same[!dst_idx][2], pic_width, pic_height, block_size);
+
+    EB_FREE_ARRAY(scratch);
+    return EB_ErrorNone;
 }
 
 void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
-                                  uint32_t *hash_value2, int use_highbitdepth, struct PictureControlSet *pcs,
-                                  IntraBcContext *x) {
-    UNUSED(pcs);
+                                  uint32_t *hash_value2, int use_highbitdepth, uint32_t *hash_value_buffer[2][2]) {
     uint32_t  to_hash[4];
     const int add_value = hash_block_size_to_index(block_size) << crc_bits;
     assert(add_value >= 0);
@@ -285,23 +347,18 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
                 int pos = (y_pos >> 1) * sub_block_in_width + (x_pos >> 1);
                 get_pixels_in_1d_short_array_by_block_2x2(y16_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
+                get_block16_2x2_hash_value(pixel_to_hash, &hash_value_buffer[0][0][pos], &hash_value_buffer[1][0][pos]);
             }
         }
     } else {
-        uint8_t pixel_to_hash[4];
         for (int y_pos = 0; y_pos < block_size; y_pos += 2) {
             for (int x_pos = 0; x_pos < block_size; x_pos += 2) {
                 int pos = (y_pos >> 1) * sub_block_in_width + (x_pos >> 1);
-                get_pixels_in_1d_char_array_by_block_2x2(y_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, pixel_to_hash, sizeof(pixel_to_hash));
+                to_hash[0]                   = get_block_2x2_word(y_src + y_pos * stride + x_pos, stride);
+                to_hash[1]                   = svt_av1_crc32c_hash2_word(to_hash[0]);
+                hash_value_buffer[0][0][pos] = svt_av1_get_crc32c_value(&to_hash[0], 1);
+                hash_value_buffer[1][0][pos] = svt_av1_get_crc32c_value(&to_hash[1], 1);
             }
         }
     }
@@ -325,19 +382,18 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
                 assert(src_pos + 1 < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
                 assert(src_pos + src_sub_block_in_width + 1 < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
                 assert(dst_pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                to_hash[0] = x->hash_value_buffer[0][src_idx][src_pos];
-                to_hash[1] = x->hash_value_buffer[0][src_idx][src_pos + 1];
-                to_hash[2] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width];
-                to_hash[3] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width + 1];
-                x->hash_value_buffer[0][dst_idx][dst_pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, (uint8_t *)to_hash, sizeof(to_hash));
-
-                to_hash[0] = x->hash_value_buffer[1][src_idx][src_pos];
-                to_hash[1] = x->hash_value_buffer[1][src_idx][src_pos + 1];
-                to_hash[2] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width];
-                to_hash[3] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width + 1];
-                x->hash_value_buffer[1][dst_idx][dst_pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, (uint8_t *)to_hash, sizeof(to_hash));
+                to_hash[0] = hash_value_buffer[0][src_idx][src_pos];
+                to_hash[1] = hash_value_buffer[0][src_idx][src_pos + 1];
+                to_hash[2] = hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width];
+                to_hash[3] = hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width + 1];
+                hash_value_buffer[0][dst_idx][dst_pos] = svt_av1_get_crc32c_value(to_hash, 4);
+
+                to_hash[0] = svt_av1_crc32c_hash2_word(hash_value_buffer[1][src_idx][src_pos]);
+                to_hash[1] = svt_av1_crc32c_hash2_word(hash_value_buffer[1][src_idx][src_pos + 1]);
+                to_hash[2] = svt_av1_crc32c_hash2_word(hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width]);
+                to_hash[3] = svt_av1_crc32c_hash2_word(
+                    hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width + 1]);
+                hash_value_buffer[1][dst_idx][dst_pos] = svt_av1_get_crc32c_value(to_hash, 4);
                 dst_pos++;
             }
         }
@@ -346,6 +402,6 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
         sub_block_in_width >>= 1;
     }
 
-    *hash_value1 = (x->hash_value_buffer[0][dst_idx][0] & crc_mask) + add_value;
-    *hash_value2 = x->hash_value_buffer[1][dst_idx][0];
+    *hash_value1 = (hash_value_buffer[0][dst_idx][0] & crc_mask) + add_value;
+    *hash_value2 = hash_value_buffer[1][dst_idx][0];
 }
@@ -14,7 +14,6 @@
 
 #include "definitions.h"
 #include "coding_unit.h"
-#include "vector.h"
 #include "pic_buffer_desc.h"
 
 #ifdef __cplusplus
@@ -30,31 +29,65 @@ typedef struct _block_hash {
     uint32_t hash_value2;
 } BlockHash;
 
+// Number of block sizes (4x4 to 128x128) and of buckets per block size: the
+// low 16 bits of the first hash select the bucket.
+#define HASH_TABLE_LEVELS 6
+#define HASH_TABLE_LEVEL_STRIDE ((1 << 16) + 1)
+
+// The entries of all the blocks are stored in one arena, sorted by bucket, so
+// the candidates of a lookup are contiguous. bucket_start holds, per block
+// size, the offset of each bucket in the arena plus the end of the last one.
+// Both buffers are kept when the table is reset for the next picture.
 typedef struct HashTable {
-    Vector **p_lookup_table;
+    uint32_t  *bucket_start;
+    BlockHash *entries;
+    uint32_t   entry_count;
+    uint32_t   entry_capacity;
+    // block sizes added since the last reset
+    uint8_t level_mask;
 } HashTable;
 void        svt_av1_hash_table_destroy(HashTable *p_hash_table);
 EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable *p_hash_table);
 int32_t     svt_av1_hash_table_count(const HashTable *p_hash_table, uint32_t hash_value);
-Iterator    svt_av1_hash_get_first_iterator(HashTable *p_hash_table, uint32_t hash_value);
+const BlockHash *svt_av1_hash_get_first_block(const HashTable *p_hash_table, uint32_t hash_value);
 void        svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture, uint32_t *pic_block_hash[2],
-                                                  int8_t *pic_block_same_info[3], struct PictureControlSet *pcs);
+                                                  int8_t *pic_block_same_info[3], int y_start, int y_end);
 
 void svt_av1_generate_block_hash_value(const Yv12BufferConfig *picture, int block_size, uint32_t *src_pic_block_hash[2],
                                        uint32_t *dst_pic_block_hash[2], int8_t *src_pic_block_same_info[3],
-                                       int8_t *dst_pic_block_same_info[3], struct PictureControlSet *pcs);
+                                       int8_t *dst_pic_block_same_info[3], int y_start, int y_end);
+
+// One level of the picture block hash generation. The rows of a level are
+// independent, so a level can be split in bands processed by several threads.
+// block_size 2 is the 2x2 level, which reads the picture instead of src_*.
+typedef struct BlockHashLevel {
+    Yv12BufferConfig picture;
+    int              block_size;
+    uint32_t        *src_hash[2];
+    uint32_t        *dst_hash[2];
+    int8_t          *src_same_info[3];
+    int8_t          *dst_same_info[3];
+    uint16_t         band_count;
+} BlockHashLevel;
+void svt_av1_generate_block_hash_band(const BlockHashLevel *level, uint16_t band_idx);
 void svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table, uint32_t *pic_hash[2],
                                                                          int8_t *pic_is_same, int pic_width,
                                                                          int pic_height, int block_size);
 
+// Reset p_hash_table and fill it with the block_size x block_size blocks of the
+// luma plane of picture, generating all the levels up to block_size serially.
+EbErrorType svt_av1_build_picture_block_hash_map(HashTable *p_hash_table, const Yv12BufferConfig *picture,
+                                                 int block_size);
+
 // check whether the block starts from (x_start, y_start) with the size of
 // BlockSize x BlockSize has the same color in all rows
 
 // check whether the block starts from (x_start, y_start) with the size of
 // BlockSize x BlockSize has the same color in all columns
+// hash_value_buffer is the scratch space of the intermediate levels, each
+// buffer holds (block_size / 2)^2 values.
 void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
-                                  uint32_t *hash_value2, int use_highbitdepth, struct PictureControlSet *pcs,
-                                  struct IntraBcContext /*MACROBLOCK*/ *x);
+                                  uint32_t *hash_value2, int use_highbitdepth, uint32_t *hash_value_buffer[2][2]);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -194,6 +194,25 @@ uint8_t svt_aom_get_tpl_group_level(uint8_t tpl, int8_t enc_mode, SvtAv1RcMode r
     return tpl_group_level;
 }
 
+/*
+ * Get the resolution at which the TPL dispenser operates (see SequenceControlSet::tpl_ds_level).
+ * Only used for UHD inputs, where the full resolution TPL cost is the highest; the block grid and
+ * the propagated stats remain at full resolution.
+ */
+uint8_t svt_aom_get_tpl_ds_level(uint8_t tpl, int8_t enc_mode, EbInputResolution input_resolution, bool is_scale) {
+    uint8_t tpl_ds_level;
+    // The downsampled pictures of the scaled (superres/resize) references are not linked to TPL
+    if (!tpl || is_scale)
+        tpl_ds_level = 0;
+    else if (input_resolution >= INPUT_SIZE_8K_RANGE)
+        tpl_ds_level = enc_mode <= ENC_M4 ? 1 : 2;
+    else if (input_resolution >= INPUT_SIZE_4K_RANGE)
+        tpl_ds_level = enc_mode <= ENC_M6 ? 0 : 1;
+    else
+        tpl_ds_level = 0;
+    return tpl_ds_level;
+}
+
 uint8_t svt_aom_set_tpl_group(PictureParentControlSet *pcs, uint8_t tpl_group_level, uint32_t source_width,
                               uint32_t source_height) {
     TplControls  tpl_ctrls_struct = {0};
@@ -205,6 +224,7 @@ uint8_t svt_aom_set_tpl_group(PictureParentControlSet *pcs, uint8_t tpl_group_le
         tpl_ctrls->enable            = 1;
         tpl_ctrls->reduced_tpl_group = -1;
         tpl_ctrls->synth_blk_size    = 16;
+        tpl_ctrls->reuse_prev_group_stats = 0;
         break;
     case 2:
         tpl_ctrls->enable            = 1;
@@ -212,11 +232,13 @@ uint8_t svt_aom_set_tpl_group(PictureParentControlSet *pcs, uint8_t tpl_group_le
             : pcs->slice_type                        ? -1
                                                      : (pcs->hierarchical_levels == 5 ? 4 : 3);
         tpl_ctrls->synth_blk_size    = 16;
+        tpl_ctrls->reuse_prev_group_stats = 0;
         break;
     case 3:
         tpl_ctrls->enable            = 1;
         tpl_ctrls->reduced_tpl_group = (pcs == NULL) ? -1 : pcs->hierarchical_levels == 5 ? 4 : 3;
         tpl_ctrls->synth_blk_size    = 16;
+        tpl_ctrls->reuse_prev_group_stats = 0;
         break;
     case 4:
         tpl_ctrls->enable            = 1;
@@ -228,6 +250,7 @@ uint8_t svt_aom_set_tpl_group(PictureParentControlSet *pcs, uint8_t tpl_group_le
             : pcs->slice_type ? 3
                               : (pcs->scs->input_resolution <= INPUT_SIZE_480p_RANGE ? 2 : 0);
         tpl_ctrls->synth_blk_size    = AOMMIN(source_width, source_height) >= 720 ? 32 : 16;
+        tpl_ctrls->reuse_prev_group_stats = 0;
         break;
     default: assert(0); break;
     }
@@ -376,6 +399,8 @@ static void set_tpl_params(PictureParentControlSet *pcs, uint8_t tpl_level) {
         break;
     default: assert(0); break;
     }
+    // A downscaled TPL block must not be smaller than 16x16 at the downscaled resolution
+    tpl_ctrls->dispenser_search_level = MAX(tpl_ctrls->dispenser_search_level, scs->tpl_ds_level);
 }
 
 /*
@@ -221,6 +221,29 @@ static INLINE unsigned int svt_check_better_fast(MacroBlockD *xd, const struct A
     return cost;
 }
 
+// Updates best_mv with this_mv if its cost (prediction error plus mv cost) is
+// lower than besterr. Returns the cost of this_mv.
+static AOM_FORCE_INLINE unsigned int svt_update_best_subpel(const MV *this_mv, int thismse, unsigned int sse,
+                                                            MV *best_mv, const SUBPEL_SEARCH_VAR_PARAMS *var_params,
+                                                            const MV_COST_PARAMS *mv_cost_params,
+                                                            unsigned int *besterr, unsigned int *sse1, int *distortion,
+                                                            int *is_better) {
+    unsigned int cost = svt_mv_err_cost_(this_mv, mv_cost_params);
+    cost += thismse;
+    int weight = 100;
+    if (var_params->bias_fp && (*best_mv).col % 8 == 0 && (*best_mv).row % 8 == 0)
+        weight = BIAS_FP_WEIGHT;
+
+    if (((cost * weight) / 100) < *besterr) {
+        *besterr    = cost;
+        *best_mv    = *this_mv;
+        *distortion = thismse;
+        *sse1       = sse;
+        *is_better |= 1;
+    }
+    return cost;
+}
+
 // Checks whether this_mv is better than best_mv. This function incorporates
 // both prediction error and residue into account.
 static AOM_FORCE_INLINE unsigned int svt_check_better(MacroBlockD *xd, const struct AV1Common *const cm,
@@ -228,28 +251,68 @@ static AOM_FORCE_INLINE unsigned int svt_check_better(MacroBlockD *xd, const str
                                                       const SUBPEL_SEARCH_VAR_PARAMS *var_params,
                                                       const MV_COST_PARAMS *mv_cost_params, unsigned int *besterr,
                                                       unsigned int *sse1, int *distortion, int *is_better) {
-    unsigned int cost;
     if (svt_av1_is_subpelmv_in_range(mv_limits, *this_mv)) {
         unsigned int sse;
-        int          thismse;
-        thismse = svt_upsampled_pref_error(xd, cm, this_mv, var_params, &sse);
-        cost    = svt_mv_err_cost_(this_mv, mv_cost_params);
-        cost += thismse;
-        int weight = 100;
-        if (var_params->bias_fp && (*best_mv).col % 8 == 0 && (*best_mv).row % 8 == 0)
-            weight = BIAS_FP_WEIGHT;
+        const int    thismse = svt_upsampled_pref_error(xd, cm, this_mv, var_params, &sse);
+        return svt_update_best_subpel(
+            this_mv, thismse, sse, best_mv, var_params, mv_cost_params, besterr, sse1, distortion, is_better);
+    }
+    return INT_MAX;
+}
 
-        if (((cost * weight) / 100) < *besterr) {
-            *besterr    = cost;
-            *best_mv    = *this_mv;
-            *distortion = thismse;
-            *sse1       = sse;
-            *is_better |= 1;
-        }
+// Calculates the prediction error of two candidates that are one full pel
+// apart (horizontally, or vertically when vertical is set) and share the same
+// sub-pel phase, i.e. the left/right or up/down neighbours at the half-pel
+// step. Both predictions come out of one interpolation pass over a block that
+// is 4 columns (2 rows) larger, instead of one pass per candidate.
+static void svt_upsampled_pref_error_pair(MacroBlockD *xd, const struct AV1Common *const cm, const MV *first_mv,
+                                          int vertical, const SUBPEL_SEARCH_VAR_PARAMS *var_params, int err[2],
+                                          unsigned int sse[2]) {
+    const MSBuffers *ms_buffers = &var_params->ms_buffers;
+    const int        w          = var_params->w;
+    const int        h          = var_params->h;
+    const int        pred_w     = vertical ? w : w + 4;
+    const int        pred_h     = vertical ? h + 2 : h;
+    DECLARE_ALIGNED(16, uint8_t, pred[(MAX_SB_SIZE + 4) * (MAX_SB_SIZE + 2)]);
+
+    svt_aom_upsampled_pred(xd,
+                           cm,
+                           xd->mi_row,
+                           xd->mi_col,
+                           first_mv,
+                           pred,
+                           pred_w,
+                           pred_h,
+                           svt_get_subpel_part(first_mv->col),
+                           svt_get_subpel_part(first_mv->row),
+                           svt_get_buf_from_mv(ms_buffers->ref, *first_mv),
+                           ms_buffers->ref->stride,
+                           var_params->subpel_search_type);
+    err[0] = var_params->vfp->vf(pred, pred_w, ms_buffers->src->buf, ms_buffers->src->stride, &sse[0]);
+    err[1] = var_params->vfp->vf(
+        vertical ? pred + pred_w : pred + 1, pred_w, ms_buffers->src->buf, ms_buffers->src->stride, &sse[1]);
+}
+
+// Same as calling svt_check_better() on mvs[0] then mvs[1], with the two
+// predictions built by svt_upsampled_pref_error_pair().
+static AOM_FORCE_INLINE void svt_check_better_pair(MacroBlockD *xd, const struct AV1Common *const cm, const MV mvs[2],
+                                                   int vertical, MV *best_mv, const SubpelMvLimits *mv_limits,
+                                                   const SUBPEL_SEARCH_VAR_PARAMS *var_params,
+                                                   const MV_COST_PARAMS *mv_cost_params, unsigned int *besterr,
+                                                   unsigned int *sse1, int *distortion, unsigned int cost[2]) {
+    int dummy = 0;
+    if (svt_av1_is_subpelmv_in_range(mv_limits, mvs[0]) && svt_av1_is_subpelmv_in_range(mv_limits, mvs[1])) {
+        int          err[2];
+        unsigned int sse[2];
+        svt_upsampled_pref_error_pair(xd, cm, &mvs[0], vertical, var_params, err, sse);
+        for (int i = 0; i < 2; i++)
+            cost[i] = svt_update_best_subpel(
+                &mvs[i], err[i], sse[i], best_mv, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
     } else {
-        cost = INT_MAX;
+        for (int i = 0; i < 2; i++)
+            cost[i] = svt_check_better(
+                xd, cm, &mvs[i], best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
     }
-    return cost;
 }
 
 static INLINE MV svt_get_best_diag_step(int step_size, unsigned int left_cost, unsigned int right_cost,
@@ -270,15 +333,31 @@ static AOM_FORCE_INLINE MV svt_first_level_check(MacroBlockD *xd, const struct A
     const MV right_mv  = {this_mv.row, this_mv.col + hstep};
     const MV top_mv    = {this_mv.row - hstep, this_mv.col};
     const MV bottom_mv = {this_mv.row + hstep, this_mv.col};
-
-    const unsigned int left = svt_check_better(
-        xd, cm, &left_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
-    const unsigned int right = svt_check_better(
-        xd, cm, &right_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
-    const unsigned int up = svt_check_better(
-        xd, cm, &top_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
-    const unsigned int down = svt_check_better(
-        xd, cm, &bottom_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
+    unsigned int left, right, up, down;
+
+    // At the half-pel step both neighbours of a direction share the filter phase
+    if (hstep == INIT_SUBPEL_STEP_SIZE && var_params->w < MAX_SB_SIZE) {
+        const MV     hor_mvs[2] = {left_mv, right_mv};
+        const MV     ver_mvs[2] = {top_mv, bottom_mv};
+        unsigned int cost[2];
+        svt_check_better_pair(
+            xd, cm, hor_mvs, 0, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, cost);
+        left  = cost[0];
+        right = cost[1];
+        svt_check_better_pair(
+            xd, cm, ver_mvs, 1, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, cost);
+        up   = cost[0];
+        down = cost[1];
+    } else {
+        left = svt_check_better(
+            xd, cm, &left_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
+        right = svt_check_better(
+            xd, cm, &right_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
+        up = svt_check_better(
+            xd, cm, &top_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
+        down = svt_check_better(
+            xd, cm, &bottom_mv, best_mv, mv_limits, var_params, mv_cost_params, besterr, sse1, distortion, &dummy);
+    }
 
     const MV diag_step = svt_get_best_diag_step(hstep, left, right, up, down);
     const MV diag_mv   = {this_mv.row + diag_step.row, this_mv.col + diag_step.col};
@@ -30,6 +30,7 @@
 #include "enc_mode_config.h"
 #include "global_me.h"
 #include "aom_dsp_rtcd.h"
+#include "pic_demux_results.h"
 #define MAX_MESH_SPEED 5 // Max speed setting for mesh motion method
 static MeshPattern good_quality_mesh_patterns[MAX_MESH_SPEED + 1][MAX_MESH_STEP] = {
     {{64, 8}, {28, 4}, {15, 1}, {7, 1}},
@@ -292,6 +293,12 @@ void set_reference_sg_ep(PictureControlSet *pcs) {
     memset(cm->sg_frame_ep_cnt, 0, SGRPROJ_PARAMS * sizeof(int32_t));
     cm->sg_frame_ep = 0;
 
+    // The references may still be in progress under the cross-picture wavefront
+    if (pcs->scs->cross_pic_wavefront) {
+        cm->sg_ref_frame_ep[0] = -1;
+        cm->sg_ref_frame_ep[1] = -1;
+        return;
+    }
     // NADER: set cm->sg_ref_frame_ep[0] = cm->sg_ref_frame_ep[1] = -1 to perform all iterations
     switch (pcs->slice_type) {
     case I_SLICE:
@@ -365,7 +372,7 @@ static void mode_decision_configuration_context_dctor(EbPtr p) {
  ******************************************************/
 EbErrorType svt_aom_mode_decision_configuration_context_ctor(EbThreadContext   *thread_ctx,
                                                              const EbEncHandle *enc_handle_ptr, int input_index,
-                                                             int output_index) {
+                                                             int output_index, int demux_index) {
     ModeDecisionConfigurationContext *context_ptr;
     EB_CALLOC_ARRAY(context_ptr, 1);
     thread_ctx->priv  = context_ptr;
@@ -376,6 +383,8 @@ EbErrorType svt_aom_mode_decision_configuration_context_ctor(EbThreadContext   *
         enc_handle_ptr->rate_control_results_resource_ptr, input_index);
     context_ptr->mode_decision_configuration_output_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->enc_dec_tasks_resource_ptr, output_index);
+    context_ptr->picture_demux_fifo_ptr = svt_system_resource_get_producer_fifo(
+        enc_handle_ptr->picture_demux_results_resource_ptr, demux_index);
     return EB_ErrorNone;
 }
 
@@ -573,6 +582,92 @@ static void av1_setup_motion_field(Av1Common *cm, PictureControlSet *pcs) {
 }
 EbErrorType svt_av1_hash_table_create(HashTable *p_hash_table);
 void       *rtime_alloc_block_hash_block_is_same(size_t size) { return malloc(size); }
+
+/*
+ * Build the IntraBC hash map of the picture. The block hashes are generated one
+ * level (block size) at a time. When there are several EncDec threads, the rows
+ * of each level are split in bands processed by the EncDec threads, and the
+ * hash map insertion of a level is done here while the next level is generated.
+ */
+static void generate_intrabc_hash_map(PictureControlSet *pcs, ModeDecisionConfigurationContext *context_ptr,
+                                      EbObjectWrapper *pcs_wrapper) {
+    const int pic_width  = pcs->ppcs->aligned_width;
+    const int pic_height = pcs->ppcs->aligned_height;
+
+    uint32_t *block_hash_values[2][2];
+    int8_t   *is_block_same[2][3];
+    int       k, j;
+
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < 2; j++)
+            block_hash_values[k][j] = rtime_alloc_block_hash_block_is_same(sizeof(uint32_t) * pic_width * pic_height);
+        for (j = 0; j < 3; j++)
+            is_block_same[k][j] = rtime_alloc_block_hash_block_is_same(sizeof(int8_t) * pic_width * pic_height);
+    }
+    svt_aom_rtime_alloc_svt_av1_hash_table_create(&pcs->hash_table);
+
+    BlockHashLevel *level = &pcs->hash_level;
+    svt_aom_link_eb_to_aom_buffer_desc_8bit(pcs->ppcs->enhanced_pic, &level->picture);
+    // bands of at least 32 rows
+    level->band_count = (uint16_t)CLIP3(1, (int)pcs->scs->enc_dec_process_init_count, pic_height / 32);
+
+    const uint8_t max_sb_size = pcs->ppcs->intraBC_ctrls.max_block_size_hash;
+    uint8_t       dst_idx     = 0;
+    int           prev_size   = 0;
+    for (int size = 2; size <= max_sb_size; size <<= 1, dst_idx = !dst_idx) {
+        const uint8_t src_idx = !dst_idx;
+        level->block_size     = size;
+        for (j = 0; j < 2; j++) {
+            level->src_hash[j] = block_hash_values[src_idx][j];
+            level->dst_hash[j] = block_hash_values[dst_idx][j];
+        }
+        for (j = 0; j < 3; j++) {
+            level->src_same_info[j] = is_block_same[src_idx][j];
+            level->dst_same_info[j] = is_block_same[dst_idx][j];
+        }
+
+        if (level->band_count > 1) {
+            pcs->hash_bands_done = 0;
+            for (uint16_t band_idx = 0; band_idx < level->band_count; band_idx++) {
+                EbObjectWrapper *enc_dec_tasks_wrapper;
+                svt_get_empty_object(context_ptr->mode_decision_configuration_output_fifo_ptr,
+                                     &enc_dec_tasks_wrapper);
+                EncDecTasks *enc_dec_tasks         = (EncDecTasks *)enc_dec_tasks_wrapper->object_ptr;
+                enc_dec_tasks->pcs_wrapper         = pcs_wrapper;
+                enc_dec_tasks->input_type          = ENCDEC_TASKS_HASH_INPUT;
+                enc_dec_tasks->enc_dec_segment_row = (int16_t)band_idx;
+                enc_dec_tasks->tile_group_index    = 0;
+                svt_post_full_object(enc_dec_tasks_wrapper);
+            }
+        } else
+            svt_av1_generate_block_hash_band(level, 0);
+
+        // The previous level is only read by the current one, so it can be
+        // added to the hash map in the meantime.
+        if (prev_size >= 4 && (prev_size != 4 || pcs->ppcs->intraBC_ctrls.hash_4x4_blocks))
+            svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(&pcs->hash_table,
+                                                                                block_hash_values[src_idx],
+                                                                                is_block_same[src_idx][2],
+                                                                                pic_width,
+                                                                                pic_height,
+                                                                                prev_size);
+        if (level->band_count > 1)
+            svt_block_on_semaphore(pcs->hash_done_semaphore);
+        prev_size = size;
+    }
+    if (prev_size >= 4 && (prev_size != 4 || pcs->ppcs->intraBC_ctrls.hash_4x4_blocks))
+        svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(&pcs->hash_table,
+                                                                            block_hash_values[!dst_idx],
+                                                                            is_block_same[!dst_idx][2],
+                                                                            pic_width,
+                                                                            pic_height,
+                                                                            prev_size);
+
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < 2; j++) free(block_hash_values[k][j]);
+        for (j = 0; j < 3; j++) free(is_block_same[k][j]);
+    }
+}
 int32_t     svt_aom_noise_log1p_fp16(int32_t noise_level_fp16);
 /* Determine the frame complexity level (stored under pcs->coeff_lvl) based
 on the ME distortion and QP. */
@@ -660,6 +755,41 @@ static void set_frame_coeff_lvl(PictureControlSet *pcs) {
  *  Initializations for various flags and variables
  *
  ********************************************************************************/
+/******************************************************
+* Cross-picture wavefront: publish the reference object data read by the pictures referencing this
+* one before they start (the reconstructed rows are published by EncDec as they complete), then let
+* the picture manager start those pictures
+******************************************************/
+static void start_wavefront_reference(ModeDecisionConfigurationContext *context_ptr, PictureControlSet *pcs) {
+    PictureParentControlSet *ppcs = pcs->ppcs;
+    EbReferenceObject       *obj  = (EbReferenceObject *)ppcs->ref_pic_wrapper->object_ptr;
+
+    obj->ref_poc         = ppcs->picture_number;
+    obj->qp              = (uint8_t)ppcs->picture_qp;
+    obj->slice_type      = ppcs->slice_type;
+    obj->r0              = ppcs->r0;
+    obj->tmp_layer_idx   = (uint8_t)pcs->temporal_layer_index;
+    obj->is_scene_change = ppcs->scene_change_flag;
+    // CDEF and restoration are off for the references of the wavefront
+    obj->ref_cdef_strengths_num   = 1;
+    obj->ref_cdef_strengths[0][0] = 0;
+    obj->ref_cdef_strengths[1][0] = 0;
+    obj->sg_frame_ep              = 0;
+    for (uint32_t sb_index = 0; sb_index < pcs->b64_total_count; ++sb_index) {
+        obj->sb_me_64x64_dist[sb_index]   = ppcs->me_64x64_distortion[sb_index];
+        obj->sb_me_8x8_cost_var[sb_index] = ppcs->me_8x8_cost_variance[sb_index];
+    }
+
+    EbObjectWrapper *picture_demux_results_wrapper;
+    svt_get_empty_object(context_ptr->picture_demux_fifo_ptr, &picture_demux_results_wrapper);
+    PictureDemuxResults *picture_demux_results = (PictureDemuxResults *)picture_demux_results_wrapper->object_ptr;
+    picture_demux_results->ref_pic_wrapper     = ppcs->ref_pic_wrapper;
+    picture_demux_results->scs                 = pcs->scs;
+    picture_demux_results->picture_number      = pcs->picture_number;
+    picture_demux_results->picture_type        = EB_PIC_REFERENCE_STARTED;
+    svt_post_full_object(picture_demux_results_wrapper);
+}
+
 void *svt_aom_mode_decision_configuration_kernel(void *input_ptr) {
     // Context & SCS & PCS
     EbThreadContext                  *thread_ctx  = (EbThreadContext *)input_ptr;
@@ -800,55 +930,7 @@ void *svt_aom_mode_decision_configuration_kernel(void *input_ptr) {
                 }
             }
 
-            {
-                // add to hash table
-                const int pic_width  = pcs->ppcs->aligned_width;
-                const int pic_height = pcs->ppcs->aligned_height;
-
-                uint32_t *block_hash_values[2][2];
-                int8_t   *is_block_same[2][3];
-                int       k, j;
-
-                for (k = 0; k < 2; k++) {
-                    for (j = 0; j < 2; j++)
-                        block_hash_values[k][j] = rtime_alloc_block_hash_block_is_same(sizeof(uint32_t) * pic_width *
-                                                                                       pic_height);
-                    for (j = 0; j < 3; j++)
-                        is_block_same[k][j] = rtime_alloc_block_hash_block_is_same(sizeof(int8_t) * pic_width *
-                                                                                   pic_height);
-                }
-                svt_aom_rtime_alloc_svt_av1_hash_table_create(&pcs->hash_table);
-                Yv12BufferConfig cpi_source;
-                svt_aom_link_eb_to_aom_buffer_desc_8bit(pcs->ppcs->enhanced_pic, &cpi_source);
-
-                svt_av1_crc_calculator_init(&pcs->crc_calculator1, 24, 0x5D6DCB);
-                svt_av1_crc_calculator_init(&pcs->crc_calculator2, 24, 0x864CFB);
-
-                svt_av1_generate_block_2x2_hash_value(&cpi_source, block_hash_values[0], is_block_same[0], pcs);
-                uint8_t       src_idx     = 0;
-                const uint8_t max_sb_size = pcs->ppcs->intraBC_ctrls.max_block_size_hash;
-                for (int size = 4; size <= max_sb_size; size <<= 1, src_idx = !src_idx) {
-                    const uint8_t dst_idx = !src_idx;
-                    svt_av1_generate_block_hash_value(&cpi_source,
-                                                      size,
-                                                      block_hash_values[src_idx],
-                                                      block_hash_values[dst_idx],
-                                                      is_block_same[src_idx],
-                                                      is_block_same[dst_idx],
-                                                      pcs);
-                    if (size != 4 || pcs->ppcs->intraBC_ctrls.hash_4x4_blocks)
-                        svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(&pcs->hash_table,
-                                                                                            block_hash_values[dst_idx],
-                                                                                            is_block_same[dst_idx][2],
-                                                                                            pic_width,
-                                                                                            pic_height,
-                                                                                            size);
-                }
-                for (k = 0; k < 2; k++) {
-                    for (j = 0; j < 2; j++) free(block_hash_values[k][j]);
-                    for (j = 0; j < 3; j++) free(is_block_same[k][j]);
-                }
-            }
+            generate_intrabc_hash_map(pcs, context_ptr, rc_results->pcs_wrapper);
 
             svt_av1_init3smotion_compensation(&pcs->ss_cfg, pcs->ppcs->enhanced_pic->stride_y);
         }
@@ -960,6 +1042,9 @@ void *svt_aom_mode_decision_configuration_kernel(void *input_ptr) {
             pcs->ppcs->enable_restoration = 0;
         }
 
+        if (scs->cross_pic_wavefront && pcs->ppcs->is_ref && !rc_results->superres_recode)
+            start_wavefront_reference(context_ptr, pcs);
+
         // Post the results to the MD processes
         uint16_t tg_count = pcs->ppcs->tile_group_cols * pcs->ppcs->tile_group_rows;
         for (uint16_t tile_group_idx = 0; tile_group_idx < tg_count; tile_group_idx++) {
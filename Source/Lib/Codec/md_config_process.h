@@ -40,6 +40,7 @@ typedef struct MdcpLocalBlkStruct {
 typedef struct ModeDecisionConfigurationContext {
     EbFifo *rate_control_input_fifo_ptr;
     EbFifo *mode_decision_configuration_output_fifo_ptr;
+    EbFifo *picture_demux_fifo_ptr;
     uint8_t qp;
     uint8_t qp_index;
 } ModeDecisionConfigurationContext;
@@ -49,7 +50,7 @@ typedef struct ModeDecisionConfigurationContext {
  **************************************/
 EbErrorType svt_aom_mode_decision_configuration_context_ctor(EbThreadContext   *thread_ctx,
                                                              const EbEncHandle *enc_handle_ptr, int input_index,
-                                                             int output_index);
+                                                             int output_index, int demux_index);
 
 extern void *svt_aom_mode_decision_configuration_kernel(void *input_ptr);
 
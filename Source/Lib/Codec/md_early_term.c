@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+//for getenv and fopen on windows
+#if defined(_WIN32) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "md_early_term.h"
+#include "md_early_term_weights.h"
+#include "bitstream_unit.h"
+#include "sequence_control_set.h"
+#include "svt_threads.h"
+#include "svt_log.h"
+
+static const EtmModel *const etm_models[ETM_MODEL_COUNT] = {&etm_split_model, &etm_nsq_model};
+
+static const char *const etm_feature_names[ETM_FEATURE_COUNT] = {"sq_size_log2",
+                                                                 "shape",
+                                                                 "qindex",
+                                                                 "temporal_layer",
+                                                                 "intra_pic",
+                                                                 "cost_log2",
+                                                                 "cost_ratio",
+                                                                 "nz_coeff_perc",
+                                                                 "me_dist_log2",
+                                                                 "me_var_log2",
+                                                                 "neigh_size_log2"};
+
+int32_t svt_aom_etm_score(const EtmModel *model, const int32_t *features) {
+    int32_t score = model->bias;
+    for (uint16_t t = 0; t < model->tree_count; t++) {
+        const EtmNode *node = &model->nodes[model->roots[t]];
+        while (node->feature >= 0)
+            node = &model->nodes[features[node->feature] <= node->value ? node->left : node->right];
+        score += node->value;
+    }
+    return score;
+}
+
+// log2 in Q4: the integer part is the MSB position, the fraction the next 4 bits
+static int32_t log2_q4(uint64_t v) {
+    if (!v)
+        return 0;
+    const int32_t msb  = (v >> 32) ? 32 + get_msb((uint32_t)(v >> 32)) : get_msb((uint32_t)v);
+    const int32_t frac = msb >= 4 ? (int32_t)((v >> (msb - 4)) & 15) : (int32_t)((v << (4 - msb)) & 15);
+    return (msb << 4) + frac;
+}
+
+// Mean log2 width of the blocks coded left of and above the SB, at the position of the current block.
+// Only already coded SBs of the same tile are used, so the feature does not depend on the SB processing order.
+static int32_t get_neigh_size_log2(PictureControlSet *pcs, ModeDecisionContext *ctx, const BlockGeom *blk_geom) {
+    const TileInfo *tile      = &ctx->sb_ptr->tile_info;
+    const int32_t   sb_mi_row = ctx->sb_origin_y >> MI_SIZE_LOG2;
+    const int32_t   sb_mi_col = ctx->sb_origin_x >> MI_SIZE_LOG2;
+    const int32_t   mi_row    = (ctx->sb_origin_y + blk_geom->org_y) >> MI_SIZE_LOG2;
+    const int32_t   mi_col    = (ctx->sb_origin_x + blk_geom->org_x) >> MI_SIZE_LOG2;
+    int32_t         sum = 0, cnt = 0;
+
+    if (sb_mi_col > tile->mi_col_start && ctx->sb_origin_y + blk_geom->org_y < pcs->ppcs->aligned_height) {
+        const BlockSize bsize = pcs->mi_grid_base[mi_row * pcs->mi_stride + sb_mi_col - 1]->mbmi.block_mi.bsize;
+        sum += mi_size_wide_log2[bsize] + MI_SIZE_LOG2;
+        cnt++;
+    }
+    if (sb_mi_row > tile->mi_row_start && ctx->sb_origin_x + blk_geom->org_x < pcs->ppcs->aligned_width) {
+        const BlockSize bsize = pcs->mi_grid_base[(sb_mi_row - 1) * pcs->mi_stride + mi_col]->mbmi.block_mi.bsize;
+        sum += mi_size_wide_log2[bsize] + MI_SIZE_LOG2;
+        cnt++;
+    }
+    return cnt ? (sum << 1) / cnt : 0;
+}
+
+// Features of the SQ block sq_mds; cost_ratio is model specific
+static void get_features(PictureControlSet *pcs, ModeDecisionContext *ctx, uint32_t sq_mds, Part shape,
+                         int32_t cost_ratio, int32_t *features) {
+    const BlockGeom *sq_geom = get_blk_geom_mds(sq_mds);
+    const BlkStruct *sq_blk  = &ctx->md_blk_arr_nsq[sq_mds];
+    const int32_t    size_log2 = get_msb(sq_geom->sq_size);
+    const Bool       is_islice = pcs->slice_type == I_SLICE;
+
+    features[ETM_F_SQ_SIZE_LOG2]   = size_log2;
+    features[ETM_F_SHAPE]          = shape;
+    features[ETM_F_QINDEX]         = ctx->qp_index;
+    features[ETM_F_TEMPORAL_LAYER] = pcs->temporal_layer_index;
+    features[ETM_F_INTRA_PIC]      = is_islice;
+    features[ETM_F_COST_LOG2]      = log2_q4(sq_blk->default_cost) - (size_log2 << 5);
+    features[ETM_F_COST_RATIO]     = cost_ratio;
+    // cnt_nz_coeff is not derived by the very light PD0
+    features[ETM_F_NZ_COEFF_PERC] = ctx->pd_pass == PD_PASS_0 && ctx->lpd0_ctrls.pd0_level == VERY_LIGHT_PD0
+        ? -1
+        : (int32_t)((sq_blk->cnt_nz_coeff * 100) >> (size_log2 << 1));
+    features[ETM_F_ME_DIST_LOG2] = is_islice ? 0 : log2_q4(pcs->ppcs->me_64x64_distortion[ctx->sb_index]) - (12 << 4);
+    features[ETM_F_ME_VAR_LOG2]  = is_islice ? 0 : log2_q4(pcs->ppcs->me_8x8_cost_variance[ctx->sb_index]);
+    features[ETM_F_NEIGH_SIZE_LOG2] = get_neigh_size_log2(pcs, ctx, sq_geom);
+}
+
+static void add_sample(ModeDecisionContext *ctx, EtmModelType model, uint32_t blk_mds, const int32_t *features) {
+    assert(ctx->etm_sample_count < ctx->init_max_block_cnt);
+    EtmSample *sample = &ctx->etm_samples[ctx->etm_sample_count++];
+    sample->model     = model;
+    sample->blk_mds   = blk_mds;
+    memcpy(sample->features, features, sizeof(sample->features));
+}
+
+/*
+ * Return true if the sub-depth(s) of the PD0 block blk_mds should not be tested in PD1. The block must have
+ * been tested in PD0 (avail_blk_flag set).
+ */
+bool svt_aom_etm_prune_sub_depth(PictureControlSet *pcs, ModeDecisionContext *ctx, uint32_t blk_mds) {
+    const uint8_t level = pcs->scs->md_early_term_level;
+    if ((!level && !ctx->etm_samples) || ctx->hbd_md)
+        return false;
+
+    const BlockGeom *blk_geom     = get_blk_geom_mds(blk_mds);
+    const uint32_t   ns_d1_offset = blk_geom->d1_depth_offset;
+    const uint32_t   ns_depth_plus1_offset = ns_depth_offset[blk_geom->svt_aom_geom_idx][blk_geom->depth + 1];
+    const uint64_t   cost                  = ctx->md_blk_arr_nsq[blk_mds].default_cost;
+    uint64_t         child_cost            = 0;
+    uint8_t          child_cnt             = 0;
+    uint32_t         child_mds             = blk_mds + ns_d1_offset;
+    for (int i = 0; i < 4; i++, child_mds += ns_depth_plus1_offset) {
+        if (ctx->avail_blk_flag[child_mds]) {
+            child_cost += ctx->md_blk_arr_nsq[child_mds].default_cost;
+            child_cnt++;
+        }
+    }
+    // Children cost relative to the current block, capped to 400% (also used when no child was tested)
+    const int32_t cost_ratio = child_cnt && cost ? (int32_t)MIN(((child_cost * 4 / child_cnt) * 100) / cost, 400)
+                                                 : 400;
+    int32_t       features[ETM_FEATURE_COUNT];
+    get_features(pcs, ctx, blk_mds, PART_N, cost_ratio, features);
+
+    if (level && svt_aom_etm_score(etm_models[ETM_SPLIT], features) >= etm_models[ETM_SPLIT]->th[level - 1])
+        return true;
+    if (ctx->etm_samples)
+        add_sample(ctx, ETM_SPLIT, blk_mds, features);
+    return false;
+}
+
+/*
+ * Return true if the NSQ shape of the current block (first block of the shape) should not be tested. The
+ * SQ block must have been tested.
+ */
+bool svt_aom_etm_skip_nsq_shape(PictureControlSet *pcs, ModeDecisionContext *ctx) {
+    const uint8_t level = pcs->scs->md_early_term_level;
+    if ((!level && !ctx->etm_samples) || ctx->hbd_md || ctx->pd_pass != PD_PASS_1)
+        return false;
+
+    const BlockGeom *blk_geom = ctx->blk_geom;
+    const uint32_t   sq_mds   = blk_geom->sqi_mds;
+    if (!ctx->avail_blk_flag[sq_mds])
+        return false;
+
+    // Best cost of the shapes tested so far (including the SQ block) relative to the SQ block cost
+    const BlkStruct *sq_blk     = &ctx->md_blk_arr_nsq[sq_mds];
+    const int32_t    cost_ratio = sq_blk->default_cost
+           ? (int32_t)MIN((sq_blk->cost * 100) / sq_blk->default_cost, 400)
+           : 100;
+    int32_t features[ETM_FEATURE_COUNT];
+    get_features(pcs, ctx, sq_mds, blk_geom->shape, cost_ratio, features);
+
+    if (level && svt_aom_etm_score(etm_models[ETM_NSQ], features) >= etm_models[ETM_NSQ]->th[level - 1])
+        return true;
+    if (ctx->etm_samples)
+        add_sample(ctx, ETM_NSQ, sq_mds, features);
+    return false;
+}
+
+/*
+ * Write the samples of the SB to the feature dump, labelled with the PD1 decision; called once PD1 is done.
+ * The label is 1 when the search the model would prune was useful: the block was split (ETM_SPLIT), or the
+ * shape was selected for the SQ block (ETM_NSQ).
+ */
+void svt_aom_etm_dump_samples(PictureControlSet *pcs, ModeDecisionContext *ctx) {
+    EncodeContext *enc_ctx = pcs->scs->enc_ctx;
+    char           line[256];
+
+    svt_block_on_mutex(enc_ctx->etm_dump_mutex);
+    for (uint16_t s = 0; s < ctx->etm_sample_count; s++) {
+        const EtmSample *sample = &ctx->etm_samples[s];
+        const BlkStruct *blk    = &ctx->md_blk_arr_nsq[sample->blk_mds];
+        const int        label  = sample->model == ETM_SPLIT
+                    ? blk->split_flag
+                    : blk->part == from_shape_to_part[sample->features[ETM_F_SHAPE]];
+        int len = snprintf(line, sizeof(line), "%d,%d", sample->model, label);
+        for (int f = 0; f < ETM_FEATURE_COUNT; f++)
+            len += snprintf(line + len, sizeof(line) - len, ",%d", sample->features[f]);
+        fprintf(enc_ctx->etm_dump_file, "%s\n", line);
+    }
+    svt_release_mutex(enc_ctx->etm_dump_mutex);
+    ctx->etm_sample_count = 0;
+}
+
+/*
+ * Open the feature dump named by ETM_DUMP_ENV, if set, and write the CSV header.
+ */
+FILE *svt_aom_etm_open_dump(void) {
+    const char *path = getenv(ETM_DUMP_ENV);
+    if (!path)
+        return NULL;
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        SVT_WARN("Could not open the MD early termination feature dump %s\n", path);
+        return NULL;
+    }
+    fprintf(file, "model,label");
+    for (int f = 0; f < ETM_FEATURE_COUNT; f++) fprintf(file, ",%s", etm_feature_names[f]);
+    fprintf(file, "\n");
+    return file;
+}
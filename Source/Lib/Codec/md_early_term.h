@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#ifndef EbMdEarlyTerm_h
+#define EbMdEarlyTerm_h
+
+#include <stdio.h>
+#include "pcs.h"
+#include "md_process.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Environment variable holding the path of the MD early termination feature dump (CSV)
+#define ETM_DUMP_ENV "SVT_ETM_DUMP_FILE"
+// Number of operating points (thresholds) of each model; index is md_early_term_level - 1
+#define ETM_LEVELS 2
+
+typedef enum EtmModelType {
+    ETM_SPLIT, // the PD0 block does not need its sub-depth tested in PD1
+    ETM_NSQ, // the NSQ shape will not be selected over the SQ block
+    ETM_MODEL_COUNT
+} EtmModelType;
+
+// Integer features shared by all models. Costs and ME data use log2 in Q4.
+typedef enum EtmFeature {
+    ETM_F_SQ_SIZE_LOG2, // log2 of the square block size
+    ETM_F_SHAPE, // shape of the NSQ block (PART_N for ETM_SPLIT)
+    ETM_F_QINDEX, // MD qindex of the SB
+    ETM_F_TEMPORAL_LAYER, // temporal layer of the picture
+    ETM_F_INTRA_PIC, // 1 for I_SLICE pictures
+    ETM_F_COST_LOG2, // cost per sample of the SQ block
+    ETM_F_COST_RATIO, // ETM_SPLIT: children / current cost, ETM_NSQ: best shape so far / SQ cost (percent)
+    ETM_F_NZ_COEFF_PERC, // non-zero coefficients of the SQ block in percent of its area; -1 if unknown
+    ETM_F_ME_DIST_LOG2, // 64x64 ME distortion per sample of the SB; 0 for I_SLICE pictures
+    ETM_F_ME_VAR_LOG2, // variance of the 8x8 ME costs of the SB; 0 for I_SLICE pictures
+    ETM_F_NEIGH_SIZE_LOG2, // mean log2 size of the coded left/above SB neighbours in Q1; 0 if none
+    ETM_FEATURE_COUNT
+} EtmFeature;
+
+// Tree node: an inner node sends the features with features[feature] <= value to left, the others to
+// right; a leaf (feature < 0) adds value to the score.
+typedef struct EtmNode {
+    int8_t   feature;
+    int32_t  value;
+    uint16_t left;
+    uint16_t right;
+} EtmNode;
+
+// Sum of trees (gradient-boosted) model; the score is a logit in Q8, and the decision is positive
+// when the score reaches th[level - 1].
+typedef struct EtmModel {
+    const EtmNode  *nodes;
+    const uint16_t *roots;
+    uint16_t        tree_count;
+    int32_t         bias;
+    int32_t         th[ETM_LEVELS];
+} EtmModel;
+
+// Sample kept for the feature dump until the PD1 decision (label) of the SB is known
+typedef struct EtmSample {
+    uint8_t  model;
+    uint16_t blk_mds;
+    int32_t  features[ETM_FEATURE_COUNT];
+} EtmSample;
+
+int32_t svt_aom_etm_score(const EtmModel *model, const int32_t *features);
+bool    svt_aom_etm_prune_sub_depth(PictureControlSet *pcs, ModeDecisionContext *ctx, uint32_t blk_mds);
+bool    svt_aom_etm_skip_nsq_shape(PictureControlSet *pcs, ModeDecisionContext *ctx);
+void    svt_aom_etm_dump_samples(PictureControlSet *pcs, ModeDecisionContext *ctx);
+FILE   *svt_aom_etm_open_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbMdEarlyTerm_h
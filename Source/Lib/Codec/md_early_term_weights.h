@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+// Generated by test/train_md_early_term.py; do not edit.
+
+#ifndef EbMdEarlyTermWeights_h
+#define EbMdEarlyTermWeights_h
+
+#include "md_early_term.h"
+
+// clang-format off
+static const EtmNode etm_split_nodes[] = {
+    {0, 3, 1, 8}, {5, 213, 2, 5}, {2, 93, 3, 4}, {-1, 88, 0, 0},
+    {-1, -44, 0, 0}, {9, 252, 6, 7}, {-1, -190, 0, 0}, {-1, -55, 0, 0},
+    {7, 26, 9, 12}, {10, 8, 10, 11}, {-1, 98, 0, 0}, {-1, 45, 0, 0},
+    {10, 8, 13, 14}, {-1, -73, 0, 0}, {-1, 29, 0, 0}, {0, 3, 16, 23},
+    {5, 213, 17, 20}, {3, 1, 18, 19}, {-1, -85, 0, 0}, {-1, 44, 0, 0},
+    {2, 141, 21, 22}, {-1, -70, 0, 0}, {-1, -135, 0, 0}, {7, 67, 24, 27},
+    {4, 0, 25, 26}, {-1, 79, 0, 0}, {-1, 10, 0, 0}, {2, 141, 28, 29},
+    {-1, -74, 0, 0}, {-1, 89, 0, 0}, {0, 3, 31, 38}, {2, 93, 32, 35},
+    {3, 1, 33, 34}, {-1, -28, 0, 0}, {-1, 93, 0, 0}, {2, 141, 36, 37},
+    {-1, -42, 0, 0}, {-1, -106, 0, 0}, {5, 224, 39, 42}, {10, 8, 40, 41},
+    {-1, 86, 0, 0}, {-1, -8, 0, 0}, {10, 6, 43, 44}, {-1, -54, 0, 0},
+    {-1, 35, 0, 0}, {5, 206, 46, 53}, {10, 8, 47, 50}, {10, 4, 48, 49},
+    {-1, -15, 0, 0}, {-1, 76, 0, 0}, {0, 4, 51, 52}, {-1, -75, 0, 0},
+    {-1, 96, 0, 0}, {0, 3, 54, 57}, {2, 141, 55, 56}, {-1, -29, 0, 0},
+    {-1, -90, 0, 0}, {7, 26, 58, 59}, {-1, 41, 0, 0}, {-1, -23, 0, 0},
+    {5, 206, 61, 68}, {3, 0, 62, 65}, {2, 98, 63, 64}, {-1, -18, 0, 0},
+    {-1, 63, 0, 0}, {10, 0, 66, 67}, {-1, -12, 0, 0}, {-1, 76, 0, 0},
+    {0, 3, 69, 72}, {2, 141, 70, 71}, {-1, -20, 0, 0}, {-1, -79, 0, 0},
+    {10, 6, 73, 74}, {-1, -28, 0, 0}, {-1, 31, 0, 0}, {5, 237, 76, 83},
+    {0, 3, 77, 80}, {3, 2, 78, 79}, {-1, -49, 0, 0}, {-1, 33, 0, 0},
+    {8, 51, 81, 82}, {-1, 20, 0, 0}, {-1, 70, 0, 0}, {9, 252, 84, 87},
+    {8, 30, 85, 86}, {-1, -16, 0, 0}, {-1, -83, 0, 0}, {8, 57, 88, 89},
+    {-1, 211, 0, 0}, {-1, -10, 0, 0}, {5, 206, 91, 98}, {3, 1, 92, 95},
+    {2, 98, 93, 94}, {-1, -12, 0, 0}, {-1, 45, 0, 0}, {10, 0, 96, 97},
+    {-1, -17, 0, 0}, {-1, 73, 0, 0}, {0, 3, 99, 102}, {9, 252, 100, 101},
+    {-1, -36, 0, 0}, {-1, 40, 0, 0}, {2, 98, 103, 104}, {-1, -29, 0, 0},
+    {-1, 20, 0, 0}, {5, 250, 106, 113}, {5, 206, 107, 110}, {3, 1, 108, 109},
+    {-1, 6, 0, 0}, {-1, 61, 0, 0}, {10, 6, 111, 112}, {-1, -25, 0, 0},
+    {-1, 11, 0, 0}, {9, 252, 114, 117}, {7, 0, 115, 116}, {-1, -82, 0, 0},
+    {-1, -26, 0, 0}, {8, 63, 118, 119}, {-1, 113, 0, 0}, {-1, -12, 0, 0},
+    {5, 250, 121, 128}, {0, 3, 122, 125}, {3, 2, 123, 124}, {-1, -33, 0, 0},
+    {-1, 19, 0, 0}, {8, 51, 126, 127}, {-1, 8, 0, 0}, {-1, 56, 0, 0},
+    {5, 259, 129, 132}, {8, 0, 130, 131}, {-1, 34, 0, 0}, {-1, -74, 0, 0},
+    {2, 141, 133, 134}, {-1, -27, 0, 0}, {-1, 54, 0, 0}, {5, 206, 136, 143},
+    {10, 8, 137, 140}, {10, 6, 138, 139}, {-1, 4, 0, 0}, {-1, 51, 0, 0},
+    {0, 4, 141, 142}, {-1, -58, 0, 0}, {-1, 81, 0, 0}, {10, 10, 144, 147},
+    {0, 5, 145, 146}, {-1, -7, 0, 0}, {-1, -197, 0, 0}, {9, 150, 148, 149},
+    {-1, 77, 0, 0}, {-1, 19, 0, 0}, {5, 181, 151, 158}, {10, 8, 152, 155},
+    {0, 3, 153, 154}, {-1, 11, 0, 0}, {-1, 57, 0, 0}, {0, 4, 156, 157},
+    {-1, -33, 0, 0}, {-1, 83, 0, 0}, {10, 6, 159, 162}, {7, 0, 160, 161},
+    {-1, -32, 0, 0}, {-1, 34, 0, 0}, {5, 237, 163, 164}, {-1, 12, 0, 0},
+    {-1, -17, 0, 0}, {0, 3, 166, 173}, {2, 86, 167, 170}, {10, 8, 168, 169},
+    {-1, 71, 0, 0}, {-1, -23, 0, 0}, {8, 61, 171, 172}, {-1, -2, 0, 0},
+    {-1, -43, 0, 0}, {6, 114, 174, 177}, {10, 8, 175, 176}, {-1, -39, 0, 0},
+    {-1, 10, 0, 0}, {10, 6, 178, 179}, {-1, -11, 0, 0}, {-1, 36, 0, 0},
+    {5, 250, 181, 188}, {2, 100, 182, 185}, {3, 2, 183, 184}, {-1, -19, 0, 0},
+    {-1, 19, 0, 0}, {2, 115, 186, 187}, {-1, 147, 0, 0}, {-1, 3, 0, 0},
+    {9, 290, 189, 192}, {7, 0, 190, 191}, {-1, -63, 0, 0}, {-1, -13, 0, 0},
+    {8, 78, 193, 194}, {-1, 68, 0, 0}, {-1, -4, 0, 0}, {9, 252, 196, 203},
+    {0, 3, 197, 200}, {2, 141, 198, 199}, {-1, -3, 0, 0}, {-1, -79, 0, 0},
+    {8, 55, 201, 202}, {-1, -2, 0, 0}, {-1, 43, 0, 0}, {8, 62, 204, 207},
+    {0, 3, 205, 206}, {-1, 160, 0, 0}, {-1, 11, 0, 0}, {0, 4, 208, 209},
+    {-1, 4, 0, 0}, {-1, -63, 0, 0}, {10, 11, 211, 218}, {0, 5, 212, 215},
+    {5, 255, 213, 214}, {-1, 3, 0, 0}, {-1, -14, 0, 0}, {9, 150, 216, 217},
+    {-1, 54, 0, 0}, {-1, -200, 0, 0}, {0, 5, 219, 222}, {2, 102, 220, 221},
+    {-1, -32, 0, 0}, {-1, 31, 0, 0}, {-1, 71, 0, 0}, {0, 3, 224, 231},
+    {2, 86, 225, 228}, {5, 197, 226, 227}, {-1, 8, 0, 0}, {-1, 74, 0, 0},
+    {8, 72, 229, 230}, {-1, -3, 0, 0}, {-1, -45, 0, 0}, {10, 6, 232, 235},
+    {8, 67, 233, 234}, {-1, -22, 0, 0}, {-1, 60, 0, 0}, {6, 126, 236, 237},
+    {-1, -2, 0, 0}, {-1, 30, 0, 0},
+};
+static const uint16_t etm_split_roots[] = {0, 15, 30, 45, 60, 75, 90, 105, 120, 135, 150, 165, 180, 195, 210, 223};
+static const EtmModel etm_split_model = {etm_split_nodes, etm_split_roots, 16, 149, {759, 506}};
+
+static const EtmNode etm_nsq_nodes[] = {
+    {5, 281, 1, 8}, {5, 253, 2, 5}, {7, 2, 3, 4}, {-1, 77, 0, 0},
+    {-1, 48, 0, 0}, {1, 1, 6, 7}, {-1, 51, 0, 0}, {-1, -34, 0, 0},
+    {1, 1, 9, 12}, {2, 148, 10, 11}, {-1, -13, 0, 0}, {-1, 90, 0, 0},
+    {6, 98, 13, 14}, {-1, 54, 0, 0}, {-1, -173, 0, 0}, {5, 265, 16, 23},
+    {8, 39, 17, 20}, {2, 67, 18, 19}, {-1, 35, 0, 0}, {-1, 60, 0, 0},
+    {1, 3, 21, 22}, {-1, 25, 0, 0}, {-1, -66, 0, 0}, {1, 1, 24, 27},
+    {7, 98, 25, 26}, {-1, 2, 0, 0}, {-1, 96, 0, 0}, {6, 98, 28, 29},
+    {-1, 19, 0, 0}, {-1, -95, 0, 0}, {5, 288, 31, 38}, {0, 4, 32, 35},
+    {8, 0, 33, 34}, {-1, 34, 0, 0}, {-1, -20, 0, 0}, {1, 3, 36, 37},
+    {-1, 97, 0, 0}, {-1, -102, 0, 0}, {1, 1, 39, 42}, {2, 142, 40, 41},
+    {-1, -26, 0, 0}, {-1, 54, 0, 0}, {1, 2, 43, 44}, {-1, -97, 0, 0},
+    {-1, 56, 0, 0}, {5, 265, 46, 53}, {7, 0, 47, 50}, {5, 214, 48, 49},
+    {-1, 73, 0, 0}, {-1, 44, 0, 0}, {3, 0, 51, 52}, {-1, 25, 0, 0},
+    {-1, -4, 0, 0}, {0, 4, 54, 57}, {0, 3, 55, 56}, {-1, 34, 0, 0},
+    {-1, -54, 0, 0}, {1, 3, 58, 59}, {-1, 108, 0, 0}, {-1, -95, 0, 0},
+    {0, 4, 61, 68}, {8, 0, 62, 65}, {2, 76, 63, 64}, {-1, 10, 0, 0},
+    {-1, 38, 0, 0}, {9, 0, 66, 67}, {-1, -55, 0, 0}, {-1, 1, 0, 0},
+    {1, 3, 69, 72}, {7, 40, 70, 71}, {-1, 47, 0, 0}, {-1, 100, 0, 0},
+    {7, 76, 73, 74}, {-1, 52, 0, 0}, {-1, -123, 0, 0}, {6, 10, 76, 81},
+    {5, 267, 77, 78}, {-1, 129, 0, 0}, {9, 0, 79, 80}, {-1, 82, 0, 0},
+    {-1, 3, 0, 0}, {5, 253, 82, 85}, {7, 0, 83, 84}, {-1, 39, 0, 0},
+    {-1, 11, 0, 0}, {1, 1, 86, 87}, {-1, 19, 0, 0}, {-1, -35, 0, 0},
+    {0, 4, 89, 96}, {6, 86, 90, 93}, {6, 10, 91, 92}, {-1, 69, 0, 0},
+    {-1, 24, 0, 0}, {3, 1, 94, 95}, {-1, 1, 0, 0}, {-1, -38, 0, 0},
+    {1, 3, 97, 100}, {7, 40, 98, 99}, {-1, 35, 0, 0}, {-1, 92, 0, 0},
+    {9, 0, 101, 102}, {-1, -100, 0, 0}, {-1, 46, 0, 0}, {0, 4, 104, 111},
+    {5, 242, 105, 108}, {7, 0, 106, 107}, {-1, 38, 0, 0}, {-1, 9, 0, 0},
+    {6, 10, 109, 110}, {-1, 54, 0, 0}, {-1, -17, 0, 0}, {1, 3, 112, 115},
+    {5, 244, 113, 114}, {-1, 20, 0, 0}, {-1, 80, 0, 0}, {9, 0, 116, 117},
+    {-1, -85, 0, 0}, {-1, 33, 0, 0}, {10, 8, 119, 126}, {1, 1, 120, 123},
+    {7, 92, 121, 122}, {-1, -10, 0, 0}, {-1, 53, 0, 0}, {8, 0, 124, 125},
+    {-1, 25, 0, 0}, {-1, -28, 0, 0}, {7, 83, 127, 130}, {9, 175, 128, 129},
+    {-1, 21, 0, 0}, {-1, 2, 0, 0}, {1, 1, 131, 132}, {-1, 25, 0, 0},
+    {-1, 74, 0, 0}, {0, 4, 134, 141}, {6, 94, 135, 138}, {6, 10, 136, 137},
+    {-1, 49, 0, 0}, {-1, 17, 0, 0}, {1, 1, 139, 140}, {-1, 6, 0, 0},
+    {-1, -17, 0, 0}, {1, 2, 142, 145}, {5, 257, 143, 144}, {-1, 22, 0, 0},
+    {-1, 87, 0, 0}, {3, 3, 146, 147}, {-1, 9, 0, 0}, {-1, -47, 0, 0},
+    {0, 4, 149, 156}, {2, 163, 150, 153}, {7, 0, 151, 152}, {-1, 32, 0, 0},
+    {-1, -1, 0, 0}, {9, 223, 154, 155}, {-1, -56, 0, 0}, {-1, 40, 0, 0},
+    {1, 2, 157, 160}, {5, 248, 158, 159}, {-1, 14, 0, 0}, {-1, 79, 0, 0},
+    {5, 219, 161, 162}, {-1, -103, 0, 0}, {-1, -7, 0, 0}, {6, 10, 164, 171},
+    {8, 51, 165, 168}, {8, 42, 166, 167}, {-1, 91, 0, 0}, {-1, 57, 0, 0},
+    {3, 0, 169, 170}, {-1, 77, 0, 0}, {-1, 9, 0, 0}, {8, 0, 172, 175},
+    {2, 76, 173, 174}, {-1, 0, 0, 0}, {-1, 27, 0, 0}, {9, 0, 176, 177},
+    {-1, -33, 0, 0}, {-1, 4, 0, 0}, {0, 4, 179, 186}, {6, 98, 180, 183},
+    {6, 10, 181, 182}, {-1, 33, 0, 0}, {-1, 11, 0, 0}, {10, 8, 184, 185},
+    {-1, -10, 0, 0}, {-1, 8, 0, 0}, {1, 3, 187, 190}, {7, 60, 188, 189},
+    {-1, 3, 0, 0}, {-1, 78, 0, 0}, {7, 76, 191, 192}, {-1, 36, 0, 0},
+    {-1, -65, 0, 0}, {9, 273, 194, 201}, {5, 265, 195, 198}, {0, 3, 196, 197},
+    {-1, -6, 0, 0}, {-1, 12, 0, 0}, {0, 4, 199, 200}, {-1, -20, 0, 0},
+    {-1, 34, 0, 0}, {5, 262, 202, 205}, {8, 69, 203, 204}, {-1, -75, 0, 0},
+    {-1, 33, 0, 0}, {8, 77, 206, 207}, {-1, 52, 0, 0}, {-1, 4, 0, 0},
+    {8, 0, 209, 216}, {1, 1, 210, 213}, {0, 3, 211, 212}, {-1, -16, 0, 0},
+    {-1, 13, 0, 0}, {2, 101, 214, 215}, {-1, 16, 0, 0}, {-1, 76, 0, 0},
+    {1, 1, 217, 220}, {9, 0, 218, 219}, {-1, 112, 0, 0}, {-1, -3, 0, 0},
+    {9, 0, 221, 222}, {-1, -35, 0, 0}, {-1, 5, 0, 0}, {6, 10, 224, 229},
+    {9, 0, 225, 228}, {8, 42, 226, 227}, {-1, 82, 0, 0}, {-1, 36, 0, 0},
+    {-1, -55, 0, 0}, {8, 0, 230, 233}, {2, 67, 231, 232}, {-1, -3, 0, 0},
+    {-1, 16, 0, 0}, {1, 1, 234, 235}, {-1, 8, 0, 0}, {-1, -13, 0, 0},
+};
+static const uint16_t etm_nsq_roots[] = {0, 15, 30, 45, 60, 75, 88, 103, 118, 133, 148, 163, 178, 193, 208, 223};
+static const EtmModel etm_nsq_model = {etm_nsq_nodes, etm_nsq_roots, 16, 127, {637, 602}};
+
+// clang-format on
+
+#endif // EbMdEarlyTermWeights_h
@@ -16,6 +16,7 @@
 #include "lambda_rate_tables.h"
 #include "rc_process.h"
 #include "enc_mode_config.h"
+#include "md_early_term.h"
 
 void set_block_based_depth_refinement_controls(ModeDecisionContext *ctx, uint8_t block_based_depth_refinement_level);
 static void mode_decision_context_dctor(EbPtr p) {
@@ -23,6 +24,8 @@ static void mode_decision_context_dctor(EbPtr p) {
 
     uint32_t block_max_count_sb = obj->init_max_block_cnt;
 
+    if (obj->etm_samples)
+        EB_FREE_ARRAY(obj->etm_samples);
     // MD palette search
     if (obj->palette_buffer)
         EB_FREE(obj->palette_buffer);
@@ -59,6 +62,8 @@ static void mode_decision_context_dctor(EbPtr p) {
     EB_FREE_ALIGNED_ARRAY(obj->pred_buf_q3);
     EB_FREE_ARRAY(obj->fast_cand_array);
     EB_FREE_ARRAY(obj->fast_cand_ptr_array);
+    for (CandClass cand_class_it = CAND_CLASS_0; cand_class_it < CAND_CLASS_TOTAL; cand_class_it++)
+        EB_FREE_ARRAY(obj->fast_cand_class_idx[cand_class_it]);
     EB_FREE_2D(obj->injected_mvs);
     EB_FREE_ARRAY(obj->injected_ref_types);
     EB_FREE_ARRAY(obj->fast_cost_array);
@@ -116,6 +121,113 @@ static void mode_decision_context_dctor(EbPtr p) {
     EB_DELETE(obj->temp_residual);
     EB_DELETE(obj->temp_recon_ptr);
     EB_FREE_ARRAY(obj->full_cost_ssim_array);
+    EB_FREE_ARRAY(obj->cand_sort_cost);
+}
+
+/******************************************************
+ * Allocate the MD palette search buffers
+ ******************************************************/
+EbErrorType svt_aom_md_rtime_alloc_palette_buffers(ModeDecisionContext *ctx) {
+    EB_MALLOC(ctx->palette_buffer, sizeof(PALETTE_BUFFER));
+    EB_CALLOC_ARRAY(ctx->palette_cand_array, MAX_PAL_CAND);
+    for (int cd = 0; cd < MAX_PAL_CAND; cd++)
+        EB_MALLOC_ARRAY(ctx->palette_cand_array[cd].color_idx_map, MAX_PALETTE_SQUARE);
+
+    EB_MALLOC_ARRAY(ctx->palette_size_array_0, MAX_PAL_CAND);
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_aom_md_rtime_alloc_etm_samples(ModeDecisionContext *ctx) {
+    EB_MALLOC_ARRAY(ctx->etm_samples, ctx->init_max_block_cnt);
+    return EB_ErrorNone;
+}
+
+static uint64_t pic_buf_footprint(const EbPictureBufferDesc *buf) {
+    if (!buf)
+        return 0;
+    const uint64_t bytes = buf->bit_depth > EB_SIXTEEN_BIT ? 4 : buf->bit_depth > EB_EIGHT_BIT ? 2 : 1;
+    uint64_t       size  = 0;
+    if (buf->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG)
+        size += buf->luma_size;
+    if (buf->buffer_enable_mask & PICTURE_BUFFER_DESC_Cb_FLAG)
+        size += buf->chroma_size;
+    if (buf->buffer_enable_mask & PICTURE_BUFFER_DESC_Cr_FLAG)
+        size += buf->chroma_size;
+    return size * bytes;
+}
+
+/******************************************************
+ * Bytes held by the sample, candidate and per-block buffers of a Mode Decision Context
+ ******************************************************/
+uint64_t svt_aom_mode_decision_context_footprint(const ModeDecisionContext *ctx) {
+    const uint64_t sb_area   = (uint64_t)ctx->sb_size * ctx->sb_size;
+    const uint64_t blk_cnt   = ctx->init_max_block_cnt;
+    const uint64_t cand_cnt  = ctx->init_max_can_count;
+    uint64_t       footprint = 0;
+
+    if (ctx->cfl_temp_luma_recon16bit)
+        footprint += sb_area * sizeof(uint16_t);
+    if (ctx->cfl_temp_luma_recon)
+        footprint += sb_area;
+    footprint += CFL_BUF_SQUARE;
+    if (ctx->rate_est_table)
+        footprint += sizeof(*ctx->rate_est_table);
+    for (int i = 0; i < NEAREST_NEAR_MV_CNT; i++)
+        if (ctx->cmp_store.pred0_buf[i])
+            footprint += 2 * sb_area * (ctx->hbd_md > EB_8_BIT_MD ? 2 : 1);
+    if (ctx->residual1)
+        footprint += 2 * sb_area * sizeof(ctx->residual1[0]);
+    if (ctx->intrapred_buf)
+        footprint += INTERINTRA_MODES * 32 * 32 * (ctx->hbd_md > EB_8_BIT_MD ? 2 : 1);
+    if (ctx->obmc_buff_0)
+        footprint += 2 * sb_area * MAX_MB_PLANE * (ctx->hbd_md > EB_8_BIT_MD ? 2 : 1) +
+            sb_area * (sizeof(ctx->wsrc_buf[0]) + sizeof(ctx->mask_buf[0]));
+    if (ctx->palette_buffer)
+        footprint += sizeof(PALETTE_BUFFER) + MAX_PAL_CAND * (sizeof(PaletteInfo) + MAX_PALETTE_SQUARE + 1);
+
+    // Per-block data
+    footprint += blk_cnt *
+        (sizeof(ctx->md_blk_arr_nsq[0]) + sizeof(*ctx->md_blk_arr_nsq[0].av1xd) + sizeof(ctx->avail_blk_flag[0]) +
+         sizeof(ctx->cost_avail[0]) + sizeof(ctx->mdc_sb_array.leaf_data_array[0]) +
+         sizeof(ctx->mdc_sb_array.split_flag[0]) + sizeof(ctx->mdc_sb_array.refined_split_flag[0]) +
+         sizeof(ctx->mdc_sb_array.consider_block[0]));
+    // Neighbour recon arrays: top and left, luma plus two half-size chroma planes
+    if (ctx->md_blk_arr_nsq[0].neigh_left_recon_16bit[0])
+        footprint += blk_cnt * ctx->sb_size * 2 * 2 * sizeof(uint16_t);
+    if (ctx->md_blk_arr_nsq[0].neigh_left_recon[0])
+        footprint += blk_cnt * ctx->sb_size * 2 * 2;
+    for (uint32_t blk_idx = 0; blk_idx < blk_cnt; blk_idx++)
+        footprint += pic_buf_footprint(ctx->md_blk_arr_nsq[blk_idx].coeff_tmp) +
+            pic_buf_footprint(ctx->md_blk_arr_nsq[blk_idx].recon_tmp);
+
+    // Candidates
+    footprint += cand_cnt *
+        (sizeof(ctx->fast_cand_array[0]) + sizeof(ctx->fast_cand_ptr_array[0]) +
+         CAND_CLASS_TOTAL * sizeof(ctx->fast_cand_class_idx[0][0]) + 2 * sizeof(ctx->injected_mvs[0][0]) +
+         sizeof(ctx->injected_ref_types[0]));
+    footprint += (uint64_t)ctx->max_nics_uv *
+        (sizeof(ctx->fast_cost_array[0]) + sizeof(ctx->full_cost_array[0]) + sizeof(ctx->full_cost_ssim_array[0]) +
+         sizeof(ctx->cand_sort_cost[0]) +
+         sizeof(ctx->best_candidate_index_array[0]) + CAND_CLASS_TOTAL * sizeof(ctx->cand_buff_indices[0][0]));
+    for (uint32_t i = 0; i < ctx->max_nics_uv; i++) {
+        const ModeDecisionCandidateBuffer *cand_bf = ctx->cand_bf_ptr_array[i];
+        footprint += sizeof(*cand_bf) + pic_buf_footprint(cand_bf->pred) + pic_buf_footprint(cand_bf->rec_coeff) +
+            pic_buf_footprint(cand_bf->quant);
+    }
+    const ModeDecisionCandidateBuffer *scratch_bf[2] = {ctx->cand_bf_tx_depth_1, ctx->cand_bf_tx_depth_2};
+    for (int i = 0; i < 2; i++)
+        footprint += sizeof(*scratch_bf[i]) + pic_buf_footprint(scratch_bf[i]->pred) +
+            pic_buf_footprint(scratch_bf[i]->residual) + pic_buf_footprint(scratch_bf[i]->rec_coeff) +
+            pic_buf_footprint(scratch_bf[i]->quant);
+
+    // Scratch sample buffers
+    for (uint32_t txt_itr = 0; txt_itr < TX_TYPES; ++txt_itr)
+        footprint += pic_buf_footprint(ctx->recon_coeff_ptr[txt_itr]) + pic_buf_footprint(ctx->recon_ptr[txt_itr]) +
+            pic_buf_footprint(ctx->quant_coeff_ptr[txt_itr]);
+    footprint += pic_buf_footprint(ctx->tx_coeffs) + pic_buf_footprint(ctx->scratch_prediction_ptr) +
+        pic_buf_footprint(ctx->temp_recon_ptr) + pic_buf_footprint(ctx->temp_residual);
+
+    return footprint;
 }
 
 void svt_aom_set_nics(NicScalingCtrls *scaling_ctrls, uint32_t mds1_count[CAND_CLASS_TOTAL],
@@ -128,7 +240,7 @@ EbErrorType svt_aom_mode_decision_context_ctor(ModeDecisionContext *ctx, EbColor
                                                EncMode enc_mode, uint16_t max_block_cnt, uint32_t encoder_bit_depth,
                                                EbFifo *mode_decision_configuration_input_fifo_ptr,
                                                EbFifo *mode_decision_output_fifo_ptr, uint8_t enable_hbd_mode_decision,
-                                               uint8_t cfg_palette, uint8_t seq_qp_mod) {
+                                               uint8_t seq_qp_mod) {
     uint32_t buffer_index;
     uint32_t cand_index;
 
@@ -141,6 +253,8 @@ EbErrorType svt_aom_mode_decision_context_ctor(ModeDecisionContext *ctx, EbColor
     ctx->dctor  = mode_decision_context_dctor;
     ctx->hbd_md = enable_hbd_mode_decision;
 
+    ctx->wavefront_mv_row_limit = WAVEFRONT_NO_ROW_LIMIT;
+
     // Input/Output System Resource Manager FIFOs
     ctx->mode_decision_configuration_input_fifo_ptr = mode_decision_configuration_input_fifo_ptr;
     ctx->mode_decision_output_fifo_ptr              = mode_decision_output_fifo_ptr;
@@ -248,10 +362,13 @@ EbErrorType svt_aom_mode_decision_context_ctor(ModeDecisionContext *ctx, EbColor
     }
     EB_MALLOC_ARRAY(ctx->md_blk_arr_nsq, block_max_count_sb);
     // Fast Candidate Array
-    uint16_t max_can_count = svt_aom_get_max_can_count(enc_mode) + ind_uv_cands;
+    uint16_t max_can_count  = svt_aom_get_max_can_count(enc_mode) + ind_uv_cands;
+    ctx->init_max_can_count = max_can_count;
     EB_MALLOC_ARRAY(ctx->fast_cand_array, max_can_count);
 
     EB_MALLOC_ARRAY(ctx->fast_cand_ptr_array, max_can_count);
+    for (CandClass cand_class_it = CAND_CLASS_0; cand_class_it < CAND_CLASS_TOTAL; cand_class_it++)
+        EB_MALLOC_ARRAY(ctx->fast_cand_class_idx[cand_class_it], max_can_count);
     svt_aom_assert_err(max_can_count > ind_uv_cands, "Max. candidates is too low");
     EB_MALLOC_2D(ctx->injected_mvs, (uint16_t)(max_can_count - ind_uv_cands), 2);
     EB_MALLOC_ARRAY(ctx->injected_ref_types, (max_can_count - ind_uv_cands));
@@ -261,24 +378,16 @@ EbErrorType svt_aom_mode_decision_context_ctor(ModeDecisionContext *ctx, EbColor
         ctx->fast_cand_ptr_array[cand_index]->palette_info = NULL;
     }
 
-    // MD palette search
-    if (cfg_palette) {
-        EB_MALLOC(ctx->palette_buffer, sizeof(PALETTE_BUFFER));
-        EB_MALLOC_ARRAY(ctx->palette_cand_array, MAX_PAL_CAND);
-        for (int cd = 0; cd < MAX_PAL_CAND; cd++)
-            EB_MALLOC_ARRAY(ctx->palette_cand_array[cd].color_idx_map, MAX_PALETTE_SQUARE);
-
-        EB_MALLOC_ARRAY(ctx->palette_size_array_0, MAX_PAL_CAND);
-    } else {
-        ctx->palette_buffer       = NULL;
-        ctx->palette_cand_array   = NULL;
-        ctx->palette_size_array_0 = NULL;
-    }
+    // MD palette search buffers are allocated at run time by the first picture using palette
+    ctx->palette_buffer       = NULL;
+    ctx->palette_cand_array   = NULL;
+    ctx->palette_size_array_0 = NULL;
 
     // Cost Arrays
     EB_MALLOC_ARRAY(ctx->fast_cost_array, ctx->max_nics_uv);
     EB_MALLOC_ARRAY(ctx->full_cost_array, ctx->max_nics_uv);
     EB_MALLOC_ARRAY(ctx->full_cost_ssim_array, ctx->max_nics_uv);
+    EB_MALLOC_ARRAY(ctx->cand_sort_cost, ctx->max_nics_uv);
     // Candidate Buffers
     EB_NEW(ctx->cand_bf_tx_depth_1,
            svt_aom_mode_decision_scratch_cand_bf_ctor,
@@ -34,6 +34,11 @@ extern "C" {
 #define DEPTH_TWO_STEP 5
 #define DEPTH_THREE_STEP 1
 #define MAX_MVP_CANIDATES 4
+// Cross-picture wavefront: luma rows kept between the lowest row MD references and the last ready
+// row of the references (interpolation taps, chroma, and OBMC predictions from the block above)
+#define WAVEFRONT_MV_MARGIN 48
+// wavefront_mv_row_limit when the reference rows are not limited
+#define WAVEFRONT_NO_ROW_LIMIT (1 << 24)
 /**************************************
  * Macros
  **************************************/
@@ -898,6 +903,9 @@ typedef struct ModeDecisionContext {
     EbFifo                       *mode_decision_output_fifo_ptr;
     ModeDecisionCandidate       **fast_cand_ptr_array;
     ModeDecisionCandidate        *fast_cand_array;
+    // Indices into fast_cand_array of the candidates of each class (md_stage_0_count[class] entries), in
+    // injection order; lets MDS0 walk one class without scanning the whole candidate array
+    uint16_t                     *fast_cand_class_idx[CAND_CLASS_TOTAL];
     ModeDecisionCandidateBuffer **cand_bf_ptr_array;
     ModeDecisionCandidateBuffer  *cand_bf_tx_depth_1;
     ModeDecisionCandidateBuffer  *cand_bf_tx_depth_2;
@@ -938,6 +946,8 @@ typedef struct ModeDecisionContext {
     uint64_t *fast_cost_array;
     uint64_t *full_cost_array;
     uint64_t *full_cost_ssim_array;
+    // Scratch costs gathered from fast_cost_array/full_cost_array when sorting candidate buffers
+    uint64_t *cand_sort_cost;
     // Lambda
     uint32_t fast_lambda_md[2];
     uint32_t full_lambda_md[2];
@@ -1206,6 +1216,8 @@ typedef struct ModeDecisionContext {
     SpatialSSECtrls spatial_sse_ctrls;
 
     uint16_t init_max_block_cnt;
+    // Number of fast candidates allocated for the preset
+    uint16_t init_max_can_count;
     uint8_t  end_plane;
     // set to true if MDS3 needs to perform a full 10bit compensation in MDS3 (to make MDS3
     // conformant when using bypass_encdec)
@@ -1234,6 +1246,13 @@ typedef struct ModeDecisionContext {
     COMPONENT_TYPE lpd1_chroma_comp;
     uint8_t        lpd1_shift_mds0_dist;
     uint8_t        corrupted_mv_check;
+    // Cross-picture wavefront: lowest luma row (exclusive) of the references the current SB may reference
+    int32_t wavefront_mv_row_limit;
+    // Static SB skip: the SB source matches LAST, so MD only tests the zero-motion LAST candidate
+    uint8_t static_sb;
+    // MD early termination feature dump: samples of the current SB, written once its PD1 decision is known
+    struct EtmSample *etm_samples;
+    uint16_t          etm_sample_count;
     uint8_t        pred_mode_depth_refine;
     // when MD is done on 8bit, scale palette colors to 10bit (valid when bypass is 1)
     uint8_t  scale_palette;
@@ -1261,7 +1280,10 @@ typedef void (*EbAv1LambdaAssignFunc)(PictureControlSet *pcs, uint32_t *fast_lam
 extern EbErrorType svt_aom_mode_decision_context_ctor(
     ModeDecisionContext *ctx, EbColorFormat color_format, uint8_t sb_size, EncMode enc_mode, uint16_t max_block_cnt,
     uint32_t encoder_bit_depth, EbFifo *mode_decision_configuration_input_fifo_ptr,
-    EbFifo *mode_decision_output_fifo_ptr, uint8_t enable_hbd_mode_decision, uint8_t cfg_palette, uint8_t seq_qp_mod);
+    EbFifo *mode_decision_output_fifo_ptr, uint8_t enable_hbd_mode_decision, uint8_t seq_qp_mod);
+EbErrorType svt_aom_md_rtime_alloc_palette_buffers(ModeDecisionContext *ctx);
+EbErrorType svt_aom_md_rtime_alloc_etm_samples(ModeDecisionContext *ctx);
+uint64_t    svt_aom_mode_decision_context_footprint(const ModeDecisionContext *ctx);
 
 extern const EbAv1LambdaAssignFunc svt_aom_av1_lambda_assignment_function_table[4];
 
@@ -1291,6 +1313,10 @@ extern void svt_aom_reset_mode_decision(SequenceControlSet *scs, ModeDecisionCon
 
 extern void svt_aom_mode_decision_configure_sb(ModeDecisionContext *ctx, PictureControlSet *pcs, uint8_t sb_qp,
                                                uint8_t me_sb_qp);
+// Largest vertical MV (full-pel) the current block may use under the cross-picture wavefront
+static INLINE int32_t svt_aom_wavefront_max_mv_row(const ModeDecisionContext *ctx) {
+    return ctx->wavefront_mv_row_limit - (ctx->blk_org_y + ctx->blk_geom->bheight);
+}
 #ifdef __cplusplus
 }
 #endif
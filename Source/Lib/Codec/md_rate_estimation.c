@@ -10,6 +10,7 @@
 * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
 */
 
+#include <stddef.h>
 #include <stdlib.h>
 
 #include "md_rate_estimation.h"
@@ -42,6 +43,28 @@ static INLINE int32_t av1_cost_symbol(AomCdfProb p15) {
     return av1_prob_cost[prob - 128] + av1_cost_literal(shift);
 }
 
+/*************************************************************
+* hash_cdf
+* 64-bit multiplicative hash of a block of CDF memory, chained through
+* seed. The result is never 0 so that a zeroed context reads as "tables not
+* built yet".
+**************************************************************/
+static uint64_t hash_cdf(uint64_t seed, const void *data, size_t size) {
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t       h = seed ^ (size * 0x9E3779B97F4A7C15ULL);
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), p += sizeof(uint64_t)) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    for (; size; --size, ++p) {
+        h = (h ^ *p) * 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 29;
+    }
+    return h | 1;
+}
+
 /*************************************************************
 * svt_aom_get_syntax_rate_from_cdf
 **************************************************************/
@@ -74,6 +97,16 @@ void svt_aom_estimate_syntax_rate(MdRateEstimationContext *md_rate_est_ctx, Bool
     int32_t i, j;
 
     md_rate_est_ctx->initialized = 1;
+    // The syntax tables only depend on the non-coefficient CDFs and on the settings below; skip the
+    // rebuild when they are unchanged since the tables were last built.
+    const uint8_t settings[5] = {
+        (uint8_t)is_i_slice, pic_filter_intra_level, allow_screen_content_tools, enable_restoration, allow_intrabc};
+    const uint64_t hash = hash_cdf(hash_cdf(0, settings, sizeof(settings)),
+                                   &fc->newmv_cdf,
+                                   sizeof(*fc) - offsetof(FRAME_CONTEXT, newmv_cdf));
+    if (md_rate_est_ctx->syntax_cdf_hash == hash)
+        return;
+    md_rate_est_ctx->syntax_cdf_hash = hash;
     for (i = 0; i < PARTITION_CONTEXTS; ++i) {
         svt_aom_get_syntax_rate_from_cdf(md_rate_est_ctx->partition_fac_bits[i], fc->partition_cdf[i], NULL);
 
@@ -345,6 +378,24 @@ MvClassType svt_av1_get_mv_class(int32_t z, int32_t *offset) {
 void svt_av1_build_nmv_cost_table(int32_t *mvjoint, int32_t *mvcost[2], const NmvContext *ctx,
                                   MvSubpelPrecision precision);
 
+/**************************************************************************
+ * build_nmv_cost_table_cached()
+ * Same as svt_av1_build_nmv_cost_table(), but only rebuilds the per-component
+ * cost tables (2 * MV_VALS entries) when the MV CDFs or the precision changed
+ * since the tables were last built. cached_hash tracks the content of mvcost.
+ ***************************************************************************/
+static void build_nmv_cost_table_cached(int32_t *mvjoint, int32_t *mvcost[2], const NmvContext *ctx,
+                                        MvSubpelPrecision precision, uint64_t *cached_hash) {
+    const int8_t   prec = (int8_t)precision;
+    const uint64_t hash = hash_cdf(hash_cdf(0, &prec, sizeof(prec)), ctx, sizeof(*ctx));
+    if (*cached_hash == hash) {
+        svt_aom_get_syntax_rate_from_cdf(mvjoint, ctx->joints_cdf, NULL);
+        return;
+    }
+    svt_av1_build_nmv_cost_table(mvjoint, mvcost, ctx, precision);
+    *cached_hash = hash;
+}
+
 /**************************************************************************
  * svt_aom_estimate_mv_rate()
  * Estimate the rate of motion vectors
@@ -371,10 +422,12 @@ void svt_aom_estimate_mv_rate(PictureControlSet *pcs, MdRateEstimationContext *m
     nmvcost_hp[1]                   = &md_rate_est_ctx->nmv_costs_hp[1][MV_MAX];
     uint8_t allow_high_precision_mv = pcs->ppcs->bypass_cost_table_gen ? 0 : frm_hdr->allow_high_precision_mv;
     if (!pcs->ppcs->bypass_cost_table_gen) {
-        svt_av1_build_nmv_cost_table(md_rate_est_ctx->nmv_vec_cost, // out
-                                     allow_high_precision_mv ? nmvcost_hp : nmvcost, // out
-                                     &fc->nmvc,
-                                     allow_high_precision_mv);
+        build_nmv_cost_table_cached(md_rate_est_ctx->nmv_vec_cost, // out
+                                    allow_high_precision_mv ? nmvcost_hp : nmvcost, // out
+                                    &fc->nmvc,
+                                    allow_high_precision_mv,
+                                    allow_high_precision_mv ? &md_rate_est_ctx->nmv_hp_cdf_hash
+                                                            : &md_rate_est_ctx->nmv_cdf_hash);
         md_rate_est_ctx->nmvcoststack[0] = allow_high_precision_mv ? &md_rate_est_ctx->nmv_costs_hp[0][MV_MAX]
                                                                    : &md_rate_est_ctx->nmv_costs[0][MV_MAX];
         md_rate_est_ctx->nmvcoststack[1] = allow_high_precision_mv ? &md_rate_est_ctx->nmv_costs_hp[1][MV_MAX]
@@ -388,12 +441,14 @@ void svt_aom_estimate_mv_rate(PictureControlSet *pcs, MdRateEstimationContext *m
     } else {
         memcpy(md_rate_est_ctx->nmv_vec_cost, pcs->ppcs->scs->nmv_vec_cost, sizeof(int32_t) * MV_JOINTS);
         memcpy(md_rate_est_ctx->nmv_costs, pcs->ppcs->scs->nmv_costs, sizeof(int32_t) * MV_VALS * 2);
+        md_rate_est_ctx->nmv_cdf_hash    = 0;
         md_rate_est_ctx->nmvcoststack[0] = &md_rate_est_ctx->nmv_costs[0][MV_MAX];
         md_rate_est_ctx->nmvcoststack[1] = &md_rate_est_ctx->nmv_costs[1][MV_MAX];
     }
     if (frm_hdr->allow_intrabc) {
         int32_t *dvcost[2] = {&md_rate_est_ctx->dv_cost[0][MV_MAX], &md_rate_est_ctx->dv_cost[1][MV_MAX]};
-        svt_av1_build_nmv_cost_table(md_rate_est_ctx->dv_joint_cost, dvcost, &fc->ndvc, MV_SUBPEL_NONE);
+        build_nmv_cost_table_cached(
+            md_rate_est_ctx->dv_joint_cost, dvcost, &fc->ndvc, MV_SUBPEL_NONE, &md_rate_est_ctx->dv_cdf_hash);
     }
 }
 void copy_mv_rate(PictureControlSet *pcs, MdRateEstimationContext *dst_rate) {
@@ -401,10 +456,16 @@ void copy_mv_rate(PictureControlSet *pcs, MdRateEstimationContext *dst_rate) {
 
     memcpy(dst_rate->nmv_vec_cost, pcs->md_rate_est_ctx->nmv_vec_cost, MV_JOINTS * sizeof(int32_t));
 
+    // The cached CDF hashes follow the tables so that a later build from the same CDFs is skipped.
     if (frm_hdr->allow_high_precision_mv) {
-        memcpy(dst_rate->nmv_costs_hp, pcs->md_rate_est_ctx->nmv_costs_hp, 2 * MV_VALS * sizeof(int32_t));
+        if (dst_rate->nmv_hp_cdf_hash != pcs->md_rate_est_ctx->nmv_hp_cdf_hash ||
+            !pcs->md_rate_est_ctx->nmv_hp_cdf_hash)
+            memcpy(dst_rate->nmv_costs_hp, pcs->md_rate_est_ctx->nmv_costs_hp, 2 * MV_VALS * sizeof(int32_t));
+        dst_rate->nmv_hp_cdf_hash = pcs->md_rate_est_ctx->nmv_hp_cdf_hash;
     } else {
-        memcpy(dst_rate->nmv_costs, pcs->md_rate_est_ctx->nmv_costs, 2 * MV_VALS * sizeof(int32_t));
+        if (dst_rate->nmv_cdf_hash != pcs->md_rate_est_ctx->nmv_cdf_hash || !pcs->md_rate_est_ctx->nmv_cdf_hash)
+            memcpy(dst_rate->nmv_costs, pcs->md_rate_est_ctx->nmv_costs, 2 * MV_VALS * sizeof(int32_t));
+        dst_rate->nmv_cdf_hash = pcs->md_rate_est_ctx->nmv_cdf_hash;
     }
 
     dst_rate->nmvcoststack[0] = frm_hdr->allow_high_precision_mv ? &dst_rate->nmv_costs_hp[0][MV_MAX]
@@ -413,19 +474,17 @@ void copy_mv_rate(PictureControlSet *pcs, MdRateEstimationContext *dst_rate) {
                                                                  : &dst_rate->nmv_costs[1][MV_MAX];
 
     if (frm_hdr->allow_intrabc) {
-        memcpy(dst_rate->dv_cost, pcs->md_rate_est_ctx->dv_cost, 2 * MV_VALS * sizeof(int32_t));
+        if (dst_rate->dv_cdf_hash != pcs->md_rate_est_ctx->dv_cdf_hash || !pcs->md_rate_est_ctx->dv_cdf_hash)
+            memcpy(dst_rate->dv_cost, pcs->md_rate_est_ctx->dv_cost, 2 * MV_VALS * sizeof(int32_t));
         memcpy(dst_rate->dv_joint_cost, pcs->md_rate_est_ctx->dv_joint_cost, MV_JOINTS * sizeof(int32_t));
+        dst_rate->dv_cdf_hash = pcs->md_rate_est_ctx->dv_cdf_hash;
     }
 }
 /**************************************************************************
- * svt_aom_estimate_coefficients_rate()
- * Estimate the rate of the quantised coefficient
- * based on the frame CDF
+ * estimate_eob_rate()
+ * Estimate the rate of the EOB position for all EOB multi sizes
  ***************************************************************************/
-void svt_aom_estimate_coefficients_rate(MdRateEstimationContext *md_rate_est_ctx, FRAME_CONTEXT *fc) {
-    const int32_t num_planes = 3; // NM - Hardcoded to 3
-    const int32_t nplanes    = AOMMIN(num_planes, PLANE_TYPES);
-
+static void estimate_eob_rate(MdRateEstimationContext *md_rate_est_ctx, FRAME_CONTEXT *fc, const int32_t nplanes) {
     for (int eob_multi_size = 0; eob_multi_size < 7; ++eob_multi_size) {
         for (int plane = 0; plane < nplanes; ++plane) {
             LvMapEobCost *pcost = &md_rate_est_ctx->eob_frac_bits[eob_multi_size][plane];
@@ -445,60 +504,103 @@ void svt_aom_estimate_coefficients_rate(MdRateEstimationContext *md_rate_est_ctx
             }
         }
     }
-    for (int tx_size = 0; tx_size < TX_SIZES; ++tx_size) {
-        for (int plane = 0; plane < nplanes; ++plane) {
-            LvMapCoeffCost *pcost = &md_rate_est_ctx->coeff_fac_bits[tx_size][plane];
+}
 
-            for (int ctx = 0; ctx < TXB_SKIP_CONTEXTS; ++ctx)
-                svt_aom_get_syntax_rate_from_cdf(pcost->txb_skip_cost[ctx], fc->txb_skip_cdf[tx_size][ctx], NULL);
+/**************************************************************************
+ * estimate_coefficients_rate_tx_size()
+ * Estimate the rate of the quantised coefficients of one TX size
+ ***************************************************************************/
+static void estimate_coefficients_rate_tx_size(MdRateEstimationContext *md_rate_est_ctx, FRAME_CONTEXT *fc,
+                                               const TxSize tx_size, const int32_t nplanes) {
+    for (int plane = 0; plane < nplanes; ++plane) {
+        LvMapCoeffCost *pcost = &md_rate_est_ctx->coeff_fac_bits[tx_size][plane];
 
-            for (int ctx = 0; ctx < SIG_COEF_CONTEXTS_EOB; ++ctx)
-                svt_aom_get_syntax_rate_from_cdf(
-                    pcost->base_eob_cost[ctx], fc->coeff_base_eob_cdf[tx_size][plane][ctx], NULL);
-            for (int ctx = 0; ctx < SIG_COEF_CONTEXTS; ++ctx)
-                svt_aom_get_syntax_rate_from_cdf(pcost->base_cost[ctx], fc->coeff_base_cdf[tx_size][plane][ctx], NULL);
-            for (int ctx = 0; ctx < SIG_COEF_CONTEXTS; ++ctx) {
-                pcost->base_cost[ctx][4] = 0;
-                pcost->base_cost[ctx][5] = pcost->base_cost[ctx][1] + av1_cost_literal(1) - pcost->base_cost[ctx][0];
-                pcost->base_cost[ctx][6] = pcost->base_cost[ctx][2] - pcost->base_cost[ctx][1];
-                pcost->base_cost[ctx][7] = pcost->base_cost[ctx][3] - pcost->base_cost[ctx][2];
-            }
-            for (int ctx = 0; ctx < EOB_COEF_CONTEXTS; ++ctx)
-                svt_aom_get_syntax_rate_from_cdf(
-                    pcost->eob_extra_cost[ctx], fc->eob_extra_cdf[tx_size][plane][ctx], NULL);
+        for (int ctx = 0; ctx < TXB_SKIP_CONTEXTS; ++ctx)
+            svt_aom_get_syntax_rate_from_cdf(pcost->txb_skip_cost[ctx], fc->txb_skip_cdf[tx_size][ctx], NULL);
 
-            for (int ctx = 0; ctx < DC_SIGN_CONTEXTS; ++ctx)
-                svt_aom_get_syntax_rate_from_cdf(pcost->dc_sign_cost[ctx], fc->dc_sign_cdf[plane][ctx], NULL);
+        for (int ctx = 0; ctx < SIG_COEF_CONTEXTS_EOB; ++ctx)
+            svt_aom_get_syntax_rate_from_cdf(
+                pcost->base_eob_cost[ctx], fc->coeff_base_eob_cdf[tx_size][plane][ctx], NULL);
+        for (int ctx = 0; ctx < SIG_COEF_CONTEXTS; ++ctx)
+            svt_aom_get_syntax_rate_from_cdf(pcost->base_cost[ctx], fc->coeff_base_cdf[tx_size][plane][ctx], NULL);
+        for (int ctx = 0; ctx < SIG_COEF_CONTEXTS; ++ctx) {
+            pcost->base_cost[ctx][4] = 0;
+            pcost->base_cost[ctx][5] = pcost->base_cost[ctx][1] + av1_cost_literal(1) - pcost->base_cost[ctx][0];
+            pcost->base_cost[ctx][6] = pcost->base_cost[ctx][2] - pcost->base_cost[ctx][1];
+            pcost->base_cost[ctx][7] = pcost->base_cost[ctx][3] - pcost->base_cost[ctx][2];
+        }
+        for (int ctx = 0; ctx < EOB_COEF_CONTEXTS; ++ctx)
+            svt_aom_get_syntax_rate_from_cdf(
+                pcost->eob_extra_cost[ctx], fc->eob_extra_cdf[tx_size][plane][ctx], NULL);
 
-            for (int ctx = 0; ctx < LEVEL_CONTEXTS; ++ctx) {
-                int32_t br_rate[BR_CDF_SIZE];
-                int32_t prev_cost = 0;
-                int32_t i, j;
-                svt_aom_get_syntax_rate_from_cdf(
-                    br_rate, fc->coeff_br_cdf[AOMMIN(tx_size, TX_32X32)][plane][ctx], NULL);
-                // SVT_LOG("br_rate: ");
-                // for(j = 0; j < BR_CDF_SIZE; j++)
-                //  SVT_LOG("%4d ", br_rate[j]);
-                // SVT_LOG("\n");
-                for (i = 0; i < COEFF_BASE_RANGE; i += BR_CDF_SIZE - 1) {
-                    for (j = 0; j < BR_CDF_SIZE - 1; j++) pcost->lps_cost[ctx][i + j] = prev_cost + br_rate[j];
-                    prev_cost += br_rate[j];
-                }
-                pcost->lps_cost[ctx][i] = prev_cost;
-                // SVT_LOG("lps_cost: %d %d %2d : ", tx_size, plane, ctx);
-                // for (i = 0; i <= COEFF_BASE_RANGE; i++)
-                //  SVT_LOG("%5d ", pcost->lps_cost[ctx][i]);
-                // SVT_LOG("\n");
-            }
-            for (int ctx = 0; ctx < LEVEL_CONTEXTS; ++ctx) {
-                pcost->lps_cost[ctx][0 + COEFF_BASE_RANGE + 1] = pcost->lps_cost[ctx][0];
-                for (int i = 1; i <= COEFF_BASE_RANGE; ++i)
-                    pcost->lps_cost[ctx][i + COEFF_BASE_RANGE + 1] = pcost->lps_cost[ctx][i] -
-                        pcost->lps_cost[ctx][i - 1];
+        for (int ctx = 0; ctx < DC_SIGN_CONTEXTS; ++ctx)
+            svt_aom_get_syntax_rate_from_cdf(pcost->dc_sign_cost[ctx], fc->dc_sign_cdf[plane][ctx], NULL);
+
+        for (int ctx = 0; ctx < LEVEL_CONTEXTS; ++ctx) {
+            int32_t br_rate[BR_CDF_SIZE];
+            int32_t prev_cost = 0;
+            int32_t i, j;
+            svt_aom_get_syntax_rate_from_cdf(
+                br_rate, fc->coeff_br_cdf[AOMMIN(tx_size, TX_32X32)][plane][ctx], NULL);
+            // SVT_LOG("br_rate: ");
+            // for(j = 0; j < BR_CDF_SIZE; j++)
+            //  SVT_LOG("%4d ", br_rate[j]);
+            // SVT_LOG("\n");
+            for (i = 0; i < COEFF_BASE_RANGE; i += BR_CDF_SIZE - 1) {
+                for (j = 0; j < BR_CDF_SIZE - 1; j++) pcost->lps_cost[ctx][i + j] = prev_cost + br_rate[j];
+                prev_cost += br_rate[j];
             }
+            pcost->lps_cost[ctx][i] = prev_cost;
+            // SVT_LOG("lps_cost: %d %d %2d : ", tx_size, plane, ctx);
+            // for (i = 0; i <= COEFF_BASE_RANGE; i++)
+            //  SVT_LOG("%5d ", pcost->lps_cost[ctx][i]);
+            // SVT_LOG("\n");
         }
+        for (int ctx = 0; ctx < LEVEL_CONTEXTS; ++ctx) {
+            pcost->lps_cost[ctx][0 + COEFF_BASE_RANGE + 1] = pcost->lps_cost[ctx][0];
+            for (int i = 1; i <= COEFF_BASE_RANGE; ++i)
+                pcost->lps_cost[ctx][i + COEFF_BASE_RANGE + 1] = pcost->lps_cost[ctx][i] -
+                    pcost->lps_cost[ctx][i - 1];
+        }
+    }
+}
+
+/**************************************************************************
+ * svt_aom_estimate_coefficients_rate()
+ * Estimate the rate of the quantised coefficient
+ * based on the frame CDF
+ ***************************************************************************/
+void svt_aom_estimate_coefficients_rate(MdRateEstimationContext *md_rate_est_ctx, FRAME_CONTEXT *fc) {
+    const int32_t num_planes = 3; // NM - Hardcoded to 3
+    const int32_t nplanes    = AOMMIN(num_planes, PLANE_TYPES);
+
+    // The tables are rebuilt lazily: the EOB tables and each TX size's tables are only rebuilt when
+    // their CDFs changed since they were last built (e.g. when consecutive pictures start from the
+    // same default/primary-reference CDFs, or when a per-SB CDF update did not touch a TX size).
+    const uint64_t eob_hash = hash_cdf(0,
+                                       &fc->eob_flag_cdf16,
+                                       offsetof(FRAME_CONTEXT, coeff_base_eob_cdf) -
+                                           offsetof(FRAME_CONTEXT, eob_flag_cdf16));
+    if (md_rate_est_ctx->eob_cdf_hash != eob_hash) {
+        md_rate_est_ctx->eob_cdf_hash = eob_hash;
+        estimate_eob_rate(md_rate_est_ctx, fc, nplanes);
+    }
+    const uint64_t dc_sign_hash = hash_cdf(0, fc->dc_sign_cdf, sizeof(fc->dc_sign_cdf));
+    for (int tx_size = 0; tx_size < TX_SIZES; ++tx_size) {
+        uint64_t hash = hash_cdf(dc_sign_hash, fc->txb_skip_cdf[tx_size], sizeof(fc->txb_skip_cdf[tx_size]));
+        hash          = hash_cdf(hash, fc->eob_extra_cdf[tx_size], sizeof(fc->eob_extra_cdf[tx_size]));
+        hash = hash_cdf(hash, fc->coeff_base_eob_cdf[tx_size], sizeof(fc->coeff_base_eob_cdf[tx_size]));
+        hash = hash_cdf(hash, fc->coeff_base_cdf[tx_size], sizeof(fc->coeff_base_cdf[tx_size]));
+        hash = hash_cdf(hash,
+                        fc->coeff_br_cdf[AOMMIN(tx_size, TX_32X32)],
+                        sizeof(fc->coeff_br_cdf[AOMMIN(tx_size, TX_32X32)]));
+        if (md_rate_est_ctx->coeff_cdf_hash[tx_size] == hash)
+            continue;
+        md_rate_est_ctx->coeff_cdf_hash[tx_size] = hash;
+        estimate_coefficients_rate_tx_size(md_rate_est_ctx, fc, (TxSize)tx_size, nplanes);
     }
 }
+
 static INLINE AomCdfProb *get_y_mode_cdf(FRAME_CONTEXT *tile_ctx, const MacroBlockD *xd) {
     uint8_t above_ctx, left_ctx;
     svt_aom_get_kf_y_mode_ctx(xd, &above_ctx, &left_ctx);
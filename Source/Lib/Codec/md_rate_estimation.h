@@ -133,6 +133,15 @@ extern "C" {
         int32_t inter_tx_type_fac_bits[EXT_TX_SETS_INTER][EXT_TX_SIZES][CDF_SIZE(TX_TYPES)];
         int32_t switchable_interp_fac_bitss[SWITCHABLE_FILTER_CONTEXTS][SWITCHABLE_FILTERS];
         int32_t initialized;
+
+        // Hashes of the CDFs (and settings) each group of tables was last built from; used to skip
+        // rebuilding tables whose CDFs did not change. 0 means the tables must be (re)built.
+        uint64_t syntax_cdf_hash;
+        uint64_t coeff_cdf_hash[TX_SIZES];
+        uint64_t eob_cdf_hash;
+        uint64_t nmv_cdf_hash;
+        uint64_t nmv_hp_cdf_hash;
+        uint64_t dv_cdf_hash;
     } MdRateEstimationContext;
     /***************************************************************************
     * AV1 Probability table
@@ -20,12 +20,18 @@ static void me_context_dctor(EbPtr p) {
 
     EB_FREE_ARRAY(obj->mvd_bits_array);
     EB_FREE_ARRAY(obj->p_eight_pos_sad16x16);
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++) EB_FREE_ARRAY(obj->hash_value_buffer[i][j]);
 }
 EbErrorType svt_aom_me_context_ctor(MeContext *object_ptr) {
     object_ptr->dctor = me_context_dctor;
 
     EB_MALLOC_ARRAY(object_ptr->p_eight_pos_sad16x16,
                     8 * 16); //16= 16 16x16 blocks in a SB.       8=8search points
+    // 2x2 sub-block hashes of a 64x64 block
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            EB_MALLOC_ARRAY(object_ptr->hash_value_buffer[i][j], (BLOCK_SIZE_64 / 2) * (BLOCK_SIZE_64 / 2));
 
     // Initialize Alt-Ref parameters
     object_ptr->me_type                     = ME_CLOSE_LOOP;
@@ -317,7 +317,34 @@ typedef struct Me8x8VarCtrls {
     // If ME 8x8 SAD variance is above me_sr_mult2_th, multiply the search area width/height by 2
     uint32_t me_sr_mult2_th;
 } Me8x8VarCtrls;
+/* MeEpzsCtrls replace the full search of the ME search area by a predictive zonal search: the best of a few
+* predictors (HME centre, zero MV and the MVs of the neighbouring SBs) is refined with hexagon then diamond
+* steps, and a small full search around the final point refines the sub-blocks.
+*/
+typedef struct MeEpzsCtrls {
+    // If true, use the zonal search instead of the full search of the search area
+    uint8_t enabled;
+    // Use the zonal search only when the search area has at least this many points
+    uint32_t min_sa_area;
+    // Maximum number of hexagon steps
+    uint8_t max_hex_steps;
+    // Skip the hexagon/diamond steps when the 64x64 SAD of the best predictor is below this threshold
+    uint32_t early_exit_th;
+} MeEpzsCtrls;
 #define SEARCH_REGION_COUNT 2
+typedef struct MeHashCtrls {
+    // If true, look up the hash of each full 64x64 SB in the references before HME; an exact
+    // match becomes the search centre and the full-pel search is reduced to that single point
+    uint8_t enabled;
+} MeHashCtrls;
+typedef struct MeTfMvCtrls {
+    // If true, use the 64x64 motion found by the temporal filtering of the picture as a search centre
+    // candidate (scaled to the distance of each reference)
+    uint8_t enabled;
+    // HME is skipped when every reference has a hash match, a TF candidate from the same picture, or a
+    // scaled TF candidate with a 64x64 SAD below this threshold (0: scaled candidates never skip HME)
+    uint32_t skip_hme_sad_th;
+} MeTfMvCtrls;
 typedef struct SearchArea {
     uint16_t width; // search area width
     uint16_t height; // search area height
@@ -413,6 +440,17 @@ typedef struct MeContext {
     MeHmeRefPruneCtrls me_hme_prune_ctrls;
     MeSrCtrls          me_sr_adjustment_ctrls;
     Me8x8VarCtrls      me_8x8_var_ctrls;
+    MeEpzsCtrls        me_epzs_ctrls;
+    // SB bounds of the ME segment being processed; the EPZS uses the MVs of the SBs of the segment
+    // that were already searched
+    uint32_t seg_b64_start_x;
+    uint32_t seg_b64_start_y;
+    uint32_t seg_b64_end_x;
+    MeHashCtrls        me_hash_ctrls;
+    // 1 if the hash pre-pass found an exact match of the SB in the reference
+    uint8_t  hash_me_match[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    uint32_t *hash_value_buffer[2][2]; // scratch of svt_av1_get_block_hash_value()
+    MeTfMvCtrls        tf_mv_ctrls;
     uint8_t            max_hme_sr_area_multipler;
     MvBasedSearchAdj   mv_based_sa_adj;
     // ME
@@ -170,6 +170,20 @@ void *svt_aom_motion_estimation_kernel(void *input_ptr) {
                                                      &quarter_picture_ptr,
                                                      &sixteenth_picture_ptr);
 
+                    // Build the hash tables of the references used by the hash ME pre-pass
+                    if (me_context_ptr->me_ctx->me_hash_ctrls.enabled) {
+                        const uint8_t num_of_list = (pcs->slice_type == P_SLICE) ? 1 : 2;
+                        for (int i = 0; i < num_of_list; i++) {
+                            const uint8_t ref_count = i ? pcs->ref_list1_count_try : pcs->ref_list0_count_try;
+                            for (int j = 0; j < ref_count; j++)
+                                svt_aom_me_hash_build_if_needed(
+                                    (EbPaReferenceObject *)pcs->ref_pa_pic_ptr_array[i][j]->object_ptr);
+                        }
+                    }
+
+                    me_context_ptr->me_ctx->seg_b64_start_x = x_b64_start_index;
+                    me_context_ptr->me_ctx->seg_b64_start_y = y_b64_start_index;
+                    me_context_ptr->me_ctx->seg_b64_end_x   = x_b64_end_index;
                     // 64x64 Block Loop
                     for (uint32_t y_b64_index = y_b64_start_index; y_b64_index < y_b64_end_index; ++y_b64_index) {
                         for (uint32_t x_b64_index = x_b64_start_index; x_b64_index < x_b64_end_index; ++x_b64_index) {
@@ -242,6 +256,7 @@ void *svt_aom_motion_estimation_kernel(void *input_ptr) {
                                                 ref_object->downscaled_sixteenth_downsampled_picture_ptr[sr_denom_idx][resize_denom_idx];
                                             me_context_ptr->me_ctx->me_ds_ref_array[i][j].picture_number =
                                                 ref_object->picture_number;
+                                            me_context_ptr->me_ctx->me_ds_ref_array[i][j].hash_table = NULL;
                                         }
                                     }
                                 } else {
@@ -258,6 +273,10 @@ void *svt_aom_motion_estimation_kernel(void *input_ptr) {
                                                 ref_object->sixteenth_downsampled_picture_ptr;
                                             me_context_ptr->me_ctx->me_ds_ref_array[i][j].picture_number =
                                                 ref_object->picture_number;
+                                            me_context_ptr->me_ctx->me_ds_ref_array[i][j].hash_table =
+                                                me_context_ptr->me_ctx->me_hash_ctrls.enabled
+                                                ? &ref_object->me_hash_table
+                                                : NULL;
                                         }
                                     }
                                 }
@@ -270,6 +289,14 @@ void *svt_aom_motion_estimation_kernel(void *input_ptr) {
                                 me_context_ptr->me_ctx,
                                 input_pic);
 
+                            // A complete SB whose source matches the LAST reference is coded without search
+                            if (pcs->static_sb_skip) {
+                                const EbPaReferenceObject *last_pa_ref =
+                                    (EbPaReferenceObject *)pcs->ref_pa_pic_ptr_array[REF_LIST_0][0]->object_ptr;
+                                pcs->b64_static[b64_index] = pcs->b64_geom[b64_index].is_complete_b64 &&
+                                    pa_ref_obj_->b64_src_hash[b64_index] == last_pa_ref->b64_src_hash[b64_index];
+                            }
+
                             if ((in_results_ptr->task_type == TASK_PAME) || (in_results_ptr->task_type == TASK_SUPERRES_RE_ME)) {
                                 svt_block_on_mutex(pcs->me_processed_b64_mutex);
                                 pcs->me_processed_b64_count++;
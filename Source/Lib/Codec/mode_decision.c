@@ -2458,7 +2458,8 @@ void single_motion_search(PictureControlSet *pcs, ModeDecisionContext *ctx, Mode
     const int mi_height  = mi_size_high[bsize];
     x->mv_limits.row_min = -(((mi_row + mi_height) * MI_SIZE) + AOM_INTERP_EXTEND);
     x->mv_limits.col_min = -(((mi_col + mi_width) * MI_SIZE) + AOM_INTERP_EXTEND);
-    x->mv_limits.row_max = (cm->mi_rows - mi_row) * MI_SIZE + AOM_INTERP_EXTEND;
+    x->mv_limits.row_max = AOMMIN((cm->mi_rows - mi_row) * MI_SIZE + AOM_INTERP_EXTEND,
+                                  svt_aom_wavefront_max_mv_row(ctx));
     x->mv_limits.col_max = (cm->mi_cols - mi_col) * MI_SIZE + AOM_INTERP_EXTEND;
     //set search paramters
     x->sadperbit16 = svt_aom_get_sad_per_bit(frm_hdr->quantization_params.base_q_idx, 0);
@@ -2492,7 +2493,7 @@ void single_motion_search(PictureControlSet *pcs, ModeDecisionContext *ctx, Mode
         x->mv_limits = tmp_mv_limits;
     } else { // round-up the default
         x->best_mv.as_mv.col = best_pred_mv.as_mv.col >> 3;
-        x->best_mv.as_mv.row = best_pred_mv.as_mv.row >> 3;
+        x->best_mv.as_mv.row = AOMMIN(best_pred_mv.as_mv.row >> 3, svt_aom_wavefront_max_mv_row(ctx));
     }
 
     if (do_frac_refine) {
@@ -3610,8 +3611,6 @@ static void intra_bc_search(PictureControlSet *pcs, ModeDecisionContext *ctx, co
     uint32_t        full_lambda = ctx->hbd_md ? ctx->full_lambda_md[EB_10_BIT_MD] : ctx->full_lambda_md[EB_8_BIT_MD];
     //fill x with what needed.
     x->is_exhaustive_allowed = ctx->blk_geom->bwidth == 4 || ctx->blk_geom->bheight == 4 ? 1 : 0;
-    svt_memcpy(&x->crc_calculator1, &pcs->crc_calculator1, sizeof(pcs->crc_calculator1));
-    svt_memcpy(&x->crc_calculator2, &pcs->crc_calculator2, sizeof(pcs->crc_calculator2));
     x->approx_inter_rate = ctx->approx_inter_rate;
     x->xd                = blk_ptr->av1xd;
     x->nmv_vec_cost      = ctx->md_rate_est_ctx->nmv_vec_cost;
@@ -3982,6 +3981,29 @@ static void inject_filter_intra_candidates(
 
     return;
 }
+/*
+ * Cross-picture wavefront: remove the inter candidates whose MVs reach below the reference rows
+ * that are ready for the current SB
+ */
+static void remove_wavefront_unready_candidates(ModeDecisionContext *ctx, uint32_t *candidate_total_cnt) {
+    ModeDecisionCandidate *cand_array = ctx->fast_cand_array;
+    const int32_t          max_mv_row = svt_aom_wavefront_max_mv_row(ctx) * 8;
+    uint32_t               cand_total_cnt = 0;
+    for (uint32_t cand_idx = 0; cand_idx < *candidate_total_cnt; cand_idx++) {
+        ModeDecisionCandidate *cand = &cand_array[cand_idx];
+        if (is_inter_mode(cand->pred_mode)) {
+            MvReferenceFrame rf[2];
+            av1_set_ref_frame(rf, cand->ref_frame_type);
+            if (cand->mv[get_list_idx(rf[0])].y > max_mv_row ||
+                (rf[1] > INTRA_FRAME && cand->mv[get_list_idx(rf[1])].y > max_mv_row))
+                continue;
+        }
+        if (cand_total_cnt != cand_idx)
+            svt_memcpy(&cand_array[cand_total_cnt], cand, sizeof(ModeDecisionCandidate));
+        cand_total_cnt++;
+    }
+    *candidate_total_cnt = cand_total_cnt;
+}
 static void inject_zz_backup_candidate(
      PictureControlSet   *pcs,
     struct ModeDecisionContext *ctx,
@@ -4020,6 +4042,36 @@ static void inject_zz_backup_candidate(
     (*candidate_total_cnt) = cand_total_cnt;
     }
 }
+/*
+   Static SB: the source matches LAST, so only the zero-motion LAST candidate is tested
+*/
+static void inject_static_sb_candidate(
+    PictureControlSet   *pcs,
+    struct ModeDecisionContext *ctx,
+    uint32_t *candidate_total_cnt) {
+    EbWarpedMotionParams *gm_params = &pcs->ppcs->global_motion[LAST_FRAME];
+    // GLOBALMV is zero-motion only under an identity global model
+    if (gm_params->wmtype != IDENTITY) {
+        inject_zz_backup_candidate(pcs, ctx, candidate_total_cnt);
+        return;
+    }
+    ModeDecisionCandidate *cand_array = ctx->fast_cand_array;
+    uint32_t               cand_total_cnt = (*candidate_total_cnt);
+    cand_array[cand_total_cnt].pred_mode = GLOBALMV;
+    cand_array[cand_total_cnt].motion_mode = SIMPLE_TRANSLATION;
+    cand_array[cand_total_cnt].is_interintra_used = 0;
+    cand_array[cand_total_cnt].wm_params_l0 = *gm_params;
+    cand_array[cand_total_cnt].wm_params_l1 = *gm_params;
+    cand_array[cand_total_cnt].use_intrabc = 0;
+    cand_array[cand_total_cnt].skip_mode_allowed = FALSE;
+    cand_array[cand_total_cnt].mv[REF_LIST_0] = (Mv) { {0, 0} };
+    cand_array[cand_total_cnt].drl_index = 0;
+    cand_array[cand_total_cnt].ref_frame_type = LAST_FRAME;
+    cand_array[cand_total_cnt].transform_type[0] = DCT_DCT;
+    cand_array[cand_total_cnt].transform_type_uv = DCT_DCT;
+    INC_MD_CAND_CNT (cand_total_cnt,pcs->ppcs->max_can_count);
+    (*candidate_total_cnt) = cand_total_cnt;
+}
 int svt_av1_allow_palette(int allow_palette,
     BlockSize bsize) {
     assert(bsize < BlockSizeS_ALL);
@@ -4131,6 +4183,8 @@ EbErrorType generate_md_stage_0_cand_light_pd0(
             &cand_total_cnt);
     }
 
+    if (ctx->wavefront_mv_row_limit != WAVEFRONT_NO_ROW_LIMIT)
+        remove_wavefront_unready_candidates(ctx, &cand_total_cnt);
     // For I_SLICE, DC is always injected, and therefore there is no a risk of no candidates @ md_stage_0()
     // For non I_SLICE, there is a risk of no candidates @ md_stage_0() because of the INTER candidates pruning techniques
     if (slice_type != I_SLICE && cand_total_cnt == 0) {
@@ -4173,12 +4227,16 @@ void generate_md_stage_0_cand_light_pd1(
             &cand_total_cnt);
     }
 
-    if (slice_type != I_SLICE) {
+    if (ctx->static_sb)
+        inject_static_sb_candidate(pcs, ctx, &cand_total_cnt);
+    else if (slice_type != I_SLICE) {
             inject_inter_candidates_light_pd1(
                 pcs,
                 ctx,
                 &cand_total_cnt);
     }
+    if (ctx->wavefront_mv_row_limit != WAVEFRONT_NO_ROW_LIMIT)
+        remove_wavefront_unready_candidates(ctx, &cand_total_cnt);
     // For I_SLICE, DC is always injected, and therefore there is no a risk of no candidates @ md_syage_0()
     // For non I_SLICE, there is a risk of no candidates @ md_stage_0() because of the INTER candidates pruning techniques
     if (slice_type != I_SLICE && cand_total_cnt == 0) {
@@ -4238,13 +4296,17 @@ EbErrorType generate_md_stage_0_cand(
                  &cand_total_cnt);
          }
      }
-     if (slice_type != I_SLICE) {
+     if (ctx->static_sb)
+         inject_static_sb_candidate(pcs, ctx, &cand_total_cnt);
+     else if (slice_type != I_SLICE) {
             svt_aom_inject_inter_candidates(
                 pcs,
                 ctx,
                 scs,
                 &cand_total_cnt);
     }
+    if (ctx->wavefront_mv_row_limit != WAVEFRONT_NO_ROW_LIMIT)
+        remove_wavefront_unready_candidates(ctx, &cand_total_cnt);
     // For I_SLICE, DC is always injected, and therefore there is no a risk of no candidates @ md_syage_0()
     // For non I_SLICE, there is a risk of no candidates @ md_stage_0() because of the INTER candidates pruning techniques
     if (slice_type != I_SLICE && cand_total_cnt == 0) {
@@ -4269,24 +4331,24 @@ EbErrorType generate_md_stage_0_cand(
                   if (cand_ptr->palette_info == NULL ||
                           cand_ptr->palette_size[0] == 0) {
                     cand_ptr->cand_class = CAND_CLASS_0;
-                    ctx->md_stage_0_count[CAND_CLASS_0]++;
+                    ctx->fast_cand_class_idx[CAND_CLASS_0][ctx->md_stage_0_count[CAND_CLASS_0]++] = (uint16_t)cand_i;
                   }
                   else {
                       // Palette Prediction
                      cand_ptr->cand_class = CAND_CLASS_3;
-                     ctx->md_stage_0_count[CAND_CLASS_3]++;
+                     ctx->fast_cand_class_idx[CAND_CLASS_3][ctx->md_stage_0_count[CAND_CLASS_3]++] = (uint16_t)cand_i;
                   }
         }
         else { // INTER
             if (cand_ptr->pred_mode == NEWMV || cand_ptr->pred_mode == NEW_NEWMV || merge_inter_cands) {
                 // MV Prediction
                 cand_ptr->cand_class = CAND_CLASS_2;
-                ctx->md_stage_0_count[CAND_CLASS_2]++;
+                ctx->fast_cand_class_idx[CAND_CLASS_2][ctx->md_stage_0_count[CAND_CLASS_2]++] = (uint16_t)cand_i;
             }
             else {
                 //MVP Prediction
                 cand_ptr->cand_class = CAND_CLASS_1;
-                ctx->md_stage_0_count[CAND_CLASS_1]++;
+                ctx->fast_cand_class_idx[CAND_CLASS_1][ctx->md_stage_0_count[CAND_CLASS_1]++] = (uint16_t)cand_i;
             }
 
         }
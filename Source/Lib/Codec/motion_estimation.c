@@ -816,6 +816,114 @@ static void open_loop_me_fullpel_search_sblock(MeContext *me_ctx, uint32_t list_
     }
 }
 
+#define EPZS_MAX_PREDICTORS 5
+// Evaluate one full-pel position of the search area starting at (x_sa_origin, y_sa_origin)
+static INLINE void epzs_check_point(MeContext *me_ctx, uint32_t list_index, uint32_t ref_pic_index,
+                                    int16_t x_sa_origin, int16_t y_sa_origin, int16_t mv_x, int16_t mv_y) {
+    open_loop_me_get_search_point_results_block(
+        me_ctx,
+        list_index,
+        ref_pic_index,
+        (mv_x - x_sa_origin) + (mv_y - y_sa_origin) * me_ctx->interpolated_full_stride[list_index][ref_pic_index],
+        mv_x,
+        mv_y);
+}
+
+/*******************************************
+ * epzs_search_sblock
+ *   predictive zonal search of the search area: the best of the predictors
+ *   is refined with hexagon then diamond steps on the 64x64 SAD, then a
+ *   small full search around the final position refines the sub-blocks
+ *******************************************/
+static void epzs_search_sblock(MeContext *me_ctx, uint32_t list_index, uint32_t ref_pic_index,
+                               const uint32_t *pred_mv, uint8_t pred_count, int16_t x_sa_origin,
+                               int16_t y_sa_origin, uint32_t sa_width, uint32_t sa_height) {
+    static const int16_t hex_pattern[6][2]     = {{-2, 0}, {-1, -2}, {1, -2}, {2, 0}, {1, 2}, {-1, 2}};
+    static const int16_t diamond_pattern[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    const int16_t        x_max                 = x_sa_origin + (int16_t)sa_width - 1;
+    const int16_t        y_max                 = y_sa_origin + (int16_t)sa_height - 1;
+    int16_t              pred_x[EPZS_MAX_PREDICTORS];
+    int16_t              pred_y[EPZS_MAX_PREDICTORS];
+
+    // Predictors, moved into the search area and checked once
+    for (uint8_t i = 0; i < pred_count; i++) {
+        pred_x[i]  = (int16_t)CLIP3(x_sa_origin, x_max, _MVXT(pred_mv[i]));
+        pred_y[i]  = (int16_t)CLIP3(y_sa_origin, y_max, _MVYT(pred_mv[i]));
+        uint8_t j = 0;
+        while (j < i && (pred_x[j] != pred_x[i] || pred_y[j] != pred_y[i])) j++;
+        if (j == i)
+            epzs_check_point(me_ctx, list_index, ref_pic_index, x_sa_origin, y_sa_origin, pred_x[i], pred_y[i]);
+    }
+    int16_t best_x = _MVXT(me_ctx->p_best_mv64x64[0]);
+    int16_t best_y = _MVYT(me_ctx->p_best_mv64x64[0]);
+
+    if (me_ctx->p_best_sad_64x64[0] >= me_ctx->me_epzs_ctrls.early_exit_th) {
+        // Hexagon steps until the centre is the best position
+        for (uint8_t step = 0; step < me_ctx->me_epzs_ctrls.max_hex_steps; step++) {
+            for (int i = 0; i < 6; i++) {
+                const int16_t x = best_x + hex_pattern[i][0];
+                const int16_t y = best_y + hex_pattern[i][1];
+                if (x < x_sa_origin || x > x_max || y < y_sa_origin || y > y_max)
+                    continue;
+                epzs_check_point(me_ctx, list_index, ref_pic_index, x_sa_origin, y_sa_origin, x, y);
+            }
+            const int16_t x = _MVXT(me_ctx->p_best_mv64x64[0]);
+            const int16_t y = _MVYT(me_ctx->p_best_mv64x64[0]);
+            if (x == best_x && y == best_y)
+                break;
+            best_x = x;
+            best_y = y;
+        }
+        // Diamond step around the hexagon centre
+        for (int i = 0; i < 4; i++) {
+            const int16_t x = best_x + diamond_pattern[i][0];
+            const int16_t y = best_y + diamond_pattern[i][1];
+            if (x < x_sa_origin || x > x_max || y < y_sa_origin || y > y_max)
+                continue;
+            epzs_check_point(me_ctx, list_index, ref_pic_index, x_sa_origin, y_sa_origin, x, y);
+        }
+        best_x = _MVXT(me_ctx->p_best_mv64x64[0]);
+        best_y = _MVYT(me_ctx->p_best_mv64x64[0]);
+    }
+
+    // Full search of an 8x3 area around the best position for the sub-blocks
+    const uint32_t ref_w = MIN(8, sa_width);
+    const uint32_t ref_h = MIN(3, sa_height);
+    const int16_t  ref_x = (int16_t)CLIP3(x_sa_origin, x_max - (int16_t)ref_w + 1, best_x - 3);
+    const int16_t  ref_y = (int16_t)CLIP3(y_sa_origin, y_max - (int16_t)ref_h + 1, best_y - 1);
+    uint8_t       *integer_buffer_ptr = me_ctx->integer_buffer_ptr[list_index][ref_pic_index];
+    me_ctx->integer_buffer_ptr[list_index][ref_pic_index] += (ref_x - x_sa_origin) +
+        (ref_y - y_sa_origin) * me_ctx->interpolated_full_stride[list_index][ref_pic_index];
+    open_loop_me_fullpel_search_sblock(me_ctx, list_index, ref_pic_index, ref_x, ref_y, ref_w, ref_h);
+    me_ctx->integer_buffer_ptr[list_index][ref_pic_index] = integer_buffer_ptr;
+}
+
+// Collect the EPZS predictors of the SB: HME centre, zero MV, and the MVs of the left, top and
+// top-right SBs when they belong to the segment (so were already searched by this context)
+static uint8_t get_epzs_predictors(PictureParentControlSet *pcs, MeContext *me_ctx, uint32_t b64_index,
+                                   uint32_t b64_origin_x, uint32_t b64_origin_y, uint32_t list_index,
+                                   uint32_t ref_pic_index, int16_t x_search_center, int16_t y_search_center,
+                                   uint32_t pred_mv[EPZS_MAX_PREDICTORS]) {
+    const uint32_t  pic_width_in_b64 = (pcs->aligned_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+    const uint32_t  x_b64            = b64_origin_x / BLOCK_SIZE_64;
+    const uint32_t  y_b64            = b64_origin_y / BLOCK_SIZE_64;
+    const uint32_t  ref_offset       = list_index * REF_LIST_MAX_DEPTH + ref_pic_index;
+    const uint32_t  b64_stride       = MAX_NUM_OF_REF_PIC_LIST * REF_LIST_MAX_DEPTH;
+    const uint32_t *mv               = pcs->me_epzs_mv + ref_offset;
+    uint8_t         count            = 0;
+
+    pred_mv[count++] = ((uint32_t)(uint16_t)y_search_center << 16) | (uint16_t)x_search_center;
+    pred_mv[count++] = 0;
+    if (x_b64 > me_ctx->seg_b64_start_x)
+        pred_mv[count++] = mv[(b64_index - 1) * b64_stride];
+    if (y_b64 > me_ctx->seg_b64_start_y) {
+        pred_mv[count++] = mv[(b64_index - pic_width_in_b64) * b64_stride];
+        if (x_b64 + 1 < me_ctx->seg_b64_end_x)
+            pred_mv[count++] = mv[(b64_index - pic_width_in_b64 + 1) * b64_stride];
+    }
+    return count;
+}
+
 // Perform HME Level 0 for one 64x64 block on the given picture
 static void hme_level_0(
     MeContext *me_ctx, // ME context Ptr, used to get/update ME results
@@ -1291,8 +1399,12 @@ static void integer_search_b64(PictureParentControlSet *pcs, uint32_t b64_index,
                                            input_ptr->width,
                                            input_ptr->height);
             // Get hme results
-            if (me_ctx->search_results[list_index][ref_pic_index].do_ref == 0)
+            if (me_ctx->search_results[list_index][ref_pic_index].do_ref == 0) {
+                if (me_ctx->me_epzs_ctrls.enabled)
+                    pcs->me_epzs_mv[(b64_index * MAX_NUM_OF_REF_PIC_LIST + list_index) * REF_LIST_MAX_DEPTH +
+                                    ref_pic_index] = 0;
                 continue; //so will not get ME results for those references.
+            }
             x_search_center = me_ctx->search_results[list_index][ref_pic_index].hme_sc_x;
             y_search_center = me_ctx->search_results[list_index][ref_pic_index].hme_sc_y;
             search_area_width  = me_ctx->me_sa.sa_min.width;
@@ -1321,7 +1433,11 @@ static void integer_search_b64(PictureParentControlSet *pcs, uint32_t b64_index,
             int16_t search_area_height_before_sr_reduction = search_area_height;
             int16_t search_area_width_before_sr_reduction  = search_area_width;
             uint64_t best_hme_sad = (uint64_t)~0;
-            if (me_ctx->me_early_exit_th) {
+            if (me_ctx->hash_me_match[list_index][ref_pic_index]) {
+                // The search centre is an exact match of the SB
+                search_area_width  = 1;
+                search_area_height = 1;
+            } else if (me_ctx->me_early_exit_th) {
                 if (me_ctx->zz_sad[list_index][ref_pic_index] <
                     (me_ctx->me_early_exit_th / 6)) {
                     search_area_width  = 1;
@@ -1574,13 +1690,39 @@ static void integer_search_b64(PictureParentControlSet *pcs, uint32_t b64_index,
             // Move to the top left of the search region
             x_top_left_search_region = (int16_t)(ref_pic_ptr->org_x + b64_origin_x) + x_search_area_origin;
             y_top_left_search_region = (int16_t)(ref_pic_ptr->org_y + b64_origin_y) + y_search_area_origin;
-            open_loop_me_fullpel_search_sblock(me_ctx,
-                                               list_index,
-                                               ref_pic_index,
-                                               x_search_area_origin,
-                                               y_search_area_origin,
-                                               search_area_width,
-                                               search_area_height);
+            if (me_ctx->me_epzs_ctrls.enabled &&
+                (uint32_t)(search_area_width * search_area_height) >= me_ctx->me_epzs_ctrls.min_sa_area) {
+                uint32_t      pred_mv[EPZS_MAX_PREDICTORS];
+                const uint8_t pred_count = get_epzs_predictors(pcs,
+                                                               me_ctx,
+                                                               b64_index,
+                                                               b64_origin_x,
+                                                               b64_origin_y,
+                                                               list_index,
+                                                               ref_pic_index,
+                                                               x_search_center,
+                                                               y_search_center,
+                                                               pred_mv);
+                epzs_search_sblock(me_ctx,
+                                   list_index,
+                                   ref_pic_index,
+                                   pred_mv,
+                                   pred_count,
+                                   x_search_area_origin,
+                                   y_search_area_origin,
+                                   search_area_width,
+                                   search_area_height);
+            } else
+                open_loop_me_fullpel_search_sblock(me_ctx,
+                                                   list_index,
+                                                   ref_pic_index,
+                                                   x_search_area_origin,
+                                                   y_search_area_origin,
+                                                   search_area_width,
+                                                   search_area_height);
+            if (me_ctx->me_epzs_ctrls.enabled)
+                pcs->me_epzs_mv[(b64_index * MAX_NUM_OF_REF_PIC_LIST + list_index) * REF_LIST_MAX_DEPTH +
+                                ref_pic_index] = me_ctx->p_best_mv64x64[0];
         }
     }
 }
@@ -3138,6 +3280,150 @@ static INLINE void init_me_hme_data(MeContext *me_ctx) {
     memset(me_ctx->performed_phme,0,
         sizeof(uint8_t)*MAX_NUM_OF_REF_PIC_LIST*REF_LIST_MAX_DEPTH*SEARCH_REGION_COUNT);
 }
+/*
+ * Build the 64x64 block hash table of a PA reference the first time a picture
+ * refers to it. The table is kept with the reference object and reused by all
+ * the pictures (and ME segments) referencing the same picture.
+ */
+void svt_aom_me_hash_build_if_needed(EbPaReferenceObject *ref_obj) {
+    svt_block_on_mutex(ref_obj->me_hash_mutex);
+    if (ref_obj->me_hash_picture_number != ref_obj->picture_number) {
+        Yv12BufferConfig picture;
+        svt_aom_link_eb_to_aom_buffer_desc_8bit(ref_obj->input_padded_pic, &picture);
+        // On failure the table is left empty, so no match is found
+        if (svt_av1_build_picture_block_hash_map(&ref_obj->me_hash_table, &picture, BLOCK_SIZE_64) ==
+            EB_ErrorNone)
+            ref_obj->me_hash_picture_number = ref_obj->picture_number;
+    }
+    svt_release_mutex(ref_obj->me_hash_mutex);
+}
+
+/*
+ * Hash ME pre-pass: look up the hash of the SB in the 64x64 block hash table of
+ * each reference. For an exact match, the closest matching position is returned
+ * in sc_x/sc_y and hash_me_match is set. Returns 1 when a match was found for
+ * all the references, in which case HME can be skipped.
+ */
+static uint8_t hash_me_b64(MeContext *me_ctx, uint32_t org_x, uint32_t org_y,
+                           int16_t sc_x[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+                           int16_t sc_y[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH]) {
+    uint8_t all_matched = 1;
+    if (me_ctx->b64_width != BLOCK_SIZE_64 || me_ctx->b64_height != BLOCK_SIZE_64)
+        return 0;
+
+    uint32_t hash_value1, hash_value2;
+    svt_av1_get_block_hash_value(me_ctx->b64_src_ptr,
+                                 me_ctx->b64_src_stride,
+                                 BLOCK_SIZE_64,
+                                 &hash_value1,
+                                 &hash_value2,
+                                 0,
+                                 me_ctx->hash_value_buffer);
+
+    for (uint8_t list_i = 0; list_i < me_ctx->num_of_list_to_search; list_i++) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ref_i++) {
+            const HashTable *hash_table = me_ctx->me_ds_ref_array[list_i][ref_i].hash_table;
+            const int32_t    count      = hash_table ? svt_av1_hash_table_count(hash_table, hash_value1) : 0;
+            int32_t          best_len   = INT32_MAX;
+            int16_t          best_x = 0, best_y = 0;
+            if (count) {
+                const BlockHash *block_hash = svt_av1_hash_get_first_block(hash_table, hash_value1);
+                for (int32_t i = 0; i < count; i++) {
+                    if (block_hash[i].hash_value2 != hash_value2)
+                        continue;
+                    const int16_t mv_x = block_hash[i].x - (int16_t)org_x;
+                    const int16_t mv_y = block_hash[i].y - (int16_t)org_y;
+                    if (ABS(mv_x) > MAX_FULL_PEL_VAL || ABS(mv_y) > MAX_FULL_PEL_VAL)
+                        continue;
+                    const int32_t len = ABS(mv_x) + ABS(mv_y);
+                    if (len < best_len) {
+                        best_len = len;
+                        best_x   = mv_x;
+                        best_y   = mv_y;
+                    }
+                }
+            }
+            if (best_len == INT32_MAX) {
+                all_matched = 0;
+                continue;
+            }
+            me_ctx->hash_me_match[list_i][ref_i] = 1;
+            sc_x[list_i][ref_i]                  = best_x;
+            sc_y[list_i][ref_i]                  = best_y;
+        }
+    }
+    return all_matched;
+}
+
+/*
+ * Subsampled SAD of the SB at the full-pel search centre (sc_x, sc_y) of ref_pic_ptr,
+ * after moving the centre onto the padded reference as done in check_00_center().
+ */
+static uint32_t me_b64_sad(EbPictureBufferDesc *ref_pic_ptr, MeContext *me_ctx, uint32_t org_x,
+                           uint32_t org_y, int16_t *sc_x, int16_t *sc_y) {
+    const int16_t pad_width  = (int16_t)BLOCK_SIZE_64 - 1;
+    const int16_t pad_height = (int16_t)BLOCK_SIZE_64 - 1;
+    *sc_x = (int16_t)CLIP3(-pad_width - (int16_t)org_x, (int16_t)ref_pic_ptr->width - 1 - (int16_t)org_x, *sc_x);
+    *sc_y = (int16_t)CLIP3(
+        -pad_height - (int16_t)org_y, (int16_t)ref_pic_ptr->height - 1 - (int16_t)org_y, *sc_y);
+    const uint32_t search_region_index = (int16_t)(ref_pic_ptr->org_x + org_x) + *sc_x +
+        ((int16_t)(ref_pic_ptr->org_y + org_y) + *sc_y) * ref_pic_ptr->stride_y;
+    return svt_nxm_sad_kernel(me_ctx->b64_src_ptr,
+                              me_ctx->b64_src_stride << 1,
+                              &(ref_pic_ptr->buffer_y[search_region_index]),
+                              ref_pic_ptr->stride_y << 1,
+                              me_ctx->b64_height >> 1,
+                              me_ctx->b64_width)
+        << 1;
+}
+
+/*
+ * TF motion pre-pass: derive a search centre for each reference without a hash
+ * match from the 64x64 motion stored by the temporal filtering of the picture.
+ * The motion of the side of the reference is used as is when it points to the
+ * reference itself, and is scaled by the distance ratio otherwise. Returns 1
+ * when all the references have an accepted centre, in which case HME can be
+ * skipped.
+ */
+static uint8_t tf_mv_b64(PictureParentControlSet *pcs, MeContext *me_ctx, uint32_t b64_index,
+                         uint32_t org_x, uint32_t org_y,
+                         int16_t  sc_x[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+                         int16_t  sc_y[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+                         uint32_t sad[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+                         uint8_t  cand[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH]) {
+    uint8_t all_accepted = 1;
+    for (uint8_t list_i = 0; list_i < me_ctx->num_of_list_to_search; list_i++) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ref_i++) {
+            if (me_ctx->hash_me_match[list_i][ref_i])
+                continue;
+            const int dist = (int)((int64_t)me_ctx->me_ds_ref_array[list_i][ref_i].picture_number -
+                                   (int64_t)pcs->picture_number);
+            const TfMeMv *tf_mv = &pcs->tf_me_mv[2 * b64_index + (dist > 0)];
+            if (!dist || !tf_mv->dist) {
+                all_accepted = 0;
+                continue;
+            }
+            int16_t x = tf_mv->mv_x, y = tf_mv->mv_y;
+            if (dist != tf_mv->dist) {
+                x = (int16_t)CLIP3(-MAX_FULL_PEL_VAL, MAX_FULL_PEL_VAL, tf_mv->mv_x * dist / tf_mv->dist);
+                y = (int16_t)CLIP3(-MAX_FULL_PEL_VAL, MAX_FULL_PEL_VAL, tf_mv->mv_y * dist / tf_mv->dist);
+            }
+            sad[list_i][ref_i]  = me_b64_sad(me_ctx->me_ds_ref_array[list_i][ref_i].picture_ptr,
+                                            me_ctx,
+                                            org_x,
+                                            org_y,
+                                            &x,
+                                            &y);
+            sc_x[list_i][ref_i] = x;
+            sc_y[list_i][ref_i] = y;
+            cand[list_i][ref_i] = 1;
+            if (dist != tf_mv->dist && sad[list_i][ref_i] >= me_ctx->tf_mv_ctrls.skip_hme_sad_th)
+                all_accepted = 0;
+        }
+    }
+    return all_accepted;
+}
+
 /*******************************************
 * motion_estimation
 *   performs ME on 64x64 blocks
@@ -3173,8 +3459,54 @@ EbErrorType svt_aom_motion_estimation_b64(
     uint8_t prune_ref = me_ctx->enable_hme_flag && me_ctx->me_type != ME_MCTF;
     // Initialize ME/HME buffers
     init_me_hme_data(me_ctx);
-    // HME: Perform Hierachical Motion Estimation for all refrence frames for the current 64x64 block.
-    hme_b64(pcs, b64_origin_x, b64_origin_y, me_ctx, input_ptr);
+    memset(me_ctx->hash_me_match, 0, sizeof(me_ctx->hash_me_match));
+    if (me_ctx->me_type == ME_OPEN_LOOP &&
+        (me_ctx->me_hash_ctrls.enabled || (me_ctx->tf_mv_ctrls.enabled && pcs->tf_me_mv_valid))) {
+        int16_t  pre_sc_x[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+        int16_t  pre_sc_y[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+        uint32_t tf_sad[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+        uint8_t  tf_cand[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH] = {{0}};
+        // Hash ME: look for exact matches of the SB in the references
+        uint8_t skip_hme = me_ctx->me_hash_ctrls.enabled &&
+            hash_me_b64(me_ctx, b64_origin_x, b64_origin_y, pre_sc_x, pre_sc_y);
+        // TF motion: search centres from the temporal filtering of the picture
+        if (!skip_hme && me_ctx->tf_mv_ctrls.enabled && pcs->tf_me_mv_valid)
+            skip_hme = tf_mv_b64(
+                pcs, me_ctx, b64_index, b64_origin_x, b64_origin_y, pre_sc_x, pre_sc_y, tf_sad, tf_cand);
+        // HME is still needed for the references without a good enough candidate
+        if (!skip_hme)
+            hme_b64(pcs, b64_origin_x, b64_origin_y, me_ctx, input_ptr);
+        for (uint32_t li = 0; li < MAX_NUM_OF_REF_PIC_LIST; li++) {
+            for (uint32_t ri = 0; ri < REF_LIST_MAX_DEPTH; ri++) {
+                if (me_ctx->hash_me_match[li][ri]) {
+                    me_ctx->search_results[li][ri].hme_sc_x = pre_sc_x[li][ri];
+                    me_ctx->search_results[li][ri].hme_sc_y = pre_sc_y[li][ri];
+                    me_ctx->search_results[li][ri].hme_sad  = 0;
+                    continue;
+                }
+                if (!tf_cand[li][ri])
+                    continue;
+                // Keep the HME centre when it is at least as good as the TF candidate
+                if (!skip_hme) {
+                    int16_t sc_x = me_ctx->search_results[li][ri].hme_sc_x;
+                    int16_t sc_y = me_ctx->search_results[li][ri].hme_sc_y;
+                    if (me_b64_sad(me_ctx->me_ds_ref_array[li][ri].picture_ptr,
+                                   me_ctx,
+                                   b64_origin_x,
+                                   b64_origin_y,
+                                   &sc_x,
+                                   &sc_y) <= tf_sad[li][ri])
+                        continue;
+                }
+                me_ctx->search_results[li][ri].hme_sc_x = pre_sc_x[li][ri];
+                me_ctx->search_results[li][ri].hme_sc_y = pre_sc_y[li][ri];
+                me_ctx->search_results[li][ri].hme_sad  = tf_sad[li][ri];
+            }
+        }
+    } else {
+        // HME: Perform Hierachical Motion Estimation for all refrence frames for the current 64x64 block.
+        hme_b64(pcs, b64_origin_x, b64_origin_y, me_ctx, input_ptr);
+    }
 
     if (me_ctx->me_type == ME_MCTF &&
         me_ctx->search_results[0][0].hme_sad < me_ctx->tf_me_exit_th) {
@@ -36,6 +36,8 @@ extern "C" {
         MeContext                 *me_ctx,
         EbPictureBufferDesc       *input_ptr);
 
+    extern void svt_aom_me_hash_build_if_needed(EbPaReferenceObject *ref_obj);
+
     extern void svt_aom_downsample_2d_c(
         uint8_t                   *input_samples,
         uint32_t                   input_stride,
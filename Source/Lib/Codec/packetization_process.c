@@ -427,6 +427,7 @@ void release_references_eos(SequenceControlSet *scs) {
             svt_release_object(ref_entry->reference_object_ptr);
             ref_entry->reference_object_ptr  = (EbObjectWrapper *)NULL;
             ref_entry->reference_available   = FALSE;
+            ref_entry->reference_started     = FALSE;
             ref_entry->is_ref                = FALSE;
             ref_entry->is_valid              = false;
             ref_entry->frame_context_updated = FALSE;
@@ -898,8 +899,6 @@ void *svt_aom_packetization_kernel(void *input_ptr) {
             svt_post_full_object(picture_manager_results_wrapper_ptr);
         // Post Rate Control Task. Be done after postig to PM as RC might release ppcs
         svt_post_full_object(rate_control_tasks_wrapper_ptr);
-        if (pcs->ppcs->frm_hdr.allow_intrabc)
-            svt_av1_hash_table_destroy(&pcs->hash_table);
         svt_release_object(pcs->ppcs->enc_dec_ptr->enc_dec_wrapper); // Child
         // Release the Parent PCS then the Child PCS
         assert(entropy_coding_results_ptr->pcs_wrapper->live_count == 1);
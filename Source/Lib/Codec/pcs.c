@@ -211,6 +211,8 @@ static void picture_control_set_dctor(EbPtr p) {
     EB_DESTROY_MUTEX(obj->intra_mutex);
     EB_DESTROY_MUTEX(obj->cdef_search_mutex);
     EB_DESTROY_MUTEX(obj->rest_search_mutex);
+    EB_DESTROY_MUTEX(obj->hash_mutex);
+    EB_DESTROY_SEMAPHORE(obj->hash_done_semaphore);
 }
 
 typedef struct InitData {
@@ -475,7 +477,7 @@ static EbErrorType picture_control_set_ctor(PictureControlSet *object_ptr, EbPtr
 
     object_ptr->dctor = picture_control_set_dctor;
 
-    object_ptr->hash_table.p_lookup_table = NULL;
+    memset(&object_ptr->hash_table, 0, sizeof(object_ptr->hash_table));
 
     // Init Picture Init data
     uint16_t padding = init_data_ptr->sb_size + 32;
@@ -1042,6 +1044,8 @@ static EbErrorType picture_control_set_ctor(PictureControlSet *object_ptr, EbPtr
     EB_MALLOC_ARRAY(object_ptr->skip_cdef_seg, picture_sb_width * picture_sb_height);
     EB_MALLOC_ARRAY(object_ptr->cdef_dir_data, picture_sb_width * picture_sb_height);
     EB_CREATE_MUTEX(object_ptr->rest_search_mutex);
+    EB_CREATE_MUTEX(object_ptr->hash_mutex);
+    EB_CREATE_SEMAPHORE(object_ptr->hash_done_semaphore, 0, 1);
 
     //the granularity is 4x4
     EB_MALLOC_ARRAY(object_ptr->mi_grid_base,
@@ -1147,10 +1151,13 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     EB_FREE_ARRAY(obj->rc_me_distortion);
     EB_FREE_ARRAY(obj->stationary_block_present_sb);
     EB_FREE_ARRAY(obj->rc_me_allow_gm);
+    EB_FREE_ARRAY(obj->b64_static);
     EB_FREE_ARRAY(obj->me_64x64_distortion);
     EB_FREE_ARRAY(obj->me_32x32_distortion);
     EB_FREE_ARRAY(obj->me_16x16_distortion);
     EB_FREE_ARRAY(obj->me_8x8_distortion);
+    EB_FREE_ARRAY(obj->tf_me_mv);
+    EB_FREE_ARRAY(obj->me_epzs_mv);
 
     EB_FREE_ARRAY(obj->me_8x8_cost_variance);
     if (obj->av1_cm) {
@@ -1180,8 +1187,6 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     EB_DESTROY_MUTEX(obj->pcs_total_rate_mutex);
     if (obj->dg_detector)
         EB_DELETE(obj->dg_detector);
-    EB_DELETE(obj->quarter_src_pic);
-    EB_DELETE(obj->sixteenth_src_pic);
 }
 /*
 ppcs_update_param: update the parameters in PictureParentControlSet for changing the resolution on the fly
@@ -1223,35 +1228,6 @@ EbErrorType ppcs_update_param(PictureParentControlSet *ppcs) {
     ppcs->render_width   = scs->max_input_luma_width;
     ppcs->render_height  = scs->max_input_luma_height;
 
-    if (svt_aom_need_gm_ref_info(scs->static_config.enc_mode, scs->static_config.resize_mode == RESIZE_NONE)) {
-        EbPictureBufferDescInitData input_pic_buf_desc_init_data;
-        input_pic_buf_desc_init_data.max_width          = scs->max_input_luma_width >> 1;
-        input_pic_buf_desc_init_data.max_height         = scs->max_input_luma_height >> 1;
-        input_pic_buf_desc_init_data.bit_depth          = 8; //Should be 8bit
-        input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK;
-        input_pic_buf_desc_init_data.left_padding       = 32;
-        input_pic_buf_desc_init_data.right_padding      = 32;
-        input_pic_buf_desc_init_data.top_padding        = 32;
-        input_pic_buf_desc_init_data.bot_padding        = 32;
-        input_pic_buf_desc_init_data.color_format       = EB_YUV420;
-        input_pic_buf_desc_init_data.split_mode         = FALSE;
-
-        svt_picture_buffer_desc_update(ppcs->quarter_src_pic, (EbPtr)(&input_pic_buf_desc_init_data));
-
-        input_pic_buf_desc_init_data.max_width          = scs->max_input_luma_width >> 2;
-        input_pic_buf_desc_init_data.max_height         = scs->max_input_luma_height >> 2;
-        input_pic_buf_desc_init_data.bit_depth          = 8; //Should be 8bit
-        input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK;
-        input_pic_buf_desc_init_data.left_padding       = 16;
-        input_pic_buf_desc_init_data.right_padding      = 16;
-        input_pic_buf_desc_init_data.top_padding        = 16;
-        input_pic_buf_desc_init_data.bot_padding        = 16;
-        input_pic_buf_desc_init_data.color_format       = EB_YUV420;
-        input_pic_buf_desc_init_data.split_mode         = FALSE;
-
-        svt_picture_buffer_desc_update(ppcs->sixteenth_src_pic, (EbPtr)(&input_pic_buf_desc_init_data));
-    }
-
     return return_error;
 }
 static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *object_ptr, EbPtr object_init_data_ptr) {
@@ -1333,10 +1309,14 @@ static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *obje
     EB_MALLOC_ARRAY(object_ptr->rc_me_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->stationary_block_present_sb, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->rc_me_allow_gm, object_ptr->b64_total_count);
+    EB_MALLOC_ARRAY(object_ptr->b64_static, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_64x64_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_32x32_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_16x16_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_8x8_distortion, object_ptr->b64_total_count);
+    EB_MALLOC_ARRAY(object_ptr->tf_me_mv, object_ptr->b64_total_count * 2);
+    EB_MALLOC_ARRAY(object_ptr->me_epzs_mv,
+                    object_ptr->b64_total_count * MAX_NUM_OF_REF_PIC_LIST * REF_LIST_MAX_DEPTH);
 
     EB_MALLOC_ARRAY(object_ptr->me_8x8_cost_variance, object_ptr->b64_total_count);
     // SB noise variance array
@@ -1425,35 +1405,6 @@ static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *obje
         : 0;
     EB_NEW(object_ptr->dg_detector, svt_aom_dg_detector_seg_ctor);
 
-    if (svt_aom_need_gm_ref_info(init_data_ptr->enc_mode, init_data_ptr->static_config.resize_mode == RESIZE_NONE)) {
-        EbPictureBufferDescInitData input_pic_buf_desc_init_data;
-        input_pic_buf_desc_init_data.max_width          = init_data_ptr->picture_width >> 1;
-        input_pic_buf_desc_init_data.max_height         = init_data_ptr->picture_height >> 1;
-        input_pic_buf_desc_init_data.bit_depth          = 8; //Should be 8bit
-        input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK;
-        input_pic_buf_desc_init_data.left_padding       = 32;
-        input_pic_buf_desc_init_data.right_padding      = 32;
-        input_pic_buf_desc_init_data.top_padding        = 32;
-        input_pic_buf_desc_init_data.bot_padding        = 32;
-        input_pic_buf_desc_init_data.color_format       = EB_YUV420;
-        input_pic_buf_desc_init_data.split_mode         = FALSE;
-
-        EB_NEW(object_ptr->quarter_src_pic, svt_picture_buffer_desc_ctor, (EbPtr)(&input_pic_buf_desc_init_data));
-
-        input_pic_buf_desc_init_data.max_width          = init_data_ptr->picture_width >> 2;
-        input_pic_buf_desc_init_data.max_height         = init_data_ptr->picture_height >> 2;
-        input_pic_buf_desc_init_data.bit_depth          = 8; //Should be 8bit
-        input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK;
-        input_pic_buf_desc_init_data.left_padding       = 16;
-        input_pic_buf_desc_init_data.right_padding      = 16;
-        input_pic_buf_desc_init_data.top_padding        = 16;
-        input_pic_buf_desc_init_data.bot_padding        = 16;
-        input_pic_buf_desc_init_data.color_format       = EB_YUV420;
-        input_pic_buf_desc_init_data.split_mode         = FALSE;
-
-        EB_NEW(object_ptr->sixteenth_src_pic, svt_picture_buffer_desc_ctor, (EbPtr)(&input_pic_buf_desc_init_data));
-    }
-
     return return_error;
 }
 static void me_dctor(EbPtr p) {
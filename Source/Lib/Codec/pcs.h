@@ -54,11 +54,19 @@ typedef struct DepCntPicInfo {
     // increase(e.g 4L->5L) or decrease of dep cnt . not including the run-time decrease
     int32_t dep_cnt_diff;
 } DepCntPicInfo;
+// Full-pel 64x64 motion found by the temporal filtering, reused as a search centre by the PA ME
+typedef struct TfMeMv {
+    int16_t mv_x;
+    int16_t mv_y;
+    // signed distance (in pictures) to the reference the motion points to; 0 when not available
+    int8_t dist;
+} TfMeMv;
 typedef struct EbDownScaledBufDescPtrArray {
     EbPictureBufferDesc *picture_ptr;
     EbPictureBufferDesc *quarter_picture_ptr;
     EbPictureBufferDesc *sixteenth_picture_ptr;
     uint64_t             picture_number;
+    const HashTable     *hash_table; // 64x64 block hashes of picture_ptr; NULL when the hash ME pre-pass is off
 } EbDownScaledBufDescPtrArray;
 
 typedef struct EbDownScaledObject {
@@ -276,6 +284,10 @@ typedef struct PictureControlSet {
     uint8_t      rest_segments_row_count;
     // flag to indicate whether the frame is extended for restoration search
     Bool rest_extend_flag[3];
+    // next rest. unit to be searched, per plane; units are handed out one at a time to the rest. threads
+    int32_t rest_unit_next[3];
+    // unit info of the warm start reference for the restoration search, per plane; NULL if not available
+    RestorationUnitInfo *rest_warm_start_info[3];
 
     // Slice Type
     SliceType slice_type;
@@ -396,8 +408,12 @@ typedef struct PictureControlSet {
     SpeedFeatures    sf;
     SearchSiteConfig ss_cfg; // CHKN this might be a seq based
     HashTable        hash_table;
-    CRC_CALCULATOR   crc_calculator1;
-    CRC_CALCULATOR   crc_calculator2;
+    // IntraBC hash generation: the level being generated is split in row
+    // bands processed by the EncDec threads
+    BlockHashLevel hash_level;
+    uint16_t       hash_bands_done;
+    EbHandle       hash_mutex;
+    EbHandle       hash_done_semaphore;
 
     FRAME_CONTEXT                  *ec_ctx_array;
     FRAME_CONTEXT                   md_frame_context;
@@ -516,7 +532,8 @@ typedef struct TplControls {
     int8_t  reduced_tpl_group;
     double  r0_adjust_factor;
     // 0: use 16x16 block(s), 1: use 32x32 block(s), 2: use 64x64 block(s)  (for incomplete 64x64,
-    // dispenser_search_level is set to 0)
+    // dispenser_search_level is set to scs->tpl_ds_level). Sizes are at full resolution and are at least
+    // 16x16 at the resolution TPL works at
     uint8_t dispenser_search_level;
     // it is recommended to use subsample_tx=2, when dispenser_search_level is set to 1
     // 0: OFF, use full TX size; 1: subsample the transforms in TPL by 2; 2: subsample the
@@ -531,6 +548,9 @@ typedef struct TplControls {
     subpel_depth;
     // Specifies the subpel accuracy for diagonal position(s)
     uint8_t subpel_diag_refinement;
+    // 0: OFF, 1: reuse the dispenser stats of the pictures already dispensed in the previous (overlapping) TPL
+    // group. Approximation: the recon based costs of a reused picture are the ones of the previous TPL group
+    uint8_t reuse_prev_group_stats;
 } TplControls;
 
 typedef struct {
@@ -587,6 +607,8 @@ typedef struct GmControls {
     bool ref_idx0_only;
     // if true, apply an offset to the segments of the me-dist based modulation
     uint8_t qp_offset;
+    // 0: run a fixed number of RANSAC trials, 1: cap the trials based on the inlier ratio of the best model
+    uint8_t ransac_adaptive_trials;
 } GmControls;
 typedef struct CdefControls {
     uint8_t enabled;
@@ -806,8 +828,6 @@ typedef struct PictureParentControlSet {
     double                                  luma_ssim;
     double                                  cr_ssim;
     double                                  cb_ssim;
-    EbPictureBufferDesc                    *quarter_src_pic;
-    EbPictureBufferDesc                    *sixteenth_src_pic;
     // Pointer array for down scaled pictures
     EbObjectWrapper            *downscaled_pic_wrapper;
     EbDownScaledBufDescPtrArray ds_pics;
@@ -837,12 +857,23 @@ typedef struct PictureParentControlSet {
     // otherwise
     uint8_t *stationary_block_present_sb;
     uint8_t *rc_me_allow_gm;
+    // 1 when the source of the 64x64 block is identical to the first list 0 reference (static SB
+    // fast path), 0 otherwise; only valid when static_sb_skip is set
+    uint8_t *b64_static;
+    uint8_t  static_sb_skip;
 
     uint32_t *me_8x8_cost_variance;
     uint32_t *me_64x64_distortion;
     uint32_t *me_32x32_distortion;
     uint32_t *me_16x16_distortion;
     uint32_t *me_8x8_distortion;
+    // TF motion per 64x64 block: [2 * b64_index] for the past side, [2 * b64_index + 1] for the future side
+    TfMeMv *tf_me_mv;
+    // TRUE when tf_me_mv was filled by the temporal filtering of this picture
+    Bool tf_me_mv_valid;
+    // Best full-pel 64x64 ME MV per SB and reference, indexed by
+    // (b64_index * MAX_NUM_OF_REF_PIC_LIST + list) * REF_LIST_MAX_DEPTH + ref; predictors of the EPZS
+    uint32_t *me_epzs_mv;
     // Global motion estimation results
     Bool                 is_global_motion[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
     EbWarpedMotionParams svt_aom_global_motion_estimation[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
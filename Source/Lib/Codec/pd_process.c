@@ -3430,8 +3430,10 @@ static void mctf_frame(
             pd_ctx->tf_motion_direction = -1;
         }
     }
-    else
-        pcs->do_tf = FALSE; // set temporal filtering flag OFF for current picture
+    else {
+        pcs->do_tf          = FALSE; // set temporal filtering flag OFF for current picture
+        pcs->tf_me_mv_valid = FALSE;
+    }
 
     pcs->is_noise_level = (pd_ctx->last_i_noise_levels_log1p_fp16[0] >= VQ_NOISE_LVL_TH);
 
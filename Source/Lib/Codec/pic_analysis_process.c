@@ -2139,9 +2139,11 @@ void svt_aom_is_screen_content(PictureParentControlSet *pcs) {
 void svt_aom_downsample_filtering_input_picture(PictureParentControlSet *pcs, EbPictureBufferDesc *input_padded_pic,
                                                 EbPictureBufferDesc *quarter_picture_ptr,
                                                 EbPictureBufferDesc *sixteenth_picture_ptr) {
-    // Downsample input picture for HME L0 and L1
-    if (pcs->enable_hme_flag || pcs->tf_enable_hme_flag) {
-        if (pcs->enable_hme_level1_flag || pcs->tf_enable_hme_level1_flag) {
+    // Downsample input picture for HME L0 and L1, and for the downscaled TPL
+    const uint8_t tpl_ds_level = pcs->scs->tpl_ds_level;
+    if (pcs->enable_hme_flag || pcs->tf_enable_hme_flag || tpl_ds_level) {
+        const Bool quarter_needed = pcs->enable_hme_level1_flag || pcs->tf_enable_hme_level1_flag || tpl_ds_level;
+        if (quarter_needed) {
             downsample_2d(
                 &input_padded_pic
                      ->buffer_y[input_padded_pic->org_x + input_padded_pic->org_y * input_padded_pic->stride_y],
@@ -2160,9 +2162,9 @@ void svt_aom_downsample_filtering_input_picture(PictureParentControlSet *pcs, Eb
                                      quarter_picture_ptr->org_y);
         }
 
-        if (pcs->enable_hme_level0_flag || pcs->tf_enable_hme_level0_flag) {
+        if (pcs->enable_hme_level0_flag || pcs->tf_enable_hme_level0_flag || tpl_ds_level == 2) {
             // Sixteenth Input Picture Downsampling
-            if (pcs->enable_hme_level1_flag || pcs->tf_enable_hme_level1_flag)
+            if (quarter_needed)
                 downsample_2d(
                     &quarter_picture_ptr->buffer_y[quarter_picture_ptr->org_x +
                                                    quarter_picture_ptr->org_y * quarter_picture_ptr->stride_y],
@@ -2283,6 +2285,64 @@ void svt_aom_pad_input_pictures(SequenceControlSet *scs, EbPictureBufferDesc *in
  *then used to compute statistics
  *
  ********************************************************************************/
+/************************************************
+ * Hash the source of each complete 64x64 block (8-bit samples of all planes, plus the 2 LSBs for
+ * 10-bit input), so that the static SBs of a picture can be found by comparing its hashes to the
+ * ones of its reference. The upper 32 bits hash the luma, the lower 32 bits the chroma.
+ ************************************************/
+static void compute_b64_source_hashes(PictureParentControlSet *pcs, EbPictureBufferDesc *input_pic,
+                                      EbPaReferenceObject *pa_ref_obj) {
+    uint32_t row_crc[4 * BLOCK_SIZE_64];
+
+    for (uint16_t b64_idx = 0; b64_idx < pcs->b64_total_count; ++b64_idx) {
+        const B64Geom *b64_geom = &pcs->b64_geom[b64_idx];
+        if (!b64_geom->is_complete_b64) {
+            pa_ref_obj->b64_src_hash[b64_idx] = 0;
+            continue;
+        }
+        const uint32_t org_x    = input_pic->org_x + b64_geom->org_x;
+        const uint32_t org_y    = input_pic->org_y + b64_geom->org_y;
+        const uint32_t stride_y = input_pic->stride_y;
+        const uint32_t stride_c = input_pic->stride_cb;
+        uint32_t       crc_cnt  = 0;
+
+        const uint8_t *src_y = input_pic->buffer_y + org_y * stride_y + org_x;
+        for (uint32_t r = 0; r < BLOCK_SIZE_64; r++)
+            row_crc[crc_cnt++] = svt_av1_get_crc32c_value((const uint32_t *)(src_y + r * stride_y),
+                                                          BLOCK_SIZE_64 >> 2);
+        if (input_pic->buffer_bit_inc_y) {
+            const uint8_t *src_inc = input_pic->buffer_bit_inc_y + org_y * (stride_y >> 2) + (org_x >> 2);
+            for (uint32_t r = 0; r < BLOCK_SIZE_64; r++)
+                row_crc[crc_cnt++] = svt_av1_get_crc32c_value((const uint32_t *)(src_inc + r * (stride_y >> 2)),
+                                                              BLOCK_SIZE_64 >> 4);
+        }
+        const uint64_t luma_hash = svt_av1_get_crc32c_value(row_crc, crc_cnt);
+
+        crc_cnt                  = 0;
+        const uint32_t c_offset  = (org_y >> 1) * stride_c + (org_x >> 1);
+        const uint8_t *src_cb    = input_pic->buffer_cb + c_offset;
+        const uint8_t *src_cr    = input_pic->buffer_cr + c_offset;
+        for (uint32_t r = 0; r < (BLOCK_SIZE_64 >> 1); r++) {
+            row_crc[crc_cnt++] = svt_av1_get_crc32c_value((const uint32_t *)(src_cb + r * stride_c),
+                                                          BLOCK_SIZE_64 >> 3);
+            row_crc[crc_cnt++] = svt_av1_get_crc32c_value((const uint32_t *)(src_cr + r * stride_c),
+                                                          BLOCK_SIZE_64 >> 3);
+        }
+        if (input_pic->buffer_bit_inc_cb) {
+            const uint32_t c_offset_inc = (org_y >> 1) * (stride_c >> 2) + (org_x >> 3);
+            const uint8_t *src_cb_inc   = input_pic->buffer_bit_inc_cb + c_offset_inc;
+            const uint8_t *src_cr_inc   = input_pic->buffer_bit_inc_cr + c_offset_inc;
+            for (uint32_t r = 0; r < (BLOCK_SIZE_64 >> 1); r++) {
+                row_crc[crc_cnt++] = svt_av1_get_crc32c_value(
+                    (const uint32_t *)(src_cb_inc + r * (stride_c >> 2)), BLOCK_SIZE_64 >> 5);
+                row_crc[crc_cnt++] = svt_av1_get_crc32c_value(
+                    (const uint32_t *)(src_cr_inc + r * (stride_c >> 2)), BLOCK_SIZE_64 >> 5);
+            }
+        }
+        pa_ref_obj->b64_src_hash[b64_idx] = (luma_hash << 32) | svt_av1_get_crc32c_value(row_crc, crc_cnt);
+    }
+}
+
 void *svt_aom_picture_analysis_kernel(void *input_ptr) {
     EbThreadContext         *thread_ctx = (EbThreadContext *)input_ptr;
     PictureAnalysisContext  *pa_ctx     = (PictureAnalysisContext *)thread_ctx->priv;
@@ -2378,6 +2438,12 @@ void *svt_aom_picture_analysis_kernel(void *input_ptr) {
                         scs->static_config.screen_content_mode;
             }
         }
+        // Source hashes for the static SB detection of the pictures referencing this one
+        if (scs->static_sb_skip) {
+            compute_b64_source_hashes(
+                pcs, pcs->enhanced_pic, (EbPaReferenceObject *)pcs->pa_ref_pic_wrapper->object_ptr);
+            memset(pcs->b64_static, 0, sizeof(*pcs->b64_static) * pcs->b64_total_count);
+        }
         // Get Empty Results Object
         svt_get_empty_object(pa_ctx->picture_analysis_results_output_fifo_ptr, &out_results_wrapper);
 
@@ -23,7 +23,9 @@ typedef enum EbPicType {
     EB_PIC_INPUT          = 1,
     EB_PIC_REFERENCE      = 2,
     EB_PIC_FEEDBACK       = 3,
-    EB_PIC_SUPERRES_INPUT = 4
+    EB_PIC_SUPERRES_INPUT = 4,
+    // the reference picture started its EncDec (cross-picture wavefront)
+    EB_PIC_REFERENCE_STARTED = 5
 } EbPicType;
 
 /**************************************
@@ -404,6 +404,7 @@ void *svt_aom_picture_manager_kernel(void *input_ptr) {
                 ref_entry->reference_object_ptr          = (EbObjectWrapper *)NULL;
                 ref_entry->release_enable                = TRUE;
                 ref_entry->reference_available           = FALSE;
+                ref_entry->reference_started             = FALSE;
                 ref_entry->slice_type                    = pcs->slice_type;
                 ref_entry->temporal_layer_index          = pcs->temporal_layer_index;
                 ref_entry->frame_context_updated         = FALSE;
@@ -453,6 +454,30 @@ void *svt_aom_picture_manager_kernel(void *input_ptr) {
                                EB_ENC_PM_ERROR8);
 #if OPT_LD_LATENCY2
             svt_release_mutex(enc_ctx->ref_pic_list_mutex);
+#endif
+            break;
+        case EB_PIC_REFERENCE_STARTED:
+            // Cross-picture wavefront: the pictures referencing this one can start now, and wait in
+            // EncDec for the reference rows they need
+            scs     = input_pic_demux->scs;
+            enc_ctx = scs->enc_ctx;
+            ((EbReferenceObject *)input_pic_demux->ref_pic_wrapper->object_ptr)->ds_pics.picture_number =
+                input_pic_demux->picture_number;
+#if OPT_LD_LATENCY2
+            svt_block_on_mutex(enc_ctx->ref_pic_list_mutex);
+#endif
+            for (uint32_t i = 0; i < enc_ctx->ref_pic_list_length; i++) {
+                ref_entry = enc_ctx->ref_pic_list[i];
+                if (ref_entry->is_valid && ref_entry->picture_number == input_pic_demux->picture_number) {
+                    ref_entry->reference_object_ptr = input_pic_demux->ref_pic_wrapper;
+                    ref_entry->reference_started    = TRUE;
+                    break;
+                }
+                // Check if the reference list is full
+                CHECK_REPORT_ERROR(i != enc_ctx->ref_pic_list_length - 1, enc_ctx->app_callback_ptr, EB_ENC_PM_ERROR5);
+            }
+#if OPT_LD_LATENCY2
+            svt_release_mutex(enc_ctx->ref_pic_list_mutex);
 #endif
             break;
         case EB_PIC_FEEDBACK:
@@ -553,6 +578,9 @@ void *svt_aom_picture_manager_kernel(void *input_ptr) {
                                     ? FALSE
                                     : (ref_entry->reference_available) ? TRUE
                                                                        : // The Reference has been completed
+                                    (entry_scs_ptr->cross_pic_wavefront && ref_entry->reference_started)
+                                    ? TRUE
+                                    : // The Reference is being reconstructed (cross-picture wavefront)
                                     FALSE; // The Reference has not been completed
                             } else {
                                 availability_flag = FALSE;
@@ -957,6 +985,7 @@ void *svt_aom_picture_manager_kernel(void *input_ptr) {
                         svt_release_object(ref_entry->reference_object_ptr);
                         ref_entry->reference_object_ptr  = (EbObjectWrapper *)NULL;
                         ref_entry->reference_available   = FALSE;
+                        ref_entry->reference_started     = FALSE;
                         ref_entry->is_ref                = FALSE;
                         ref_entry->is_valid              = false;
                         ref_entry->frame_context_updated = FALSE;
@@ -46,6 +46,9 @@ typedef struct ReferenceQueueEntry {
     EbObjectWrapper *reference_object_ptr;
     Bool             release_enable;
     Bool             reference_available;
+    // the reference started its EncDec, and publishes its rows as they are reconstructed
+    // (cross-picture wavefront)
+    Bool reference_started;
     Bool             is_ref;
     uint64_t         rc_group_index;
     Bool             is_alt_ref;
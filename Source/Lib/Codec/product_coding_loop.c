@@ -38,6 +38,7 @@
 #include "inter_prediction.h"
 #include "enc_intra_prediction.h"
 #include "mode_decision.h"
+#include "md_early_term.h"
 #define INIT_BIT_EST 6000
 #define DIVIDE_AND_ROUND(x, y) (((x) + ((y) >> 1)) / (y))
 void     svt_aom_apply_segmentation_based_quantization(const BlockGeom *blk_geom, PictureControlSet *pcs,
@@ -1497,42 +1498,37 @@ void set_md_stage_counts(PictureControlSet *pcs, ModeDecisionContext *ctx) {
             ctx->md_stage_3_count[cidx] = ctx->md_stage_2_count[cidx];
     }
 }
+/* Exchange sort of cand_buff_indices by increasing cost. The costs are gathered from the contiguous cost
+ * array (which the candidate buffers' cost pointers point into) into a scratch array and swapped along with
+ * the indices, so the compare loop does not chase the candidate buffer pointers. */
+static void sort_cand_buff_indices(struct ModeDecisionContext *ctx, const uint64_t *cost_array, uint32_t count,
+                                   uint32_t *cand_buff_indices) {
+    uint64_t *cost = ctx->cand_sort_cost;
+    assert(count <= ctx->max_nics_uv);
+    for (uint32_t i = 0; i < count; ++i) cost[i] = cost_array[cand_buff_indices[i]];
+    for (uint32_t i = 0; i + 1 < count; ++i) {
+        for (uint32_t j = i + 1; j < count; ++j) {
+            if (cost[j] < cost[i]) {
+                const uint64_t tmp_cost  = cost[i];
+                const uint32_t tmp_index = cand_buff_indices[i];
+                cost[i]                  = cost[j];
+                cand_buff_indices[i]     = cand_buff_indices[j];
+                cost[j]                  = tmp_cost;
+                cand_buff_indices[j]     = tmp_index;
+            }
+        }
+    }
+}
 static void sort_fast_cost_based_candidates(
     struct ModeDecisionContext *ctx, uint32_t input_buffer_start_idx,
     uint32_t  input_buffer_count, //how many cand buffers to sort. one of the buffer can have max cost.
     uint32_t *cand_buff_indices) {
-    ModeDecisionCandidateBuffer **buffer_ptr_array     = ctx->cand_bf_ptr_array;
-    uint32_t                      input_buffer_end_idx = input_buffer_start_idx + input_buffer_count - 1;
-    uint32_t                      buffer_index, i, j;
-    uint32_t                      k = 0;
-    for (buffer_index = input_buffer_start_idx; buffer_index <= input_buffer_end_idx; buffer_index++, k++) {
-        cand_buff_indices[k] = buffer_index;
-    }
-    for (i = 0; i < input_buffer_count - 1; ++i) {
-        for (j = i + 1; j < input_buffer_count; ++j) {
-            if (*(buffer_ptr_array[cand_buff_indices[j]]->fast_cost) <
-                *(buffer_ptr_array[cand_buff_indices[i]]->fast_cost)) {
-                buffer_index         = cand_buff_indices[i];
-                cand_buff_indices[i] = (uint32_t)cand_buff_indices[j];
-                cand_buff_indices[j] = (uint32_t)buffer_index;
-            }
-        }
-    }
+    for (uint32_t k = 0; k < input_buffer_count; k++) cand_buff_indices[k] = input_buffer_start_idx + k;
+    sort_cand_buff_indices(ctx, ctx->fast_cost_array, input_buffer_count, cand_buff_indices);
 }
 void sort_full_cost_based_candidates(struct ModeDecisionContext *ctx, uint32_t num_of_cand_to_sort,
                                      uint32_t *cand_buff_indices) {
-    uint32_t                      i, j, index;
-    ModeDecisionCandidateBuffer **buffer_ptr_array = ctx->cand_bf_ptr_array;
-    for (i = 0; i < num_of_cand_to_sort - 1; ++i) {
-        for (j = i + 1; j < num_of_cand_to_sort; ++j) {
-            if (*(buffer_ptr_array[cand_buff_indices[j]]->full_cost) <
-                *(buffer_ptr_array[cand_buff_indices[i]]->full_cost)) {
-                index                = cand_buff_indices[i];
-                cand_buff_indices[i] = (uint32_t)cand_buff_indices[j];
-                cand_buff_indices[j] = (uint32_t)index;
-            }
-        }
-    }
+    sort_cand_buff_indices(ctx, ctx->full_cost_array, num_of_cand_to_sort, cand_buff_indices);
 }
 static void construct_best_sorted_arrays_md_stage_3(
     struct ModeDecisionContext *ctx,
@@ -1671,9 +1667,8 @@ static bool process_cand_itr(ModeDecisionCandidate *cand, uint8_t itr, Predictio
 
 static void md_stage_0(PictureControlSet *pcs, ModeDecisionContext *ctx,
                        ModeDecisionCandidateBuffer **cand_bf_ptr_array_base,
-                       ModeDecisionCandidate *fast_candidate_array, uint32_t fast_cand_count,
-                       EbPictureBufferDesc *input_pic, BlockLocation *loc, uint32_t cand_bf_start_index,
-                       uint32_t max_buffers) {
+                       ModeDecisionCandidate *fast_candidate_array, EbPictureBufferDesc *input_pic,
+                       BlockLocation *loc, uint32_t cand_bf_start_index, uint32_t max_buffers) {
     const uint8_t apply_unipred_bias = pcs->scs->vq_ctrls.sharpness_ctrls.unipred_bias && pcs->ppcs->is_noise_level;
     // Set MD Staging fast_loop_core settings
     ctx->mds_skip_ifs = (ctx->ifs_ctrls.level == IFS_MDS0) ? FALSE : TRUE;
@@ -1706,12 +1701,12 @@ static void md_stage_0(PictureControlSet *pcs, ModeDecisionContext *ctx,
 
     uint32_t tot_processed_cand = 0;
 
+    const uint16_t *class_cand_idx   = ctx->fast_cand_class_idx[ctx->target_class];
+    const uint32_t  class_cand_count = ctx->md_stage_0_count[ctx->target_class];
     for (uint8_t itr = 0; itr < tot_itr; itr++) {
-        for (uint32_t cand_idx = 0; cand_idx < fast_cand_count; cand_idx++) {
-            if (fast_candidate_array[cand_idx].cand_class != ctx->target_class)
-                continue;
-
-            ModeDecisionCandidateBuffer *cand_bf = cand_bf_ptr_array_base[highest_cost_index];
+        for (uint32_t class_cand = 0; class_cand < class_cand_count; class_cand++) {
+            const uint32_t               cand_idx = class_cand_idx[class_cand];
+            ModeDecisionCandidateBuffer *cand_bf  = cand_bf_ptr_array_base[highest_cost_index];
             ModeDecisionCandidate       *cand = cand_bf->cand = &fast_candidate_array[cand_idx];
             cand->tx_depth                                    = 0;
             cand->interp_filters                              = default_interp_filter;
@@ -1948,6 +1943,12 @@ static void md_full_pel_search(PictureControlSet *pcs, ModeDecisionContext *ctx,
         (ref_pic->org_y + ref_pic->max_height - 1))
         search_position_end_y = (ref_pic->org_y + ref_pic->max_height - 1) -
             (ctx->blk_org_y + ctx->blk_geom->bheight + (mvy >> 3));
+    // Stay within the reference rows that are ready (cross-picture wavefront)
+    if ((mvy >> 3) + search_position_end_y > svt_aom_wavefront_max_mv_row(ctx)) {
+        search_position_end_y = svt_aom_wavefront_max_mv_row(ctx) - (mvy >> 3);
+        if (search_position_end_y < search_position_start_y)
+            return;
+    }
     if (dist_type == SAD && ctx->enable_psad) {
         if (!hbd_md && (search_position_end_x - search_position_start_x) >= 7) {
             md_full_pel_search_large_lbd(&mv_cost_params,
@@ -2246,7 +2247,7 @@ static void md_nsq_motion_search(PictureControlSet *pcs, ModeDecisionContext *ct
    clips input MV (in 1/8 precision) to stay within boundaries of a given ref pic
 */
 static void clip_mv_on_pic_boundary(int32_t blk_org_x, int32_t blk_org_y, int32_t bwidth, int32_t bheight,
-                                    EbPictureBufferDesc *ref_pic, int16_t *mvx, int16_t *mvy) {
+                                    EbPictureBufferDesc *ref_pic, int32_t max_mv_row, int16_t *mvx, int16_t *mvy) {
     if (blk_org_x + (*mvx >> 3) + bwidth > ref_pic->max_width + ref_pic->org_x)
         *mvx = (ref_pic->max_width - blk_org_x) << 3;
 
@@ -2258,6 +2259,10 @@ static void clip_mv_on_pic_boundary(int32_t blk_org_x, int32_t blk_org_y, int32_
 
     if (blk_org_y + (*mvy >> 3) < -ref_pic->org_y)
         *mvy = (-blk_org_y - bheight) << 3;
+
+    // Reference rows available to the block (cross-picture wavefront)
+    if (*mvy > max_mv_row * 8)
+        *mvy = (int16_t)(max_mv_row * 8);
 }
 /*
  * Check the size of the spatial MVs and MVPs of the given block
@@ -2534,7 +2539,8 @@ static int md_subpel_search(SUBPEL_STAGE       search_stage, //ME or PME
     int      mi_height = mi_size_high[ctx->blk_geom->bsize];
     mv_limits.row_min  = -(((mi_row + mi_height) * MI_SIZE) + AOM_INTERP_EXTEND);
     mv_limits.col_min  = -(((mi_col + mi_width) * MI_SIZE) + AOM_INTERP_EXTEND);
-    mv_limits.row_max  = (cm->mi_rows - mi_row) * MI_SIZE + AOM_INTERP_EXTEND;
+    mv_limits.row_max  = AOMMIN((cm->mi_rows - mi_row) * MI_SIZE + AOM_INTERP_EXTEND,
+                               svt_aom_wavefront_max_mv_row(ctx));
     mv_limits.col_max  = (cm->mi_cols - mi_col) * MI_SIZE + AOM_INTERP_EXTEND;
     svt_av1_set_mv_search_range(&mv_limits, &ref_mv);
     svt_av1_set_subpel_mv_search_range(&ms_params->mv_limits, (FullMvLimits *)&mv_limits, &ref_mv);
@@ -2655,6 +2661,9 @@ static void read_refine_me_mvs_light_pd1(PictureControlSet *pcs, EbPictureBuffer
                 const MvCandidate mv_cand = me_mv_array_base[list ? max_l0 : 0];
                 int16_t           me_mv_x = mv_cand.x_mv << 3;
                 int16_t           me_mv_y = mv_cand.y_mv << 3;
+                // Reference rows available to the block (cross-picture wavefront)
+                if (me_mv_y > svt_aom_wavefront_max_mv_row(ctx) * 8)
+                    me_mv_y = (int16_t)(svt_aom_wavefront_max_mv_row(ctx) * 8);
                 // can only skip if using dc only b/c otherwise need cost at candidate generation
                 const bool skip_subpel = skip_subpel_1 &&
                     (skip_subpel_2 || (skip_zero_mv && me_mv_x == 0 && me_mv_y == 0));
@@ -2702,6 +2711,7 @@ static void read_refine_me_mvs_light_pd1(PictureControlSet *pcs, EbPictureBuffer
                                         blk_geom->bwidth,
                                         blk_geom->bheight,
                                         ref_pic,
+                                        svt_aom_wavefront_max_mv_row(ctx),
                                         &ctx->sb_me_mv[list][ref][0],
                                         &ctx->sb_me_mv[list][ref][1]);
             }
@@ -2769,8 +2779,14 @@ static void read_refine_me_mvs(PictureControlSet *pcs, ModeDecisionContext *ctx)
                     me_mv_x                   = mv_cand.x_mv << 3;
                     me_mv_y                   = mv_cand.y_mv << 3;
                 }
-                clip_mv_on_pic_boundary(
-                    ctx->blk_org_x, ctx->blk_org_y, blk_geom->bwidth, blk_geom->bheight, ref_pic, &me_mv_x, &me_mv_y);
+                clip_mv_on_pic_boundary(ctx->blk_org_x,
+                                        ctx->blk_org_y,
+                                        blk_geom->bwidth,
+                                        blk_geom->bheight,
+                                        ref_pic,
+                                        svt_aom_wavefront_max_mv_row(ctx),
+                                        &me_mv_x,
+                                        &me_mv_y);
                 // Set ref MV
                 IntMv   best_pred_mv[2] = {{0}, {0}};
                 uint8_t drl_index       = 0;
@@ -2844,6 +2860,7 @@ static void read_refine_me_mvs(PictureControlSet *pcs, ModeDecisionContext *ctx)
                                         blk_geom->bwidth,
                                         blk_geom->bheight,
                                         ref_pic,
+                                        svt_aom_wavefront_max_mv_row(ctx),
                                         &ctx->sb_me_mv[list][ref][0],
                                         &ctx->sb_me_mv[list][ref][1]);
                 if (blk_geom->shape == PART_N) {
@@ -3052,6 +3069,7 @@ static void build_single_ref_mvp_array(PictureControlSet *pcs, ModeDecisionConte
                                     blk_geom->bwidth,
                                     blk_geom->bheight,
                                     ref_pic,
+                                    svt_aom_wavefront_max_mv_row(ctx),
                                     &ctx->mvp_array[list][ref][mvp_count].col,
                                     &ctx->mvp_array[list][ref][mvp_count].row);
             mvp_count++;
@@ -3068,6 +3086,7 @@ static void build_single_ref_mvp_array(PictureControlSet *pcs, ModeDecisionConte
                                         blk_geom->bwidth,
                                         blk_geom->bheight,
                                         ref_pic,
+                                        svt_aom_wavefront_max_mv_row(ctx),
                                         &nearmv.col,
                                         &nearmv.row);
 
@@ -7574,18 +7593,18 @@ static void post_mds0_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
                 (int)(mult * MAX((best_md_stage_cost / ((ctx->blk_geom->bwidth * ctx->blk_geom->bheight) << 10)), 1) *
                       ((5 * pcs->ppcs->scs->static_config.qp) - 50)));
 
-    uint64_t                      mds1_class_th            = (pruning_ctrls.mds1_class_th * q_weight) / 1000;
-    uint8_t                       mds1_band_cnt            = pruning_ctrls.mds1_band_cnt;
-    uint16_t                      mds1_cand_th_rank_factor = pruning_ctrls.mds1_cand_th_rank_factor;
-    uint64_t                      mds1_cand_base_th_intra  = (pruning_ctrls.mds1_cand_base_th_intra * q_weight) / 1000;
-    uint64_t                      mds1_cand_base_th_inter  = (pruning_ctrls.mds1_cand_base_th_inter * q_weight) / 1000;
-    ModeDecisionCandidateBuffer **cand_bf_arr              = ctx->cand_bf_ptr_array;
+    uint64_t        mds1_class_th            = (pruning_ctrls.mds1_class_th * q_weight) / 1000;
+    uint8_t         mds1_band_cnt            = pruning_ctrls.mds1_band_cnt;
+    uint16_t        mds1_cand_th_rank_factor = pruning_ctrls.mds1_cand_th_rank_factor;
+    uint64_t        mds1_cand_base_th_intra  = (pruning_ctrls.mds1_cand_base_th_intra * q_weight) / 1000;
+    uint64_t        mds1_cand_base_th_inter  = (pruning_ctrls.mds1_cand_base_th_inter * q_weight) / 1000;
+    const uint64_t *fast_cost_array          = ctx->fast_cost_array;
     for (CandClass cidx = CAND_CLASS_0; cidx < CAND_CLASS_TOTAL; cidx++) {
         const uint64_t mds1_cand_th = is_intra_class(cidx) ? mds1_cand_base_th_intra : mds1_cand_base_th_inter;
         if ((mds1_cand_th != (uint64_t)~0 || mds1_class_th != (uint64_t)~0) && ctx->md_stage_0_count[cidx] > 0 &&
             ctx->md_stage_1_count[cidx] > 0) {
             const uint32_t *cand_buff = ctx->cand_buff_indices[cidx];
-            const uint64_t  best_cost = *cand_bf_arr[cand_buff[0]]->fast_cost;
+            const uint64_t  best_cost = fast_cost_array[cand_buff[0]];
             // inter class pruning
             if (best_cost && best_md_stage_cost && best_cost != best_md_stage_cost) {
                 if (mds1_class_th == 0) {
@@ -7608,7 +7627,7 @@ static void post_mds0_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
             uint32_t cand_count = 1;
             if (best_cost) {
                 while (cand_count < ctx->md_stage_1_count[cidx] &&
-                       (*cand_bf_arr[cand_buff[cand_count]]->fast_cost - best_cost) * 100 / best_cost <
+                       (fast_cost_array[cand_buff[cand_count]] - best_cost) * 100 / best_cost <
                            mds1_cand_th / (mds1_cand_th_rank_factor ? mds1_cand_th_rank_factor * cand_count : 1))
                     cand_count++;
             }
@@ -7652,16 +7671,16 @@ static void post_mds1_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
                           1) *
                       ((5 * pcs->ppcs->scs->static_config.qp) - 50)));
 
-    const uint64_t                mds2_cand_th         = (pruning_ctrls.mds2_cand_base_th * q_weight) / 1000;
-    const uint64_t                mds2_class_th        = (pruning_ctrls.mds2_class_th * q_weight) / 1000;
-    const uint8_t                 mds2_band_cnt        = pruning_ctrls.mds2_band_cnt;
-    const uint16_t                mds2_relative_dev_th = pruning_ctrls.mds2_relative_dev_th;
-    ModeDecisionCandidateBuffer **cand_bf_arr          = ctx->cand_bf_ptr_array;
+    const uint64_t  mds2_cand_th         = (pruning_ctrls.mds2_cand_base_th * q_weight) / 1000;
+    const uint64_t  mds2_class_th        = (pruning_ctrls.mds2_class_th * q_weight) / 1000;
+    const uint8_t   mds2_band_cnt        = pruning_ctrls.mds2_band_cnt;
+    const uint16_t  mds2_relative_dev_th = pruning_ctrls.mds2_relative_dev_th;
+    const uint64_t *full_cost_array      = ctx->full_cost_array;
     for (CandClass cidx = CAND_CLASS_0; cidx < CAND_CLASS_TOTAL; cidx++) {
         if ((mds2_cand_th != (uint64_t)~0 || mds2_class_th != (uint64_t)~0) && ctx->md_stage_1_count[cidx] > 0 &&
             ctx->md_stage_2_count[cidx] > 0 && ctx->bypass_md_stage_1 == FALSE) {
             const uint32_t *cand_buff = ctx->cand_buff_indices[cidx];
-            const uint64_t  best_cost = *cand_bf_arr[cand_buff[0]]->full_cost;
+            const uint64_t  best_cost = full_cost_array[cand_buff[0]];
 
             // class pruning
             if (best_cost && best_md_stage_cost && best_cost != best_md_stage_cost) {
@@ -7694,7 +7713,7 @@ static void post_mds1_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
                         else if (ctx->mds0_best_idx == ctx->mds1_best_idx)
                             mds2_cand_th_rank_factor += 2;
                     }
-                    uint64_t dev      = (*cand_bf_arr[cand_buff[cand_count]]->full_cost - best_cost) * 100 / best_cost;
+                    uint64_t dev      = (full_cost_array[cand_buff[cand_count]] - best_cost) * 100 / best_cost;
                     uint64_t prev_dev = dev;
                     while (
                         (!mds2_relative_dev_th || dev <= prev_dev + mds2_relative_dev_th) &&
@@ -7704,7 +7723,7 @@ static void post_mds1_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
                         if (cand_count >= ctx->md_stage_2_count[cidx])
                             break;
                         prev_dev = dev;
-                        dev      = (*cand_bf_arr[cand_buff[cand_count]]->full_cost - best_cost) * 100 / best_cost;
+                        dev      = (full_cost_array[cand_buff[cand_count]] - best_cost) * 100 / best_cost;
                     }
                 }
                 ctx->md_stage_2_count[cidx] = cand_count;
@@ -7731,16 +7750,16 @@ static void post_mds2_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
                           1) *
                       ((5 * pcs->ppcs->scs->static_config.qp) - 50)));
 
-    const uint64_t                mds3_cand_th  = (pruning_ctrls.mds3_cand_base_th * q_weight) / 1000;
-    const uint64_t                mds3_class_th = (pruning_ctrls.mds3_class_th * q_weight) / 1000;
-    const uint8_t                 mds3_band_cnt = pruning_ctrls.mds3_band_cnt;
-    ModeDecisionCandidateBuffer **cand_bf_arr   = ctx->cand_bf_ptr_array;
-    ctx->md_stage_3_total_count                 = 0;
+    const uint64_t  mds3_cand_th    = (pruning_ctrls.mds3_cand_base_th * q_weight) / 1000;
+    const uint64_t  mds3_class_th   = (pruning_ctrls.mds3_class_th * q_weight) / 1000;
+    const uint8_t   mds3_band_cnt   = pruning_ctrls.mds3_band_cnt;
+    const uint64_t *full_cost_array = ctx->full_cost_array;
+    ctx->md_stage_3_total_count     = 0;
     for (CandClass cidx = CAND_CLASS_0; cidx < CAND_CLASS_TOTAL; cidx++) {
         if ((mds3_cand_th != (uint64_t)~0 || mds3_class_th != (uint64_t)~0) && ctx->md_stage_2_count[cidx] > 0 &&
             ctx->md_stage_3_count[cidx] > 0 && ctx->bypass_md_stage_2 == FALSE) {
             const uint32_t *cand_buff = ctx->cand_buff_indices[cidx];
-            const uint64_t  best_cost = *cand_bf_arr[cand_buff[0]]->full_cost;
+            const uint64_t  best_cost = full_cost_array[cand_buff[0]];
 
             // inter class pruning
             if (best_cost && best_md_stage_cost && best_cost != best_md_stage_cost) {
@@ -7765,7 +7784,7 @@ static void post_mds2_nic_pruning(PictureControlSet *pcs, ModeDecisionContext *c
             if (best_cost)
                 while (
                     cand_count < ctx->md_stage_3_count[cidx] &&
-                    (((*cand_bf_arr[cand_buff[cand_count]]->full_cost - best_cost) * 100) / best_cost < mds3_cand_th)) {
+                    (((full_cost_array[cand_buff[cand_count]] - best_cost) * 100) / best_cost < mds3_cand_th)) {
                     cand_count++;
                 }
             ctx->md_stage_3_count[cidx] = cand_count;
@@ -9122,7 +9141,6 @@ static void md_encode_block(PictureControlSet *pcs, ModeDecisionContext *ctx, ui
                        ctx,
                        cand_bf_ptr_array_base,
                        ctx->fast_cand_array,
-                       fast_candidate_total_count,
                        input_pic,
                        &loc,
                        buffer_start_idx,
@@ -9130,8 +9148,8 @@ static void md_encode_block(PictureControlSet *pcs, ModeDecisionContext *ctx, ui
             //Sort:  md_stage_1_count[cand_class_it]
             uint32_t *cand_buff_indices = ctx->cand_buff_indices[cand_class_it];
             if (ctx->md_stage_1_count[cand_class_it] == 1) {
-                cand_buff_indices[0] = *(cand_bf_ptr_array[buffer_start_idx]->fast_cost) <
-                        *(cand_bf_ptr_array[buffer_start_idx + 1]->fast_cost)
+                cand_buff_indices[0] = ctx->fast_cost_array[buffer_start_idx] <
+                        ctx->fast_cost_array[buffer_start_idx + 1]
                     ? buffer_start_idx
                     : buffer_start_idx + 1;
             } else {
@@ -9142,8 +9160,8 @@ static void md_encode_block(PictureControlSet *pcs, ModeDecisionContext *ctx, ui
                         1, // # cands to sort. buffer_count_for_curr_class may be wrong when multiple iterations used at MDS0
                     ctx->cand_buff_indices[cand_class_it]);
             }
-            if (*(ctx->cand_bf_ptr_array[cand_buff_indices[0]]->fast_cost) < best_md_stage_cost) {
-                best_md_stage_cost      = *(ctx->cand_bf_ptr_array[cand_buff_indices[0]]->fast_cost);
+            if (ctx->fast_cost_array[cand_buff_indices[0]] < best_md_stage_cost) {
+                best_md_stage_cost      = ctx->fast_cost_array[cand_buff_indices[0]];
                 best_md_stage_dist      = ctx->cand_bf_ptr_array[cand_buff_indices[0]]->luma_fast_dist;
                 ctx->mds0_best_idx      = cand_buff_indices[0];
                 ctx->mds0_best_class_it = cand_class_it;
@@ -9183,8 +9201,8 @@ static void md_encode_block(PictureControlSet *pcs, ModeDecisionContext *ctx, ui
                     sort_full_cost_based_candidates(
                         ctx, ctx->md_stage_1_count[cand_class_it], ctx->cand_buff_indices[cand_class_it]);
                 uint32_t *cand_buff_indices = ctx->cand_buff_indices[cand_class_it];
-                if (*(ctx->cand_bf_ptr_array[cand_buff_indices[0]]->full_cost) < best_md_stage_cost) {
-                    best_md_stage_cost      = *(ctx->cand_bf_ptr_array[cand_buff_indices[0]]->full_cost);
+                if (ctx->full_cost_array[cand_buff_indices[0]] < best_md_stage_cost) {
+                    best_md_stage_cost      = ctx->full_cost_array[cand_buff_indices[0]];
                     ctx->mds1_best_idx      = cand_buff_indices[0];
                     ctx->mds1_best_class_it = cand_class_it;
                 }
@@ -9222,7 +9240,7 @@ static void md_encode_block(PictureControlSet *pcs, ModeDecisionContext *ctx, ui
                     ctx, ctx->md_stage_2_count[cand_class_it], ctx->cand_buff_indices[cand_class_it]);
 
             uint32_t *cand_buff_indices = ctx->cand_buff_indices[cand_class_it];
-            best_md_stage_cost = MIN((*(ctx->cand_bf_ptr_array[cand_buff_indices[0]]->full_cost)), best_md_stage_cost);
+            best_md_stage_cost = MIN(ctx->full_cost_array[cand_buff_indices[0]], best_md_stage_cost);
         }
     }
 
@@ -10098,6 +10116,8 @@ static bool get_skip_processing_nsq_block(PictureControlSet *pcs, ModeDecisionCo
         return TRUE;
     if (update_md_settings_based_on_sq_coeff_area(pcs, ctx))
         return TRUE;
+    if (svt_aom_etm_skip_nsq_shape(pcs, ctx))
+        return TRUE;
     return skip_processing_block;
 }
 /*
@@ -10345,6 +10365,30 @@ static const uint32_t ns_blk_offset_128_md[PART_S] = {
  */
 void svt_aom_mode_decision_sb_light_pd0(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
                                         const MdcSbData *const mdc_sb_data) {
+    svt_aom_init_sb_light_pd0(pcs, ctx);
+
+    Bool     md_early_exit_sq          = 0;
+    uint32_t next_non_skip_blk_idx_mds = 0;
+    svt_aom_mode_decision_leaves_light_pd0(
+        scs, pcs, ctx, mdc_sb_data, 0, mdc_sb_data->leaf_count, &next_non_skip_blk_idx_mds, &md_early_exit_sq);
+}
+/*
+ * Return TRUE if light-PD0 exits the depth of the given block early, before searching it, based on the
+ * cost of its parent.
+ */
+Bool svt_aom_light_pd0_depth_early_exit(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
+                                        uint32_t blk_idx_mds) {
+    Bool     md_early_exit_sq          = 0;
+    uint32_t next_non_skip_blk_idx_mds = 0;
+    ctx->blk_geom                      = get_blk_geom_mds(blk_idx_mds);
+    ctx->blk_ptr                       = &ctx->md_blk_arr_nsq[blk_idx_mds];
+    check_curr_to_parent_cost_light_pd0(scs, pcs, ctx, &next_non_skip_blk_idx_mds, &md_early_exit_sq);
+    return md_early_exit_sq;
+}
+/*
+ * Set the SB-level variables used by light-PD0.
+ */
+void svt_aom_init_sb_light_pd0(PictureControlSet *pcs, ModeDecisionContext *ctx) {
     // Set SB-level variables here
     ctx->tx_depth                 = 0;
     ctx->txb_1d_offset            = 0;
@@ -10358,19 +10402,22 @@ void svt_aom_mode_decision_sb_light_pd0(SequenceControlSet *scs, PictureControlS
     // Update neighbour arrays for the SB
     if (!ctx->skip_intra)
         update_neighbour_arrays_light_pd0(pcs, ctx);
-
+}
+/*
+ * Perform light-PD0 mode decision for the leaves [leaf_start, leaf_end) of the SB. The depth early exit
+ * state is carried across calls that cover consecutive leaf ranges.
+ */
+void svt_aom_mode_decision_leaves_light_pd0(SequenceControlSet *scs, PictureControlSet *pcs, ModeDecisionContext *ctx,
+                                            const MdcSbData *const mdc_sb_data, uint32_t leaf_start,
+                                            uint32_t leaf_end, uint32_t *next_non_skip_blk_idx_mds,
+                                            Bool *md_early_exit_sq) {
     // get the input picture; if high bit-depth, pad the input pic
     EbPictureBufferDesc *input_pic = pcs->ppcs->enhanced_pic;
 
-    // Initialize variables used to track blocks
-    uint32_t                   leaf_count      = mdc_sb_data->leaf_count;
     const EbMdcLeafData *const leaf_data_array = mdc_sb_data->leaf_data_array;
 
-    Bool     md_early_exit_sq          = 0;
-    uint32_t next_non_skip_blk_idx_mds = 0;
-
     // Iterate over all blocks which are flagged to be considered
-    for (uint32_t blk_idx = 0; blk_idx < leaf_count; blk_idx++) {
+    for (uint32_t blk_idx = leaf_start; blk_idx < leaf_end; blk_idx++) {
         uint32_t blk_idx_mds = leaf_data_array[blk_idx].mds_idx;
         blk_idx_mds += ns_blk_offset_md[leaf_data_array[blk_idx].shapes[0]];
         const uint8_t blk_split_flag = mdc_sb_data->split_flag[blk_idx];
@@ -10382,8 +10429,8 @@ void svt_aom_mode_decision_sb_light_pd0(SequenceControlSet *scs, PictureControlS
                                 input_pic,
                                 ctx->sb_index,
                                 blk_idx_mds,
-                                &next_non_skip_blk_idx_mds,
-                                &md_early_exit_sq);
+                                next_non_skip_blk_idx_mds,
+                                md_early_exit_sq);
         ctx->md_blk_arr_nsq[ctx->blk_geom->sqi_mds].part        = from_shape_to_part[ctx->blk_geom->shape];
         ctx->md_blk_arr_nsq[ctx->blk_geom->sqi_mds].best_d1_blk = blk_idx_mds;
         if (blk_idx_mds != ctx->blk_geom->sqi_mds) {
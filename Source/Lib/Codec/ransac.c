@@ -17,55 +17,56 @@
 #include "mathutils.h"
 #include "random.h"
 #include "common_dsp_rtcd.h"
+#include "aom_dsp_rtcd.h"
 #include "utility.h"
 
 #define MAX_MINPTS 4
 #define MAX_DEGENERATE_ITER 10
 #define MINPTS_MULTIPLIER 5
 
-#define INLIER_THRESHOLD_POW2 1.5625 /*(1.25 * 1.25)*/
+#define INLIER_THRESHOLD_POW2 1.5625f /*(1.25 * 1.25)*/
 #define MIN_TRIALS 20
+// Lower bound on the number of trials when the trial count adapts to the inlier ratio
+#define MIN_ADAPTIVE_TRIALS 6
+// Probability that at least one of the adaptive trials draws an outlier-free sample
+#define RANSAC_CONFIDENCE 0.99
 
 ////////////////////////////////////////////////////////////////////////////////
 // ransac
 typedef int (*IsDegenerateFunc)(double *p);
 typedef int (*FindTransformationFunc)(int points, double *points1, double *points2, double *params);
-typedef void (*ProjectPointsDoubleFunc)(double *mat, double *points, double *proj, int n, int stride_points,
-                                        int stride_proj);
-
-static void project_points_double_translation(double *mat, double *points, double *proj, int n, int stride_points,
-                                              int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = x + mat[0];
-        *(proj++) = y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
-    }
+typedef void (*ParamsToAffineFunc)(const double *params, float *mat);
+
+// Expand the model parameters to the full affine form used by the inlier scoring:
+// x' = mat[2] * x + mat[3] * y + mat[0], y' = mat[4] * x + mat[5] * y + mat[1]
+static void params_to_affine_translation(const double *params, float *mat) {
+    mat[0] = (float)params[0];
+    mat[1] = (float)params[1];
+    mat[2] = 1.0f;
+    mat[3] = 0.0f;
+    mat[4] = 0.0f;
+    mat[5] = 1.0f;
 }
 
-static void project_points_double_rotzoom(double *mat, double *points, double *proj, int n, int stride_points,
-                                          int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = mat[2] * x + mat[3] * y + mat[0];
-        *(proj++) = -mat[3] * x + mat[2] * y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
-    }
+static void params_to_affine_rotzoom(const double *params, float *mat) {
+    mat[0] = (float)params[0];
+    mat[1] = (float)params[1];
+    mat[2] = (float)params[2];
+    mat[3] = (float)params[3];
+    mat[4] = (float)-params[3];
+    mat[5] = (float)params[2];
+}
+
+static void params_to_affine_affine(const double *params, float *mat) {
+    for (int i = 0; i < 6; ++i) mat[i] = (float)params[i];
 }
 
-static void project_points_double_affine(double *mat, double *points, double *proj, int n, int stride_points,
-                                         int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = mat[2] * x + mat[3] * y + mat[0];
-        *(proj++) = mat[4] * x + mat[5] * y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
+void svt_av1_ransac_inlier_dist_c(const float *mat, const float *x1, const float *y1, const float *x2, const float *y2,
+                                  float *dist_pow2, int n) {
+    for (int i = 0; i < n; ++i) {
+        const float dx = mat[2] * x1[i] + mat[3] * y1[i] + mat[0] - x2[i];
+        const float dy = mat[4] * x1[i] + mat[5] * y1[i] + mat[1] - y2[i];
+        dist_pow2[i]   = dx * dx + dy * dy;
     }
 }
 
@@ -322,9 +323,7 @@ typedef struct {
 } RANSAC_MOTION;
 
 // Return -1 if 'a' is a better motion, 1 if 'b' is better, 0 otherwise.
-static int compare_motions(const void *arg_a, const void *arg_b) {
-    const RANSAC_MOTION *motion_a = (RANSAC_MOTION *)arg_a;
-    const RANSAC_MOTION *motion_b = (RANSAC_MOTION *)arg_b;
+static int compare_motions(const RANSAC_MOTION *motion_a, const RANSAC_MOTION *motion_b) {
 
     if (motion_a->num_inliers > motion_b->num_inliers)
         return -1;
@@ -349,6 +348,33 @@ static void copy_points_at_indices(double *dest, const double *src, const int *i
     }
 }
 
+// Sort the motions, best first. Only a handful of motions are kept, so an insertion sort is
+// cheaper than going through qsort and its indirect comparisons.
+static void sort_motions(RANSAC_MOTION *motions, int num_motions) {
+    for (int i = 1; i < num_motions; ++i) {
+        const RANSAC_MOTION motion = motions[i];
+        int                 j      = i - 1;
+        while (j >= 0 && is_better_motion(&motion, &motions[j])) {
+            motions[j + 1] = motions[j];
+            j--;
+        }
+        motions[j + 1] = motion;
+    }
+}
+
+// Number of trials needed to draw at least one outlier-free sample of minpts points with
+// RANSAC_CONFIDENCE, given the inlier ratio of the best motion found so far. Clamped to
+// [MIN_ADAPTIVE_TRIALS, MIN_TRIALS] so the adaptive search never runs longer than the fixed one.
+static int get_adaptive_trials(int num_inliers, int npoints, int minpts) {
+    const double p_good_sample = pow((double)num_inliers / npoints, minpts);
+    if (p_good_sample <= 0.0)
+        return MIN_TRIALS;
+    if (p_good_sample >= 1.0)
+        return MIN_ADAPTIVE_TRIALS;
+    const double trials = ceil(log(1.0 - RANSAC_CONFIDENCE) / log(1.0 - p_good_sample));
+    return (int)CLIP3(MIN_ADAPTIVE_TRIALS, MIN_TRIALS, trials);
+}
+
 static const double k_infinite_variance = 1e12;
 
 static void clear_motion(RANSAC_MOTION *motion, int num_points) {
@@ -358,9 +384,10 @@ static void clear_motion(RANSAC_MOTION *motion, int num_points) {
 }
 
 static int ransac(const int *matched_points, int npoints, int *num_inliers_by_motion, MotionModel *params_by_motion,
-                  int num_desired_motions, int minpts, IsDegenerateFunc is_degenerate,
-                  FindTransformationFunc find_transformation, ProjectPointsDoubleFunc projectpoints) {
+                  int num_desired_motions, uint8_t adaptive_trials, int minpts, IsDegenerateFunc is_degenerate,
+                  FindTransformationFunc find_transformation, ParamsToAffineFunc params_to_affine) {
     int trial_count = 0;
+    int max_trials  = MIN_TRIALS;
     int ret_val     = 0;
 
     unsigned int seed = (unsigned int)npoints;
@@ -369,7 +396,11 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
     double *points1, *points2;
     double *corners1, *corners2;
-    double *image1_coord;
+    // Single precision copies of the corners, one plane per coordinate, used to score the
+    // candidate motions
+    float *x1, *y1, *x2, *y2;
+    float *dist_pow2;
+    float  mat[6];
 
     // Store information for the num_desired_motions best transformations found
     // and the worst motion among them, as well as the motion currently under
@@ -392,7 +423,11 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
     points2      = (double *)malloc(sizeof(*points2) * npoints * 2);
     corners1     = (double *)malloc(sizeof(*corners1) * npoints * 2);
     corners2     = (double *)malloc(sizeof(*corners2) * npoints * 2);
-    image1_coord = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    x1           = (float *)malloc(sizeof(*x1) * npoints * 5);
+    y1           = x1 ? x1 + npoints : NULL;
+    x2           = x1 ? y1 + npoints : NULL;
+    y2           = x1 ? x2 + npoints : NULL;
+    dist_pow2    = x1 ? y2 + npoints : NULL;
 
     motions = (RANSAC_MOTION *)malloc(sizeof(RANSAC_MOTION) * num_desired_motions);
     assert(motions != NULL);
@@ -405,7 +440,7 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
     worst_kept_motion = motions;
 
-    if (!(points1 && points2 && corners1 && corners2 && image1_coord && motions && current_motion.inlier_indices)) {
+    if (!(points1 && points2 && corners1 && corners2 && x1 && motions && current_motion.inlier_indices)) {
         ret_val = 1;
         goto finish_ransac;
     }
@@ -413,13 +448,17 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
     cnp1 = corners1;
     cnp2 = corners2;
     for (int i = 0; i < npoints; ++i) {
+        x1[i]     = (float)matched_points[0];
+        y1[i]     = (float)matched_points[1];
+        x2[i]     = (float)matched_points[2];
+        y2[i]     = (float)matched_points[3];
         *(cnp1++) = *(matched_points++);
         *(cnp1++) = *(matched_points++);
         *(cnp2++) = *(matched_points++);
         *(cnp2++) = *(matched_points++);
     }
 
-    while (MIN_TRIALS > trial_count) {
+    while (max_trials > trial_count) {
         double sum_distance         = 0.0;
         double sum_distance_squared = 0.0;
 
@@ -450,17 +489,15 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
             continue;
         }
 
-        projectpoints(params_this_motion, corners1, image1_coord, npoints, 2, 2);
+        // Score the candidate against all the correspondences at once
+        params_to_affine(params_this_motion, mat);
+        svt_av1_ransac_inlier_dist(mat, x1, y1, x2, y2, dist_pow2, npoints);
 
         for (int i = 0; i < npoints; ++i) {
-            double dx            = image1_coord[i * 2] - corners2[i * 2];
-            double dy            = image1_coord[i * 2 + 1] - corners2[i * 2 + 1];
-            double distance_pow2 = dx * dx + dy * dy;
-
-            if (distance_pow2 < INLIER_THRESHOLD_POW2) {
+            if (dist_pow2[i] < INLIER_THRESHOLD_POW2) {
                 current_motion.inlier_indices[current_motion.num_inliers++] = i;
-                sum_distance += sqrt(distance_pow2);
-                sum_distance_squared += distance_pow2;
+                sum_distance += sqrt(dist_pow2[i]);
+                sum_distance_squared += dist_pow2[i];
             }
         }
 
@@ -491,13 +528,14 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
                         worst_kept_motion = &motions[i];
                     }
                 }
+                if (adaptive_trials)
+                    max_trials = MIN(max_trials, get_adaptive_trials(current_motion.num_inliers, npoints, minpts));
             }
         }
         trial_count++;
     }
 
-    // Sort the motions, best first.
-    qsort(motions, num_desired_motions, sizeof(RANSAC_MOTION), compare_motions);
+    sort_motions(motions, num_desired_motions);
 
     // Recompute the motions using only the inliers.
     for (int i = 0; i < num_desired_motions; ++i) {
@@ -525,7 +563,7 @@ finish_ransac:
     free(points2);
     free(corners1);
     free(corners2);
-    free(image1_coord);
+    free(x1);
     free(current_motion.inlier_indices);
     if (motions) {
         for (int i = 0; i < num_desired_motions; ++i) free(motions[i].inlier_indices);
@@ -548,42 +586,45 @@ static int is_degenerate_translation(double *p) {
 static int is_degenerate_affine(double *p) { return is_collinear3(p, p + 2, p + 4); }
 
 static int ransac_translation(int *matched_points, int npoints, int *num_inliers_by_motion,
-                              MotionModel *params_by_motion, int num_desired_motions) {
+                              MotionModel *params_by_motion, int num_desired_motions, uint8_t adaptive_trials) {
     return ransac(matched_points,
                   npoints,
                   num_inliers_by_motion,
                   params_by_motion,
                   num_desired_motions,
+                  adaptive_trials,
                   3,
                   is_degenerate_translation,
                   find_translation,
-                  project_points_double_translation);
+                  params_to_affine_translation);
 }
 
 static int ransac_rotzoom(int *matched_points, int npoints, int *num_inliers_by_motion, MotionModel *params_by_motion,
-                          int num_desired_motions) {
+                          int num_desired_motions, uint8_t adaptive_trials) {
     return ransac(matched_points,
                   npoints,
                   num_inliers_by_motion,
                   params_by_motion,
                   num_desired_motions,
+                  adaptive_trials,
                   3,
                   is_degenerate_affine,
                   find_rotzoom,
-                  project_points_double_rotzoom);
+                  params_to_affine_rotzoom);
 }
 
 static int ransac_affine(int *matched_points, int npoints, int *num_inliers_by_motion, MotionModel *params_by_motion,
-                         int num_desired_motions) {
+                         int num_desired_motions, uint8_t adaptive_trials) {
     return ransac(matched_points,
                   npoints,
                   num_inliers_by_motion,
                   params_by_motion,
                   num_desired_motions,
+                  adaptive_trials,
                   3,
                   is_degenerate_affine,
                   find_affine,
-                  project_points_double_affine);
+                  params_to_affine_affine);
 }
 
 RansacFunc svt_av1_get_ransac_type(TransformationType type) {
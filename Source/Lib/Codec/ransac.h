@@ -19,7 +19,9 @@
 
 #include "global_motion.h"
 
+// adaptive_trials: 0: run a fixed number of trials, 1: stop early once the inlier ratio of the
+// best motion makes further trials unlikely to find a better one
 typedef int (*RansacFunc)(int *matched_points, int npoints, int *num_inliers_by_motion, MotionModel *params_by_motion,
-                          int num_motions);
+                          int num_motions, uint8_t adaptive_trials);
 RansacFunc svt_av1_get_ransac_type(TransformationType type);
 #endif // AOM_AV1_ENCODER_RANSAC_H_
@@ -3288,12 +3288,20 @@ void *svt_aom_rate_control_kernel(void *input_ptr) {
             if (pcs->ppcs->r0_based_qps_qpm) {
                 svt_aom_generate_r0beta(pcs->ppcs);
             }
-            // Get intra % in ref frame
-            get_ref_intra_percentage(pcs, &pcs->ref_intra_percentage);
-            // Get skip % in ref frame
-            get_ref_skip_percentage(pcs, &pcs->ref_skip_percentage);
-            // Get hp % in ref frame
-            get_ref_hp_percentage(pcs, &pcs->ref_hp_percentage);
+            if (scs->cross_pic_wavefront) {
+                // The coded areas of the references are only known once they are fully encoded, while
+                // the cross-picture wavefront may start this picture before
+                pcs->ref_intra_percentage = pcs->slice_type == I_SLICE ? 100 : 0;
+                pcs->ref_skip_percentage  = 0;
+                pcs->ref_hp_percentage    = -1;
+            } else {
+                // Get intra % in ref frame
+                get_ref_intra_percentage(pcs, &pcs->ref_intra_percentage);
+                // Get skip % in ref frame
+                get_ref_skip_percentage(pcs, &pcs->ref_skip_percentage);
+                // Get hp % in ref frame
+                get_ref_hp_percentage(pcs, &pcs->ref_hp_percentage);
+            }
             FrameHeader *frm_hdr = &pcs->ppcs->frm_hdr;
             rc                   = &scs->enc_ctx->rc;
             if (scs->passes > 1 && scs->static_config.max_bit_rate)
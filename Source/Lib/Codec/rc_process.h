@@ -204,7 +204,8 @@ typedef enum PicMgrInputPortTypes {
     PIC_MGR_INPUT_PORT_SOP           = 0,
     PIC_MGR_INPUT_PORT_PACKETIZATION = 1,
     PIC_MGR_INPUT_PORT_REST          = 2,
-    PIC_MGR_INPUT_PORT_TOTAL_COUNT   = 3,
+    PIC_MGR_INPUT_PORT_MDC           = 3,
+    PIC_MGR_INPUT_PORT_TOTAL_COUNT   = 4,
     PIC_MGR_INPUT_PORT_INVALID       = ~0,
 } PicMgrInputPortTypes;
 typedef struct PicMgrPorts {
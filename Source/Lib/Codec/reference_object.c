@@ -79,6 +79,8 @@ static void svt_reference_object_dctor(EbPtr p) {
     EB_FREE_ARRAY(obj->sb_64x64_mvp);
     EB_FREE_ARRAY(obj->sb_me_64x64_dist);
     EB_FREE_ARRAY(obj->sb_me_8x8_cost_var);
+    EB_FREE_ARRAY(obj->wavefront_row_sb_done);
+    EB_DESTROY_MUTEX(obj->wavefront_mutex);
     for (uint8_t sr_denom_idx = 0; sr_denom_idx < NUM_SR_SCALES + 1; sr_denom_idx++) {
         for (uint8_t resize_denom_idx = 0; resize_denom_idx < NUM_RESIZE_SCALES + 1; resize_denom_idx++) {
             if (obj->downscaled_reference_picture[sr_denom_idx][resize_denom_idx] != NULL) {
@@ -270,6 +272,8 @@ EbErrorType svt_reference_object_ctor(EbReferenceObject *ref_object, EbPtr objec
     EB_MALLOC_ARRAY(ref_object->sb_64x64_mvp, picture_buffer_desc_init_data_ptr->sb_total_count);
     EB_MALLOC_ARRAY(ref_object->sb_me_64x64_dist, picture_buffer_desc_init_data_ptr->sb_total_count);
     EB_MALLOC_ARRAY(ref_object->sb_me_8x8_cost_var, picture_buffer_desc_init_data_ptr->sb_total_count);
+    EB_CALLOC_ARRAY(ref_object->wavefront_row_sb_done, (picture_buffer_desc_init_data_ptr->max_height + 63) >> 6);
+    EB_CREATE_MUTEX(ref_object->wavefront_mutex);
     return EB_ErrorNone;
 }
 
@@ -287,6 +291,14 @@ EbErrorType svt_reference_object_reset(EbReferenceObject *ref_object, SequenceCo
     ref_object->mi_rows = scs->max_input_luma_height >> MI_SIZE_LOG2;
     ref_object->mi_cols = scs->max_input_luma_width >> MI_SIZE_LOG2;
 
+    if (scs->cross_pic_wavefront) {
+        ref_object->wavefront_rows_ready = 0;
+        ref_object->wavefront_rows_coded = 0;
+        ref_object->wavefront_waiters    = NULL;
+        memset(ref_object->wavefront_row_sb_done,
+               0,
+               sizeof(ref_object->wavefront_row_sb_done[0]) * ((scs->max_input_luma_height + 63) >> 6));
+    }
     return EB_ErrorNone;
 }
 
@@ -307,6 +319,9 @@ static void svt_pa_reference_object_dctor(EbPtr p) {
             EB_DESTROY_MUTEX(obj->resize_mutex[sr_denom_idx][resize_denom_idx]);
         }
     }
+    svt_av1_hash_table_destroy(&obj->me_hash_table);
+    EB_DESTROY_MUTEX(obj->me_hash_mutex);
+    EB_FREE_ARRAY(obj->b64_src_hash);
 }
 
 static void svt_tpl_reference_object_dctor(EbPtr p) {
@@ -376,6 +391,9 @@ EbErrorType svt_pa_reference_param_update(EbPaReferenceObject *pa_ref_obj, Seque
     svt_picture_buffer_desc_update(pa_ref_obj->quarter_downsampled_picture_ptr, (EbPtr)&quart_pic_buf_desc_init_data);
     svt_picture_buffer_desc_update(pa_ref_obj->sixteenth_downsampled_picture_ptr,
                                    (EbPtr)&sixteenth_pic_buf_desc_init_data);
+    EB_FREE_ARRAY(pa_ref_obj->b64_src_hash);
+    EB_MALLOC_ARRAY(pa_ref_obj->b64_src_hash,
+                    ((scs->max_input_luma_width + 63) >> 6) * ((scs->max_input_luma_height + 63) >> 6));
     return EB_ErrorNone;
 }
 /*****************************************
@@ -409,6 +427,11 @@ EbErrorType svt_pa_reference_object_ctor(EbPaReferenceObject *pa_ref_obj_, EbPtr
             EB_CREATE_MUTEX(pa_ref_obj_->resize_mutex[sr_down_idx][resize_down_idx]);
         }
     }
+    pa_ref_obj_->me_hash_picture_number = (uint64_t)~0;
+    EB_CREATE_MUTEX(pa_ref_obj_->me_hash_mutex);
+    EB_MALLOC_ARRAY(pa_ref_obj_->b64_src_hash,
+                    ((picture_buffer_desc_init_data_ptr->max_width + 63) >> 6) *
+                        ((picture_buffer_desc_init_data_ptr->max_height + 63) >> 6));
 
     return EB_ErrorNone;
 }
@@ -428,8 +451,8 @@ EbErrorType svt_tpl_reference_param_update(EbTplReferenceObject *tpl_ref_obj, Se
     EbPictureBufferDescInitData ref_pic_buf_desc_init_data;
     // PA Reference Picture Buffers
     // Currently, only Luma samples are needed in the PA
-    ref_pic_buf_desc_init_data.max_width    = scs->max_input_luma_width;
-    ref_pic_buf_desc_init_data.max_height   = scs->max_input_luma_height;
+    ref_pic_buf_desc_init_data.max_width    = scs->max_input_luma_width >> scs->tpl_ds_level;
+    ref_pic_buf_desc_init_data.max_height   = scs->max_input_luma_height >> scs->tpl_ds_level;
     ref_pic_buf_desc_init_data.bit_depth    = EB_EIGHT_BIT;
     ref_pic_buf_desc_init_data.color_format = EB_YUV420; //use 420 for picture analysis
 
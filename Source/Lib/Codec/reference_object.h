@@ -17,6 +17,7 @@
 #include "cabac_context_model.h"
 #include "coding_unit.h"
 #include "sequence_control_set.h"
+#include "hash_motion.h"
 
 typedef struct EbReferenceObject {
     EbDctor                     dctor;
@@ -61,7 +62,14 @@ typedef struct EbReferenceObject {
     uint32_t            *sb_me_8x8_cost_var;
     int32_t              mi_cols;
     int32_t              mi_rows;
-    WienerUnitInfo     **unit_info; // per plane, per rest. unit; used for fwding wiener info to future frames
+    RestorationUnitInfo **unit_info; // per plane, per rest. unit; used for fwding filter info to future frames
+    int32_t               unit_info_count[MAX_MB_PLANE]; // number of rest. units stored in unit_info, 0 if not stored
+    // Cross-picture wavefront progress (protected by wavefront_mutex)
+    uint16_t         wavefront_rows_ready; // number of SB rows that are final (deblocked and padded)
+    uint16_t         wavefront_rows_coded; // number of SB rows fully coded, from the top
+    uint16_t        *wavefront_row_sb_done; // number of coded SBs per SB row
+    EbHandle         wavefront_mutex;
+    EbObjectWrapper *wavefront_waiters; // EncDec tasks waiting for more rows, linked through wavefront_next
 } EbReferenceObject;
 
 typedef struct EbReferenceObjectDescInitData {
@@ -86,6 +94,13 @@ typedef struct EbPaReferenceObject {
     uint64_t picture_number;
     uint64_t avg_luma;
     uint8_t  dummy_obj;
+    // 64x64 block hashes of input_padded_pic for the hash ME pre-pass, built on
+    // first use by the pictures referencing this one
+    HashTable me_hash_table;
+    uint64_t  me_hash_picture_number; // picture_number the table was built for
+    EbHandle  me_hash_mutex;
+    // Per 64x64 block hash of the source (all planes), used to detect static SBs
+    uint64_t *b64_src_hash;
 } EbPaReferenceObject;
 
 typedef struct EbPaReferenceObjectDescInitData {
@@ -52,7 +52,7 @@ EbErrorType psnr_calculations(PictureControlSet *pcs, SequenceControlSet *scs, B
 EbErrorType svt_aom_ssim_calculations(PictureControlSet *pcs, SequenceControlSet *scs, Bool free_memory);
 void        pad_ref_and_set_flags(PictureControlSet *pcs, SequenceControlSet *scs);
 void        restoration_seg_search(int32_t *rst_tmpbuf, Yv12BufferConfig *org_fts, const Yv12BufferConfig *src,
-                                   Yv12BufferConfig *trial_frame_rst, PictureControlSet *pcs, uint32_t segment_index);
+                                   Yv12BufferConfig *trial_frame_rst, PictureControlSet *pcs);
 void        rest_finish_search(PictureControlSet *pcs);
 void        svt_av1_upscale_normative_rows(const Av1Common *cm, const uint8_t *src, int src_stride, uint8_t *dst,
                                            int dst_stride, int rows, int sub_x, int bd, Bool is_16bit_pipeline);
@@ -468,6 +468,10 @@ static void copy_statistics_to_ref_obj_ect(PictureControlSet *pcs, SequenceContr
     obj->intra_coded_area                   = (uint8_t)(pcs->intra_coded_area);
     obj->skip_coded_area                    = (uint8_t)(pcs->skip_coded_area);
     obj->hp_coded_area                      = (uint8_t)(pcs->hp_coded_area);
+    // With the cross-picture wavefront the remaining statistics were published while the picture
+    // was coded, and dependent pictures may already be reading them
+    if (scs->cross_pic_wavefront)
+        return;
     struct PictureParentControlSet *ppcs    = pcs->ppcs;
     FrameHeader                    *frm_hdr = &ppcs->frm_hdr;
 
@@ -501,16 +505,23 @@ static void copy_statistics_to_ref_obj_ect(PictureControlSet *pcs, SequenceContr
         obj->order_hint = pcs->ppcs->cur_order_hint;
         svt_memcpy(obj->ref_order_hint, pcs->ppcs->ref_order_hint, 7 * sizeof(uint32_t));
     }
-    // Copy the prev frame wn filter coeffs
-    if (cm->wn_filter_ctrls.enabled && cm->wn_filter_ctrls.use_prev_frame_coeffs) {
-        for (int32_t plane = 0; plane < MAX_MB_PLANE; ++plane) {
-            int32_t ntiles = pcs->rst_info[plane].units_per_tile;
-            for (int32_t u = 0; u < ntiles; ++u) {
-                obj->unit_info[plane][u].restoration_type = pcs->rst_info[plane].unit_info[u].restoration_type;
-                if (pcs->rst_info[plane].unit_info[u].restoration_type == RESTORE_WIENER)
-                    obj->unit_info[plane][u].wiener_info = pcs->rst_info[plane].unit_info[u].wiener_info;
-            }
+    // Copy the rest. unit filters, used as prev frame wn filter coeffs and as warm starts by future frames
+    const Bool store_unit_info = (cm->wn_filter_ctrls.enabled &&
+                                  (cm->wn_filter_ctrls.use_prev_frame_coeffs || cm->wn_filter_ctrls.warm_start)) ||
+        (cm->sg_filter_ctrls.enabled && cm->sg_filter_ctrls.warm_start);
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; ++plane) {
+        obj->unit_info_count[plane] = 0;
+        if (!store_unit_info)
+            continue;
+        const RestorationInfo *rsi    = &pcs->rst_info[plane];
+        int32_t                ntiles = rsi->units_per_tile;
+        for (int32_t u = 0; u < ntiles; ++u) {
+            obj->unit_info[plane][u] = rsi->unit_info[u];
+            // Units keep stale filters when the plane is not filtered
+            if (rsi->frame_restoration_type == RESTORE_NONE)
+                obj->unit_info[plane][u].restoration_type = RESTORE_NONE;
         }
+        obj->unit_info_count[plane] = ntiles;
     }
 }
 
@@ -606,8 +617,7 @@ void *svt_aom_rest_kernel(void *input_ptr) {
                     }
                 }
             }
-            restoration_seg_search(
-                context_ptr->rst_tmpbuf, &org_fts, &cpi_source, &trial_frame_rst, pcs, cdef_results->segment_index);
+            restoration_seg_search(context_ptr->rst_tmpbuf, &org_fts, &cpi_source, &trial_frame_rst, pcs);
         }
 
         //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
@@ -656,8 +666,11 @@ void *svt_aom_rest_kernel(void *input_ptr) {
 
             // Pad the reference picture and set ref POC
             {
-                if (pcs->ppcs->is_ref == TRUE)
-                    pad_ref_and_set_flags(pcs, scs);
+                // With the cross-picture wavefront the reference rows were padded as they were coded
+                if (pcs->ppcs->is_ref == TRUE) {
+                    if (!scs->cross_pic_wavefront)
+                        pad_ref_and_set_flags(pcs, scs);
+                }
                 else {
                     // convert non-reference frame buffer from 16-bit to 8-bit, to export recon and
                     // psnr/ssim calculation
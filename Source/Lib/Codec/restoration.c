@@ -1319,8 +1319,8 @@ void svt_aom_foreach_rest_unit_in_frame(Av1Common *cm, int32_t plane, RestTileSt
 static void foreach_rest_unit_in_tile_seg(const Av1PixelRect *tile_rect, int32_t tile_row, int32_t tile_col,
                                           int32_t tile_cols, int32_t hunits_per_tile, int32_t units_per_tile,
                                           int32_t unit_size, int32_t ss_y, RestUnitVisitor on_rest_unit, void *priv,
-                                          int32_t vunits_per_tile, uint8_t rest_segments_column_count,
-                                          uint8_t rest_segments_row_count, uint32_t segment_index) {
+                                          int32_t vunits_per_tile, uint32_t rest_segments_column_count,
+                                          uint32_t rest_segments_row_count, uint32_t segment_index) {
     //tile_row=0
     //tile_col=0
     //tile_cols=1
@@ -1396,7 +1396,7 @@ static void foreach_rest_unit_in_tile_seg(const Av1PixelRect *tile_rect, int32_t
 */
 void svt_aom_foreach_rest_unit_in_frame_seg(Av1Common *cm, int32_t plane, RestTileStartVisitor on_tile,
                                             RestUnitVisitor on_rest_unit, void *priv,
-                                            uint8_t rest_segments_column_count, uint8_t rest_segments_row_count,
+                                            uint32_t rest_segments_column_count, uint32_t rest_segments_row_count,
                                             uint32_t segment_index) {
     const int32_t is_uv = plane > 0;
     const int32_t ss_y  = is_uv && cm->subsampling_y;
@@ -187,10 +187,6 @@ typedef struct RestorationUnitInfo {
     SgrprojInfo     sgrproj_info;
 } RestorationUnitInfo;
 
-typedef struct WienerUnitInfo {
-    RestorationType restoration_type;
-    WienerInfo      wiener_info;
-} WienerUnitInfo;
 typedef struct Av1PixelRect {
     int32_t left, top, right, bottom;
 } Av1PixelRect;
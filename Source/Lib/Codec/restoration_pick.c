@@ -22,7 +22,7 @@
 
 void svt_aom_foreach_rest_unit_in_frame_seg(Av1Common *cm, int32_t plane, RestTileStartVisitor on_tile,
                                             RestUnitVisitor on_rest_unit, void *priv,
-                                            uint8_t rest_segments_column_count, uint8_t rest_segments_row_count,
+                                            uint32_t rest_segments_column_count, uint32_t rest_segments_row_count,
                                             uint32_t segment_index);
 
 void svt_av1_selfguided_restoration_c(const uint8_t *dgd8, int32_t width, int32_t height, int32_t dgd_stride,
@@ -552,7 +552,7 @@ static SgrprojInfo search_selfguided_restoration(const uint8_t *dat8, int32_t wi
                                                  int32_t bit_depth, int32_t pu_width, int32_t pu_height,
                                                  int32_t *rstbuf, int8_t sg_ref_frame_ep[2],
                                                  int32_t sg_frame_ep_cnt[SGRPROJ_PARAMS], SgFilterCtrls *ctrls,
-                                                 int32_t plane, int8_t step) {
+                                                 int32_t plane, int8_t step, int8_t warm_ep) {
     int32_t *flt0 = rstbuf;
     int32_t *flt1 = flt0 + RESTORATION_UNITPELS_MAX;
     int32_t  ep, bestep = 0;
@@ -564,8 +564,14 @@ static SgrprojInfo search_selfguided_restoration(const uint8_t *dat8, int32_t wi
 
     //two types of searches: Ref based (when step<16) and fixed spaced search.
     //TODO: test the fixed based for fast decode and try to unify.
+    //A warm start ep (>= 0) restricts either search to that single ep.
     int8_t start_ep, end_ep, ep_inc, do_refine;
-    if (step < 16) {
+    if (warm_ep >= 0) {
+        start_ep  = warm_ep;
+        end_ep    = warm_ep + 1;
+        ep_inc    = 1;
+        do_refine = step < 16 ? 1 : ctrls->refine[plane > 0];
+    } else if (step < 16) {
         int8_t mid_ep = sg_ref_frame_ep[0] < 0 && sg_ref_frame_ep[1] < 0 ? 0
             : sg_ref_frame_ep[1] < 0                                     ? sg_ref_frame_ep[0]
             : sg_ref_frame_ep[0] < 0                                     ? sg_ref_frame_ep[1]
@@ -1036,14 +1042,14 @@ static int32_t count_wiener_bits(int32_t wiener_win, WienerInfo *wiener_info, Wi
     return bits;
 }
 
-/* Perform refinement search around inital wiener filter coeffs passed in rui->wiener_info;
+/* Perform refinement search around inital wiener filter coeffs passed in rui->wiener_info, whose SSE is err;
    compute and return the SSE of the best filter parameters.
 */
 static int64_t finer_tile_search_wiener_seg(const RestSearchCtxt *rsc, const RestorationTileLimits *limits,
-                                            const Av1PixelRect *tile, RestorationUnitInfo *rui, int32_t wiener_win) {
+                                            const Av1PixelRect *tile, RestorationUnitInfo *rui, int32_t wiener_win,
+                                            int64_t err) {
     const Av1Common *const cm           = rsc->cm;
     const int32_t          plane_off    = (WIENER_WIN - wiener_win) >> 1;
-    int64_t                err          = try_restoration_unit_seg(rsc, limits, tile, rui);
     WienerInfo            *plane_wiener = &rui->wiener_info;
 
     if (cm->wn_filter_ctrls.use_refinement) {
@@ -1236,31 +1242,44 @@ static void search_sgrproj_seg(const RestorationTileLimits *limits, const Av1Pix
     const int32_t procunit_height = RESTORATION_PROC_UNIT_SIZE >> ss_y;
     int8_t        step            = cm->sg_filter_ctrls.step_range;
 
-    rusi->sgrproj = search_selfguided_restoration(dgd_start,
-                                                  limits->h_end - limits->h_start,
-                                                  limits->v_end - limits->v_start,
-                                                  rsc->dgd_stride,
-                                                  src_start,
-                                                  rsc->src_stride,
-                                                  highbd,
-                                                  bit_depth,
-                                                  procunit_width,
-                                                  procunit_height,
-                                                  rsc->tmpbuf,
-                                                  cm->sg_ref_frame_ep,
-                                                  cm->sg_frame_ep_cnt,
-                                                  &cm->sg_filter_ctrls,
-                                                  rsc->plane,
-                                                  step);
-    svt_block_on_mutex(cm->child_pcs->rest_search_mutex);
-    cm->sg_frame_ep_cnt[rusi->sgrproj.ep]++;
-    svt_release_mutex(cm->child_pcs->rest_search_mutex);
+    const RestorationUnitInfo *warm_info = cm->child_pcs->rest_warm_start_info[rsc->plane];
+    // Test the ep of the co-located unit first; the ep search is skipped if it removes enough of the unfiltered SSE
+    int8_t warm_ep = cm->sg_filter_ctrls.warm_start && warm_info &&
+            warm_info[rest_unit_idx].restoration_type == RESTORE_SGRPROJ
+        ? warm_info[rest_unit_idx].sgrproj_info.ep
+        : -1;
 
     RestorationUnitInfo rui;
     rui.restoration_type = RESTORE_SGRPROJ;
-    rui.sgrproj_info     = rusi->sgrproj;
+    do {
+        rusi->sgrproj = search_selfguided_restoration(dgd_start,
+                                                      limits->h_end - limits->h_start,
+                                                      limits->v_end - limits->v_start,
+                                                      rsc->dgd_stride,
+                                                      src_start,
+                                                      rsc->src_stride,
+                                                      highbd,
+                                                      bit_depth,
+                                                      procunit_width,
+                                                      procunit_height,
+                                                      rsc->tmpbuf,
+                                                      cm->sg_ref_frame_ep,
+                                                      cm->sg_frame_ep_cnt,
+                                                      &cm->sg_filter_ctrls,
+                                                      rsc->plane,
+                                                      step,
+                                                      warm_ep);
+        rui.sgrproj_info           = rusi->sgrproj;
+        rusi->sse[RESTORE_SGRPROJ] = try_restoration_unit_seg(rsc, limits, tile, &rui);
+        if (warm_ep < 0 ||
+            rusi->sse[RESTORE_SGRPROJ] * 100 <= rusi->sse[RESTORE_NONE] * (100 - cm->sg_filter_ctrls.warm_start_th))
+            break;
+        warm_ep = -1;
+    } while (1);
 
-    rusi->sse[RESTORE_SGRPROJ] = try_restoration_unit_seg(rsc, limits, tile, &rui);
+    svt_block_on_mutex(cm->child_pcs->rest_search_mutex);
+    cm->sg_frame_ep_cnt[rusi->sgrproj.ep]++;
+    svt_release_mutex(cm->child_pcs->rest_search_mutex);
 }
 
 /* Get the cost/SSE/rate of using self-guided filtering for a given restoration unit. */
@@ -1292,6 +1311,14 @@ static void search_sgrproj_finish(const RestorationTileLimits *limits, const Av1
         rsc->sgrproj = rusi->sgrproj;
 }
 
+// Check that the outer taps unused by a wiener_win filter are zero, so the filter can be reused at this window size
+static Bool wiener_fits_win(const WienerInfo *wiener_info, int32_t wiener_win) {
+    const int32_t plane_off = (WIENER_WIN - wiener_win) >> 1;
+    for (int32_t p = 0; p < plane_off; ++p)
+        if (wiener_info->vfilter[p] || wiener_info->hfilter[p])
+            return FALSE;
+    return TRUE;
+}
 /*Get the best Wiender filter parameters and SSE.*/
 static void search_wiener_seg(const RestorationTileLimits *limits, const Av1PixelRect *tile_rect, int32_t rest_unit_idx,
                               void *priv) {
@@ -1308,6 +1335,8 @@ static void search_wiener_seg(const RestorationTileLimits *limits, const Av1Pixe
     RestorationUnitInfo rui;
     memset(&rui, 0, sizeof(rui));
     rui.restoration_type = RESTORE_WIENER;
+    const RestorationUnitInfo *warm_info = cm->child_pcs->rest_warm_start_info[rsc->plane];
+    int64_t                    err       = INT64_MAX;
     // Check whether you can use the filter coeffs from previous frames; if not, must generate new coeffs
     if (wn_ctrls->use_prev_frame_coeffs &&
         (cm->child_pcs->ppcs->frm_hdr.frame_type != KEY_FRAME &&
@@ -1315,7 +1344,16 @@ static void search_wiener_seg(const RestorationTileLimits *limits, const Av1Pixe
         cm->child_pcs->rst_info[rsc->plane].unit_info[rest_unit_idx].restoration_type == RESTORE_WIENER) {
         // Copy filter info, stored from previous frame(s)
         rui.wiener_info = cm->child_pcs->rst_info[rsc->plane].unit_info[rest_unit_idx].wiener_info;
-    } else {
+        err             = try_restoration_unit_seg(rsc, limits, tile_rect, &rui);
+    } else if (wn_ctrls->warm_start && warm_info && warm_info[rest_unit_idx].restoration_type == RESTORE_WIENER &&
+               wiener_fits_win(&warm_info[rest_unit_idx].wiener_info, wiener_win)) {
+        // Keep the filter of the co-located unit if it removes enough of the unfiltered SSE
+        rui.wiener_info        = warm_info[rest_unit_idx].wiener_info;
+        const int64_t warm_err = try_restoration_unit_seg(rsc, limits, tile_rect, &rui);
+        if (warm_err * 100 <= rusi->sse[RESTORE_NONE] * (100 - wn_ctrls->warm_start_th))
+            err = warm_err;
+    }
+    if (err == INT64_MAX) {
         EB_ALIGN(32) int64_t M[WIENER_WIN2];
         EB_ALIGN(32) int64_t H[WIENER_WIN2 * WIENER_WIN2];
         int32_t              vfilterd[WIENER_WIN], hfilterd[WIENER_WIN];
@@ -1366,9 +1404,10 @@ static void search_wiener_seg(const RestorationTileLimits *limits, const Av1Pixe
 #ifdef ARCH_X86_64
         aom_clear_system_state();
 #endif
+        err = try_restoration_unit_seg(rsc, limits, tile_rect, &rui);
     }
     // Perform refinement search for filter coeffs and compute SSE
-    rusi->sse[RESTORE_WIENER] = finer_tile_search_wiener_seg(rsc, limits, tile_rect, &rui, wiener_win);
+    rusi->sse[RESTORE_WIENER] = finer_tile_search_wiener_seg(rsc, limits, tile_rect, &rui, wiener_win, err);
     rusi->wiener              = rui.wiener_info;
 
     if (wiener_win != WIENER_WIN) {
@@ -1439,6 +1478,18 @@ static void search_norestore_seg(const RestorationTileLimits *limits, const Av1P
     const int32_t highbd    = rsc->cm->use_highbitdepth;
     rusi->sse[RESTORE_NONE] = sse_restoration_unit(limits, rsc->src, rsc->cm->frame_to_show, rsc->plane, highbd);
 }
+/* Get the SSE with no filtering, then search the enabled filter types, for a given restoration unit. */
+static void search_rest_unit_seg(const RestorationTileLimits *limits, const Av1PixelRect *tile_rect,
+                                 int32_t rest_unit_idx, void *priv) {
+    RestSearchCtxt  *rsc = (RestSearchCtxt *)priv;
+    const Av1Common *cm  = rsc->cm;
+
+    search_norestore_seg(limits, tile_rect, rest_unit_idx, priv);
+    if (cm->wn_filter_ctrls.enabled && (!rsc->plane || cm->wn_filter_ctrls.use_chroma))
+        search_wiener_seg(limits, tile_rect, rest_unit_idx, priv);
+    if (cm->sg_filter_ctrls.enabled && (!rsc->plane || cm->sg_filter_ctrls.use_chroma))
+        search_sgrproj_seg(limits, tile_rect, rest_unit_idx, priv);
+}
 // Get the SSE for a resotration unit with no filtering applied
 static void search_norestore_finish(const RestorationTileLimits *limits, const Av1PixelRect *tile_rect,
                                     int32_t rest_unit_idx, void *priv) {
@@ -1466,10 +1517,11 @@ static double search_rest_type_finish(RestSearchCtxt *rsc, RestorationType rtype
 /* Search the available type of restoration filters: OFF, Wiener, and self-guided.
 
    The search will return the best parameters for each type of filter and their associated SSEs,
-   to be used in the final decision for filtering the frame.
+   to be used in the final decision for filtering the frame. Every rest. task takes the next unsearched unit
+   of the frame until all are done, so that the tasks stay balanced when the unit search costs differ.
 */
 void restoration_seg_search(int32_t *rst_tmpbuf, Yv12BufferConfig *org_fts, const Yv12BufferConfig *src,
-                            Yv12BufferConfig *trial_frame_rst, PictureControlSet *pcs, uint32_t segment_index) {
+                            Yv12BufferConfig *trial_frame_rst, PictureControlSet *pcs) {
     Av1Common *const cm = pcs->ppcs->av1_cm;
     Macroblock      *x  = pcs->ppcs->av1x;
 
@@ -1519,34 +1571,23 @@ void restoration_seg_search(int32_t *rst_tmpbuf, Yv12BufferConfig *org_fts, cons
         }
         svt_release_mutex(pcs->rest_search_mutex);
 
-        svt_aom_foreach_rest_unit_in_frame_seg(rsc_p->cm,
-                                               rsc_p->plane,
-                                               rsc_on_tile,
-                                               search_norestore_seg,
-                                               rsc_p,
-                                               pcs->rest_segments_column_count,
-                                               pcs->rest_segments_row_count,
-                                               segment_index);
-
-        if (cm->wn_filter_ctrls.enabled && (!plane || cm->wn_filter_ctrls.use_chroma))
-            svt_aom_foreach_rest_unit_in_frame_seg(rsc_p->cm,
-                                                   rsc_p->plane,
-                                                   rsc_on_tile,
-                                                   search_wiener_seg,
-                                                   rsc_p,
-                                                   pcs->rest_segments_column_count,
-                                                   pcs->rest_segments_row_count,
-                                                   segment_index);
-
-        if (cm->sg_filter_ctrls.enabled && (!plane || cm->sg_filter_ctrls.use_chroma))
+        const RestorationInfo *rsi = &pcs->rst_info[plane];
+        for (;;) {
+            svt_block_on_mutex(pcs->rest_search_mutex);
+            const int32_t unit_idx = pcs->rest_unit_next[plane]++;
+            svt_release_mutex(pcs->rest_search_mutex);
+            if (unit_idx >= rsi->units_per_tile)
+                break;
+            // A segment grid of one unit per segment visits exactly the unit unit_idx
             svt_aom_foreach_rest_unit_in_frame_seg(rsc_p->cm,
                                                    rsc_p->plane,
                                                    rsc_on_tile,
-                                                   search_sgrproj_seg,
+                                                   search_rest_unit_seg,
                                                    rsc_p,
-                                                   pcs->rest_segments_column_count,
-                                                   pcs->rest_segments_row_count,
-                                                   segment_index);
+                                                   rsi->horz_units_per_tile,
+                                                   rsi->vert_units_per_tile,
+                                                   unit_idx);
+        }
     }
 }
 /* Given the best parameters for each type of filter and their associated SSEs,
@@ -92,6 +92,9 @@ typedef struct SequenceControlSet {
     // delay all pictures within a given MG, until N future MGs are  gop , TF, and ME ready used for
     // tpl
     uint8_t tpl_lad_mg;
+    // Resolution at which the TPL dispenser works: 0: full, 1: half (1/4 pic), 2: quarter (1/16 pic).
+    // Set at the sequence level because the TPL recon buffers are allocated at that resolution
+    uint8_t tpl_ds_level;
     /*!< 1: Specifies that loop restoration filter should use boundary pixels in the search.  Must
        be set at the sequence level because it requires a buffer allocation to copy the pixels to be
        used in the search. 0: Specifies that loop restoration filter should not use boundary pixels
@@ -99,6 +102,18 @@ typedef struct SequenceControlSet {
     uint8_t use_boundaries_in_rest_search;
     uint8_t enable_pic_mgr_dec_order; // if enabled: pic mgr starts pictures in dec order
     uint8_t enable_dec_order; // if enabled: encoding are in dec order
+    /*!< Cross-picture wavefront: number of reference SB rows, below the current SB row, that a
+         dependent picture may reference before its references are fully reconstructed.
+         0: off (wait for the full references) */
+    uint8_t cross_pic_wavefront;
+    /*!< Static SB fast path: SBs with a source identical to the first list 0 reference are coded as
+         a single zero motion block without MD search */
+    uint8_t static_sb_skip;
+    /*!< Sub-SB parallel MD: the PD0 search of the 32x32 quadrants of an SB is shared with idle EncDec
+         threads */
+    uint8_t sub_sb_parallel_md;
+    /*!< MD early termination: operating point of the learned partition / NSQ pruning models (0: off) */
+    uint8_t md_early_term_level;
     /*!< Use in loop motion OIS
          Default is 1. */
     uint8_t in_loop_ois;
@@ -188,6 +203,9 @@ typedef struct SequenceControlSet {
     uint32_t enc_dec_pool_init_count;
     uint32_t pa_reference_picture_buffer_init_count;
     uint32_t tpl_reference_picture_buffer_init_count;
+    // Number of TPL group pictures that may be dispensed concurrently; each one in flight holds a TPL
+    // reference buffer on top of the DPB ones
+    uint8_t tpl_frames_in_flight;
     /* ref_buffer_available_semaphore is needed so that all REF pictures
     sent to PM will have an available ref buffer. If ref buffers are
     not available in PM, it will result in a deadlock.*/
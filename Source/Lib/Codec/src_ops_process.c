@@ -136,9 +136,11 @@ static void tpl_regular_setup_me_refs(PictureParentControlSet *base_pcs, Picture
 
             cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].picture_number = ref_obj->picture_number;
             cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].picture_ptr    = ref_obj->input_padded_pic;
-            //not needed for TPL but could be linked.
-            cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].sixteenth_picture_ptr = NULL;
-            cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].quarter_picture_ptr   = NULL;
+            // used by the downscaled TPL (tpl_ds_level)
+            cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].sixteenth_picture_ptr =
+                ref_obj->sixteenth_downsampled_picture_ptr;
+            cur_pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_idx].quarter_picture_ptr =
+                ref_obj->quarter_downsampled_picture_ptr;
         }
     }
 }
@@ -269,74 +271,31 @@ static void result_model_store(PictureParentControlSet *pcs, TplStats *tpl_stats
     tpl_stats_ptr->recrf_dist = AOMMAX(1, tpl_stats_ptr->recrf_dist);
     tpl_stats_ptr->srcrf_rate = AOMMAX(1, tpl_stats_ptr->srcrf_rate);
     tpl_stats_ptr->recrf_rate = AOMMAX(1, tpl_stats_ptr->recrf_rate);
-    if (pcs->tpl_ctrls.synth_blk_size == 32) {
-        const int stride  = (((pcs->aligned_width + 31) / 32));
-        TplStats *dst_ptr = pcs->pa_me_data->tpl_stats[(mb_origin_y >> 5) * stride + (mb_origin_x >> 5)];
-
-        //write to a 32x32 grid
-        *dst_ptr = *tpl_stats_ptr;
-    } else if (pcs->tpl_ctrls.synth_blk_size == 16) {
-        const int stride  = ((pcs->aligned_width + 15) / 16);
-        TplStats *dst_ptr = pcs->pa_me_data->tpl_stats[(mb_origin_y >> 4) * stride + (mb_origin_x >> 4)];
-
-        //write to a 16x16 grid
-        if (size == 32) {
-            //normalize based on the block size 16x16
-            tpl_stats_ptr->srcrf_dist = AOMMAX(1, tpl_stats_ptr->srcrf_dist / 4);
-            tpl_stats_ptr->recrf_dist = AOMMAX(1, tpl_stats_ptr->recrf_dist / 4);
-            tpl_stats_ptr->srcrf_rate = AOMMAX(1, tpl_stats_ptr->srcrf_rate / 4);
-            tpl_stats_ptr->recrf_rate = AOMMAX(1, tpl_stats_ptr->recrf_rate / 4);
-            dst_ptr[0]                = *tpl_stats_ptr;
-            dst_ptr[1]                = *tpl_stats_ptr;
-            dst_ptr[stride]           = *tpl_stats_ptr;
-            dst_ptr[stride + 1]       = *tpl_stats_ptr;
-        } else if (size == 16) {
-            *dst_ptr = *tpl_stats_ptr;
-        }
-    } else {
-        //for small resolution, the 16x16 data is duplicated at an 8x8 grid
-        const int stride  = ((pcs->aligned_width + 15) / 16) << 1;
-        TplStats *dst_ptr = pcs->pa_me_data->tpl_stats[(mb_origin_y >> 3) * stride + (mb_origin_x >> 3)];
-
-        //write to a 8x8 grid
-        if (size == 32) {
-            //normalize based on the block size 8x8
-            tpl_stats_ptr->srcrf_dist = AOMMAX(1, tpl_stats_ptr->srcrf_dist / 16);
-            tpl_stats_ptr->recrf_dist = AOMMAX(1, tpl_stats_ptr->recrf_dist / 16);
-            tpl_stats_ptr->srcrf_rate = AOMMAX(1, tpl_stats_ptr->srcrf_rate / 16);
-            tpl_stats_ptr->recrf_rate = AOMMAX(1, tpl_stats_ptr->recrf_rate / 16);
-            dst_ptr[0]                = *tpl_stats_ptr;
-            dst_ptr[1]                = *tpl_stats_ptr;
-            dst_ptr[2]                = *tpl_stats_ptr;
-            dst_ptr[3]                = *tpl_stats_ptr;
-
-            dst_ptr[stride]     = *tpl_stats_ptr;
-            dst_ptr[stride + 1] = *tpl_stats_ptr;
-            dst_ptr[stride + 2] = *tpl_stats_ptr;
-            dst_ptr[stride + 3] = *tpl_stats_ptr;
-
-            dst_ptr[(stride * 2)]     = *tpl_stats_ptr;
-            dst_ptr[(stride * 2) + 1] = *tpl_stats_ptr;
-            dst_ptr[(stride * 2) + 2] = *tpl_stats_ptr;
-            dst_ptr[(stride * 2) + 3] = *tpl_stats_ptr;
-
-            dst_ptr[(stride * 3)]     = *tpl_stats_ptr;
-            dst_ptr[(stride * 3) + 1] = *tpl_stats_ptr;
-            dst_ptr[(stride * 3) + 2] = *tpl_stats_ptr;
-            dst_ptr[(stride * 3) + 3] = *tpl_stats_ptr;
-
-        } else if (size == 16) {
-            //normalize based on the block size 8x8
-            tpl_stats_ptr->srcrf_dist = AOMMAX(1, tpl_stats_ptr->srcrf_dist / 4);
-            tpl_stats_ptr->recrf_dist = AOMMAX(1, tpl_stats_ptr->recrf_dist / 4);
-            tpl_stats_ptr->srcrf_rate = AOMMAX(1, tpl_stats_ptr->srcrf_rate / 4);
-            tpl_stats_ptr->recrf_rate = AOMMAX(1, tpl_stats_ptr->recrf_rate / 4);
-            dst_ptr[0]                = *tpl_stats_ptr;
-            dst_ptr[1]                = *tpl_stats_ptr;
-            dst_ptr[stride]           = *tpl_stats_ptr;
-            dst_ptr[stride + 1]       = *tpl_stats_ptr;
-        }
+
+    // synthesizer grid; for small resolution, the 16x16 data is duplicated at an 8x8 grid
+    const uint8_t synth_blk_size = pcs->tpl_ctrls.synth_blk_size;
+    const int     synth_log2     = synth_blk_size == 32 ? 5 : synth_blk_size == 16 ? 4 : 3;
+    const int     stride         = synth_blk_size == 32 ? (pcs->aligned_width + 31) / 32
+                     : synth_blk_size == 16             ? (pcs->aligned_width + 15) / 16
+                                                        : ((pcs->aligned_width + 15) / 16) << 1;
+    const int     rows           = synth_blk_size == 32 ? (pcs->aligned_height + 31) / 32
+                   : synth_blk_size == 16               ? (pcs->aligned_height + 15) / 16
+                                                        : ((pcs->aligned_height + 15) / 16) << 1;
+    const int     grid_x         = mb_origin_x >> synth_log2;
+    const int     grid_y         = mb_origin_y >> synth_log2;
+    TplStats     *dst_ptr        = pcs->pa_me_data->tpl_stats[grid_y * stride + grid_x];
+
+    // a block larger than the synthesizer block is spread over the grid, normalized based on the grid block size
+    const int blk_cnt = size > synth_blk_size ? (int)size >> synth_log2 : 1;
+    if (blk_cnt > 1) {
+        const int area            = blk_cnt * blk_cnt;
+        tpl_stats_ptr->srcrf_dist = AOMMAX(1, tpl_stats_ptr->srcrf_dist / area);
+        tpl_stats_ptr->recrf_dist = AOMMAX(1, tpl_stats_ptr->recrf_dist / area);
+        tpl_stats_ptr->srcrf_rate = AOMMAX(1, tpl_stats_ptr->srcrf_rate / area);
+        tpl_stats_ptr->recrf_rate = AOMMAX(1, tpl_stats_ptr->recrf_rate / area);
     }
+    for (int i = 0; i < blk_cnt && grid_y + i < rows; i++)
+        for (int j = 0; j < blk_cnt && grid_x + j < stride; j++) dst_ptr[i * stride + j] = *tpl_stats_ptr;
 }
 
 double svt_av1_convert_qindex_to_q(int32_t qindex, EbBitDepth bit_depth);
@@ -400,24 +359,25 @@ static void     svt_tpl_init_mv_cost_params(MV_COST_PARAMS *mv_cost_params, cons
 }
 
 // Initialize xd fields required by TPL dispenser
-static void init_xd_tpl(MacroBlockD *xd, const Av1Common *const cm, const BlockSize block_size,
+static void init_xd_tpl(MacroBlockD *xd, const int mi_rows, const int mi_cols, const BlockSize block_size,
                         const uint32_t mb_origin_x, const uint32_t mb_origin_y) {
     const int32_t bw      = mi_size_wide[block_size];
     const int32_t bh      = mi_size_high[block_size];
     const int     mi_row  = mb_origin_y >> MI_SIZE_LOG2;
     const int     mi_col  = mb_origin_x >> MI_SIZE_LOG2;
     xd->mb_to_top_edge    = -((mi_row * MI_SIZE) * 8);
-    xd->mb_to_bottom_edge = ((cm->mi_rows - bh - mi_row) * MI_SIZE) * 8;
+    xd->mb_to_bottom_edge = ((mi_rows - bh - mi_row) * MI_SIZE) * 8;
     xd->mb_to_left_edge   = -((mi_col * MI_SIZE) * 8);
-    xd->mb_to_right_edge  = ((cm->mi_cols - bw - mi_col) * MI_SIZE) * 8;
+    xd->mb_to_right_edge  = ((mi_cols - bw - mi_col) * MI_SIZE) * 8;
     xd->mi_row            = -xd->mb_to_top_edge / (8 * MI_SIZE);
     xd->mi_col            = -xd->mb_to_left_edge / (8 * MI_SIZE);
 }
 
 // best_mv inputs the starting full-pel MV, around which subpel search is to be performed and outputs the new best subpel MV
 static void tpl_subpel_search(SequenceControlSet *scs, PictureParentControlSet *pcs, EbPictureBufferDesc *ref_pic,
-                              EbPictureBufferDesc *input_pic, MacroBlockD *xd, const uint32_t mb_origin_x,
-                              const uint32_t mb_origin_y, const uint8_t bsize, MV *best_mv) {
+                              EbPictureBufferDesc *input_pic, MacroBlockD *xd, const int mi_rows, const int mi_cols,
+                              const uint32_t mb_origin_x, const uint32_t mb_origin_y, const uint8_t bsize,
+                              MV *best_mv) {
     const Av1Common *const cm         = pcs->av1_cm;
     const BlockSize        block_size = bsize == 8 ? BLOCK_8X8
                : bsize == 16                       ? BLOCK_16X16
@@ -443,8 +403,8 @@ static void tpl_subpel_search(SequenceControlSet *scs, PictureParentControlSet *
     int      mi_height = mi_size_high[block_size];
     mv_limits.row_min  = -(((xd->mi_row + mi_height) * MI_SIZE) + AOM_INTERP_EXTEND);
     mv_limits.col_min  = -(((xd->mi_col + mi_width) * MI_SIZE) + AOM_INTERP_EXTEND);
-    mv_limits.row_max  = (cm->mi_rows - xd->mi_row) * MI_SIZE + AOM_INTERP_EXTEND;
-    mv_limits.col_max  = (cm->mi_cols - xd->mi_col) * MI_SIZE + AOM_INTERP_EXTEND;
+    mv_limits.row_max  = (mi_rows - xd->mi_row) * MI_SIZE + AOM_INTERP_EXTEND;
+    mv_limits.col_max  = (mi_cols - xd->mi_col) * MI_SIZE + AOM_INTERP_EXTEND;
     svt_av1_set_mv_search_range(&mv_limits, &ref_mv);
     svt_av1_set_subpel_mv_search_range(&ms_params->mv_limits, (FullMvLimits *)&mv_limits, &ref_mv);
 
@@ -516,24 +476,43 @@ static void tpl_subpel_search(SequenceControlSet *scs, PictureParentControlSet *
     best_mv->row = best_sp_mv.as_mv.row;
 }
 
+// Get the reference picture used by the TPL dispenser at the given resolution (see tpl_ds_level)
+static INLINE EbPictureBufferDesc *get_tpl_ref_pic(const EbDownScaledBufDescPtrArray *ref_ds, uint8_t ds_level) {
+    return ds_level == 0 ? ref_ds->picture_ptr
+        : ds_level == 1  ? ref_ds->quarter_picture_ptr
+                         : ref_ds->sixteenth_picture_ptr;
+}
+
 static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceControlSet *scs,
                                              PictureParentControlSet *pcs, int32_t frame_idx, uint32_t sb_index,
                                              int32_t qIndex, uint8_t dispenser_search_level) {
-    uint32_t size      = size_array[dispenser_search_level];
-    uint32_t blk_start = blk_start_array[dispenser_search_level];
-    uint32_t blk_end   = blk_end_array[dispenser_search_level];
+    // The block grid, the ME results and the stored stats are at full resolution (size), while the pixel work is
+    // done on pix_size blocks at the resolution given by tpl_ds_level
+    const uint8_t  ds_level  = scs->tpl_ds_level;
+    const uint8_t  pix_level = dispenser_search_level - ds_level;
+    const uint32_t size      = size_array[dispenser_search_level];
+    const uint32_t pix_size  = size >> ds_level;
+    const int      tpl_pad_x = TPL_PADX >> ds_level;
+    const int      tpl_pad_y = TPL_PADY >> ds_level;
+    uint32_t       blk_start = blk_start_array[dispenser_search_level];
+    uint32_t       blk_end   = blk_end_array[dispenser_search_level];
 
     int16_t      x_curr_mv    = 0;
     int16_t      y_curr_mv    = 0;
     uint32_t     me_mb_offset = 0;
     TplControls *tpl_ctrls    = &pcs->tpl_ctrls;
 
-    TxSize tx_size = (tpl_ctrls->subsample_tx == 2) ? sub4_tx_size_array[dispenser_search_level]
-        : (tpl_ctrls->subsample_tx == 1)            ? sub2_tx_size_array[dispenser_search_level]
-                                                    : tx_size_array[dispenser_search_level];
+    TxSize tx_size = (tpl_ctrls->subsample_tx == 2) ? sub4_tx_size_array[pix_level]
+        : (tpl_ctrls->subsample_tx == 1)            ? sub2_tx_size_array[pix_level]
+                                                    : tx_size_array[pix_level];
+    // the stats are scaled back to the full TX and to the full resolution area
+    const uint8_t stats_shift = tpl_ctrls->subsample_tx + 2 * ds_level;
 
     EbPictureBufferDesc *ref_pic_ptr;
-    EbPictureBufferDesc *input_pic = pcs->enhanced_pic;
+    EbPaReferenceObject *pa_ref_obj = (EbPaReferenceObject *)pcs->pa_ref_pic_wrapper->object_ptr;
+    EbPictureBufferDesc *input_pic  = ds_level == 0 ? pcs->enhanced_pic
+         : ds_level == 1                            ? pa_ref_obj->quarter_downsampled_picture_ptr
+                                                    : pa_ref_obj->sixteenth_downsampled_picture_ptr;
     EbPictureBufferDesc *recon_pic = enc_ctx->mc_flow_rec_picture_buffer[frame_idx];
     TplStats             tpl_stats;
 
@@ -556,7 +535,11 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
     mb_plane.round_qtx       = scs->enc_ctx->quants_8bit.y_round[qIndex];
     mb_plane.dequant_qtx     = scs->enc_ctx->deq_8bit.y_dequant_qtx[qIndex];
 
-    const uint32_t src_stride      = pcs->enhanced_pic->stride_y;
+    const uint32_t src_stride      = input_pic->stride_y;
+    const int      mi_rows         = ds_level ? ALIGN_POWER_OF_TWO(input_pic->height, 3) >> MI_SIZE_LOG2
+                                              : pcs->av1_cm->mi_rows;
+    const int      mi_cols         = ds_level ? ALIGN_POWER_OF_TWO(input_pic->width, 3) >> MI_SIZE_LOG2
+                                              : pcs->av1_cm->mi_cols;
     B64Geom       *b64_geom        = &scs->b64_geom[sb_index];
     const int      aligned16_width = (pcs->aligned_width + 15) >> 4;
 
@@ -567,13 +550,15 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
     for (uint32_t blk_index = blk_start; blk_index <= blk_end; blk_index++) {
         uint32_t               z_blk_index   = tpl_blk_idx_tab[0][blk_index];
         const CodedBlockStats *blk_stats_ptr = svt_aom_get_coded_blk_stats(z_blk_index);
-        const uint8_t          bsize         = blk_stats_ptr->size;
+        const uint8_t          bsize         = blk_stats_ptr->size >> ds_level;
         const BlockSize        block_size    = bsize == 8 ? BLOCK_8X8
                       : bsize == 16                       ? BLOCK_16X16
                       : bsize == 32                       ? BLOCK_32X32
                                                           : BLOCK_64X64;
         const uint32_t         mb_origin_x   = b64_geom->org_x + blk_stats_ptr->org_x;
         const uint32_t         mb_origin_y   = b64_geom->org_y + blk_stats_ptr->org_y;
+        const uint32_t         pix_origin_x  = mb_origin_x >> ds_level;
+        const uint32_t         pix_origin_y  = mb_origin_y >> ds_level;
 
         // at least half of the block inside
         if (mb_origin_x + (size >> 1) > pcs->enhanced_pic->width ||
@@ -581,14 +566,14 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
             continue;
 
         MacroBlockD xd;
-        init_xd_tpl(&xd, pcs->av1_cm, block_size, mb_origin_x, mb_origin_y);
+        init_xd_tpl(&xd, mi_rows, mi_cols, block_size, pix_origin_x, pix_origin_y);
 
         const int dst_buffer_stride = recon_pic->stride_y;
-        const int dst_mb_offset     = mb_origin_y * dst_buffer_stride + mb_origin_x;
+        const int dst_mb_offset     = pix_origin_y * dst_buffer_stride + pix_origin_x;
         const int dst_basic_offset  = recon_pic->org_y * recon_pic->stride_y + recon_pic->org_x;
         uint8_t  *dst_buffer        = recon_pic->buffer_y + dst_basic_offset + dst_mb_offset;
-        uint8_t  *src_mb            = input_pic->buffer_y + input_pic->org_x + mb_origin_x +
-            (input_pic->org_y + mb_origin_y) * src_stride;
+        uint8_t  *src_mb            = input_pic->buffer_y + input_pic->org_x + pix_origin_x +
+            (input_pic->org_y + pix_origin_y) * src_stride;
 
         int64_t  recon_error = 1, sse = 1;
         uint64_t best_ref_poc = 0;
@@ -617,7 +602,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                             ->ois_mb_results[(mb_origin_y / size) * picture_width_in_mb + (mb_origin_x / size)];
                     best_mode       = ois_mb_results_ptr->intra_mode;
                     best_intra_mode = ois_mb_results_ptr->intra_mode;
-                    best_intra_cost = ois_mb_results_ptr->intra_cost;
+                    // the OIS cost is computed at full resolution
+                    best_intra_cost = ois_mb_results_ptr->intra_cost >> (2 * ds_level);
                 } else {
                     // ois always process as block16x16 even bsize or tx_size is 8x8
                     // fast (DC only + sad ) path
@@ -627,9 +613,9 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                         uint8_t *above0_row = above0_data + MAX_TPL_SIZE;
                         uint8_t *left0_col  = left0_data + MAX_TPL_SIZE;
 
-                        const uint8_t mb_inside = (mb_origin_x + size <= pcs->enhanced_pic->width) &&
-                            (mb_origin_y + size <= pcs->enhanced_pic->height);
-                        if (mb_origin_x > 0 && mb_origin_y > 0 && mb_inside)
+                        const uint8_t mb_inside = (pix_origin_x + pix_size <= input_pic->width) &&
+                            (pix_origin_y + pix_size <= input_pic->height);
+                        if (pix_origin_x > 0 && pix_origin_y > 0 && mb_inside)
 
                             get_neighbor_samples_dc(src_mb, src_stride, above0_row, left0_col, bsize);
                         else
@@ -639,8 +625,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                                                                                left0_col - 1,
                                                                                input_pic,
                                                                                src_stride,
-                                                                               mb_origin_x,
-                                                                               mb_origin_y,
+                                                                               pix_origin_x,
+                                                                               pix_origin_y,
                                                                                bsize,
                                                                                bsize);
 
@@ -648,16 +634,16 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                         svt_aom_intra_prediction_open_loop_mb(
                             0,
                             DC_PRED,
-                            mb_origin_x,
-                            mb_origin_y,
-                            tx_size_array[dispenser_search_level], // use full block for prediction
+                            pix_origin_x,
+                            pix_origin_y,
+                            tx_size_array[pix_level], // use full block for prediction
                             above0_row,
                             left0_col,
                             predictor,
-                            size);
+                            pix_size);
 
                         best_intra_cost = svt_nxm_sad_kernel_sub_sampled(
-                            src_mb, src_stride, predictor, size, size, size);
+                            src_mb, src_stride, predictor, pix_size, pix_size, pix_size);
 
                     } else {
                         DECLARE_ALIGNED(MAX_TPL_SIZE, uint8_t, left0_data[MAX_TX_SIZE * 2 + MAX_TPL_SIZE * 2]);
@@ -681,8 +667,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                                                                            left0_col - 1,
                                                                            input_pic,
                                                                            input_pic->stride_y,
-                                                                           mb_origin_x,
-                                                                           mb_origin_y,
+                                                                           pix_origin_x,
+                                                                           pix_origin_y,
                                                                            bsize,
                                                                            bsize);
                         uint8_t intra_mode_end = pcs->tpl_ctrls.intra_mode_end;
@@ -702,11 +688,11 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                                 left_col  = left_data + MAX_TPL_SIZE;
                                 filter_intra_edge(NULL,
                                                   ois_intra_mode,
-                                                  scs->max_input_luma_width,
-                                                  scs->max_input_luma_height,
+                                                  scs->max_input_luma_width >> ds_level,
+                                                  scs->max_input_luma_height >> ds_level,
                                                   p_angle,
-                                                  (int32_t)mb_origin_x,
-                                                  (int32_t)mb_origin_y,
+                                                  (int32_t)pix_origin_x,
+                                                  (int32_t)pix_origin_y,
                                                   above_row,
                                                   left_col);
                             } else {
@@ -717,34 +703,34 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                             svt_aom_intra_prediction_open_loop_mb(
                                 p_angle,
                                 ois_intra_mode,
-                                mb_origin_x,
-                                mb_origin_y,
-                                tx_size_array[dispenser_search_level], // use full block for prediction
+                                pix_origin_x,
+                                pix_origin_y,
+                                tx_size_array[pix_level], // use full block for prediction
                                 above_row,
                                 left_col,
                                 predictor,
-                                size);
+                                pix_size);
 
                             // Distortion
                             int64_t intra_cost;
                             if (pcs->tpl_ctrls.use_sad_in_src_search) {
                                 intra_cost = svt_nxm_sad_kernel_sub_sampled(
-                                    src_mb, input_pic->stride_y, predictor, size, size, size);
+                                    src_mb, input_pic->stride_y, predictor, pix_size, pix_size, pix_size);
                             } else {
-                                svt_aom_subtract_block(size >> tpl_ctrls->subsample_tx,
-                                                       size,
+                                svt_aom_subtract_block(pix_size >> tpl_ctrls->subsample_tx,
+                                                       pix_size,
                                                        src_diff,
-                                                       size << tpl_ctrls->subsample_tx,
+                                                       pix_size << tpl_ctrls->subsample_tx,
                                                        src_mb,
                                                        input_pic->stride_y << tpl_ctrls->subsample_tx,
                                                        predictor,
-                                                       size << tpl_ctrls->subsample_tx);
+                                                       pix_size << tpl_ctrls->subsample_tx);
 
                                 EB_TRANS_COEFF_SHAPE pf_shape = pcs->tpl_ctrls.pf_shape;
                                 svt_av1_wht_fwd_txfm(
-                                    src_diff, size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
+                                    src_diff, pix_size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
 
-                                intra_cost = svt_aom_satd(coeff, (size * size) >> tpl_ctrls->subsample_tx)
+                                intra_cost = svt_aom_satd(coeff, (pix_size * pix_size) >> tpl_ctrls->subsample_tx)
                                     << tpl_ctrls->subsample_tx;
                             }
 
@@ -784,31 +770,31 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                 const uint32_t rf_idx    = svt_get_ref_frame_type(list_index, ref_pic_index) - 1;
                 const uint32_t me_offset = me_mb_offset * pcs->pa_me_data->max_refs +
                     (list_index ? pcs->pa_me_data->max_l0 : 0) + ref_pic_index;
-                x_curr_mv = (me_results->me_mv_array[me_offset].x_mv) << 3;
-                y_curr_mv = (me_results->me_mv_array[me_offset].y_mv) << 3;
+                x_curr_mv = ROUND_POWER_OF_TWO_SIGNED(me_results->me_mv_array[me_offset].x_mv, ds_level) << 3;
+                y_curr_mv = ROUND_POWER_OF_TWO_SIGNED(me_results->me_mv_array[me_offset].y_mv, ds_level) << 3;
 
-                ref_pic_ptr =
-                    (EbPictureBufferDesc *)pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index].picture_ptr;
+                ref_pic_ptr = get_tpl_ref_pic(&pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index], ds_level);
 
-                if (((int)mb_origin_x + (x_curr_mv >> 3)) < -TPL_PADX)
-                    x_curr_mv = (-TPL_PADX - mb_origin_x) << 3;
+                if (((int)pix_origin_x + (x_curr_mv >> 3)) < -tpl_pad_x)
+                    x_curr_mv = (-tpl_pad_x - pix_origin_x) << 3;
 
-                if (((int)mb_origin_x + (int)bsize + (x_curr_mv >> 3)) > (TPL_PADX + (int)ref_pic_ptr->max_width - 1))
-                    x_curr_mv = ((TPL_PADX + ref_pic_ptr->max_width - 1) - (mb_origin_x + bsize)) << 3;
+                if (((int)pix_origin_x + (int)bsize + (x_curr_mv >> 3)) > (tpl_pad_x + (int)ref_pic_ptr->max_width - 1))
+                    x_curr_mv = ((tpl_pad_x + ref_pic_ptr->max_width - 1) - (pix_origin_x + bsize)) << 3;
 
-                if (((int)mb_origin_y + (y_curr_mv >> 3)) < -TPL_PADY)
-                    y_curr_mv = (-TPL_PADY - mb_origin_y) << 3;
+                if (((int)pix_origin_y + (y_curr_mv >> 3)) < -tpl_pad_y)
+                    y_curr_mv = (-tpl_pad_y - pix_origin_y) << 3;
 
-                if (((int)mb_origin_y + (int)bsize + (y_curr_mv >> 3)) > (TPL_PADY + (int)ref_pic_ptr->max_height - 1))
-                    y_curr_mv = ((TPL_PADY + ref_pic_ptr->max_height - 1) - (mb_origin_y + bsize)) << 3;
+                if (((int)pix_origin_y + (int)bsize + (y_curr_mv >> 3)) > (tpl_pad_y + (int)ref_pic_ptr->max_height - 1))
+                    y_curr_mv = ((tpl_pad_y + ref_pic_ptr->max_height - 1) - (pix_origin_y + bsize)) << 3;
 
                 MV best_mv = {y_curr_mv, x_curr_mv};
 
                 if (pcs->tpl_ctrls.subpel_depth != FULL_PEL) {
-                    tpl_subpel_search(scs, pcs, ref_pic_ptr, input_pic, &xd, mb_origin_x, mb_origin_y, bsize, &best_mv);
+                    tpl_subpel_search(
+                        scs, pcs, ref_pic_ptr, input_pic, &xd, mi_rows, mi_cols, pix_origin_x, pix_origin_y, bsize, &best_mv);
                 }
-                int32_t ref_origin_index = (int32_t)ref_pic_ptr->org_x + ((int32_t)mb_origin_x + (best_mv.col / 8)) +
-                    ((int32_t)mb_origin_y + (best_mv.row / 8) + (int32_t)ref_pic_ptr->org_y) *
+                int32_t ref_origin_index = (int32_t)ref_pic_ptr->org_x + ((int32_t)pix_origin_x + (best_mv.col / 8)) +
+                    ((int32_t)pix_origin_y + (best_mv.row / 8) + (int32_t)ref_pic_ptr->org_y) *
                         (int32_t)ref_pic_ptr->stride_y;
 
                 // Need to do compensation for subpel, otherwise, can get pixels directly from REF picture
@@ -824,8 +810,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                         ref_pic_ptr->buffer_y + ref_pic_ptr->org_x + (ref_pic_ptr->org_y * ref_pic_ptr->stride_y),
                         NULL, // src_ptr_2b,
                         compensated_blk,
-                        (int16_t)mb_origin_y,
-                        (int16_t)mb_origin_x,
+                        (int16_t)pix_origin_y,
+                        (int16_t)pix_origin_x,
                         best_mv,
                         &scs->sf_identity,
                         &conv_params_y,
@@ -839,7 +825,7 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                         block_size,
                         &xd,
                         ref_pic_ptr->stride_y,
-                        size,
+                        pix_size,
                         0,
                         0, // ss_y,
                         0, // ss_x,
@@ -854,22 +840,22 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                         src_mb,
                         input_pic->stride_y,
                         subpel_mv ? compensated_blk : ref_pic_ptr->buffer_y + ref_origin_index,
-                        subpel_mv ? size : ref_pic_ptr->stride_y,
-                        size,
-                        size);
+                        subpel_mv ? pix_size : ref_pic_ptr->stride_y,
+                        pix_size,
+                        pix_size);
                 } else {
-                    svt_aom_subtract_block(size >> tpl_ctrls->subsample_tx,
-                                           size,
+                    svt_aom_subtract_block(pix_size >> tpl_ctrls->subsample_tx,
+                                           pix_size,
                                            src_diff,
-                                           size << tpl_ctrls->subsample_tx,
+                                           pix_size << tpl_ctrls->subsample_tx,
                                            src_mb,
                                            input_pic->stride_y << tpl_ctrls->subsample_tx,
                                            subpel_mv ? compensated_blk : ref_pic_ptr->buffer_y + ref_origin_index,
-                                           (subpel_mv ? size : ref_pic_ptr->stride_y) << tpl_ctrls->subsample_tx);
+                                           (subpel_mv ? pix_size : ref_pic_ptr->stride_y) << tpl_ctrls->subsample_tx);
                     EB_TRANS_COEFF_SHAPE pf_shape = pcs->tpl_ctrls.pf_shape;
-                    svt_av1_wht_fwd_txfm(src_diff, size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
+                    svt_av1_wht_fwd_txfm(src_diff, pix_size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
 
-                    inter_cost = svt_aom_satd(coeff, (size * size) >> tpl_ctrls->subsample_tx)
+                    inter_cost = svt_aom_satd(coeff, (pix_size * pix_size) >> tpl_ctrls->subsample_tx)
                         << tpl_ctrls->subsample_tx;
                 }
 
@@ -893,10 +879,11 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                 if (pcs->tpl_ctrls.use_sad_in_src_search) {
                     uint32_t list_index    = best_rf_idx < 4 ? 0 : 1;
                     uint32_t ref_pic_index = best_rf_idx >= 4 ? (best_rf_idx - 4) : best_rf_idx;
-                    ref_pic_ptr            = pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index].picture_ptr;
+                    ref_pic_ptr = get_tpl_ref_pic(&pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index],
+                                                  ds_level);
                     int32_t ref_origin_index = (int32_t)ref_pic_ptr->org_x +
-                        ((int32_t)mb_origin_x + (final_best_mv.col >> 3)) +
-                        ((int32_t)mb_origin_y + (final_best_mv.row >> 3) + (int32_t)ref_pic_ptr->org_y) *
+                        ((int32_t)pix_origin_x + (final_best_mv.col >> 3)) +
+                        ((int32_t)pix_origin_y + (final_best_mv.row >> 3) + (int32_t)ref_pic_ptr->org_y) *
                             (int32_t)ref_pic_ptr->stride_y;
                     // Need to do compensation for subpel, otherwise, can get pixels directly from REF picture
                     uint8_t subpel_mv = (final_best_mv.col & 0x7 || final_best_mv.row & 0x7);
@@ -911,8 +898,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                             ref_pic_ptr->buffer_y + ref_pic_ptr->org_x + (ref_pic_ptr->org_y * ref_pic_ptr->stride_y),
                             NULL, // src_ptr_2b,
                             compensated_blk,
-                            (int16_t)mb_origin_y,
-                            (int16_t)mb_origin_x,
+                            (int16_t)pix_origin_y,
+                            (int16_t)pix_origin_x,
                             final_best_mv, //best_mv,
                             &scs->sf_identity,
                             &conv_params_y,
@@ -926,7 +913,7 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                             block_size,
                             &xd,
                             ref_pic_ptr->stride_y,
-                            size,
+                            pix_size,
                             0,
                             0, // ss_y,
                             0, // ss_x,
@@ -936,31 +923,32 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                             0); // is16bit
                     }
 
-                    svt_aom_subtract_block(size >> tpl_ctrls->subsample_tx,
-                                           size,
+                    svt_aom_subtract_block(pix_size >> tpl_ctrls->subsample_tx,
+                                           pix_size,
                                            src_diff,
-                                           size << tpl_ctrls->subsample_tx,
+                                           pix_size << tpl_ctrls->subsample_tx,
                                            src_mb,
                                            input_pic->stride_y << tpl_ctrls->subsample_tx,
                                            subpel_mv ? compensated_blk : ref_pic_ptr->buffer_y + ref_origin_index,
-                                           (subpel_mv ? size : ref_pic_ptr->stride_y) << tpl_ctrls->subsample_tx);
+                                           (subpel_mv ? pix_size : ref_pic_ptr->stride_y) << tpl_ctrls->subsample_tx);
                     EB_TRANS_COEFF_SHAPE pf_shape = pcs->tpl_ctrls.pf_shape;
 
                     svt_av1_wht_fwd_txfm(
-                        src_diff, size << tpl_ctrls->subsample_tx, best_coeff, tx_size, pf_shape, 8, 0);
+                        src_diff, pix_size << tpl_ctrls->subsample_tx, best_coeff, tx_size, pf_shape, 8, 0);
                 }
 
                 get_quantize_error(&mb_plane, best_coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
 
                 int rate_cost        = pcs->tpl_ctrls.compute_rate ? rate_estimator(qcoeff, eob, tx_size) : 0;
-                tpl_stats.srcrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx; // Experimental tune 3 change, likely to be modified in the future.
-                tpl_stats.srcrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx;
+                tpl_stats.srcrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift; // Experimental tune 3 change, likely to be modified in the future.
+                tpl_stats.srcrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift;
             }
             if (scs->tpl_lad_mg > 0) {
                 //store src based stats
                 tpl_src_stats_buffer->srcrf_dist      = tpl_stats.srcrf_dist;
                 tpl_src_stats_buffer->srcrf_rate      = tpl_stats.srcrf_rate;
-                tpl_src_stats_buffer->mv              = final_best_mv;
+                tpl_src_stats_buffer->mv.row          = final_best_mv.row * (1 << ds_level);
+                tpl_src_stats_buffer->mv.col          = final_best_mv.col * (1 << ds_level);
                 tpl_src_stats_buffer->best_rf_idx     = best_rf_idx;
                 tpl_src_stats_buffer->ref_frame_poc   = best_ref_poc;
                 tpl_src_stats_buffer->best_mode       = best_mode;
@@ -970,7 +958,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
             // get src based stats from previously computed data
             tpl_stats.srcrf_dist = tpl_src_stats_buffer->srcrf_dist;
             tpl_stats.srcrf_rate = tpl_src_stats_buffer->srcrf_rate;
-            final_best_mv        = tpl_src_stats_buffer->mv;
+            final_best_mv.row    = tpl_src_stats_buffer->mv.row / (1 << ds_level);
+            final_best_mv.col    = tpl_src_stats_buffer->mv.col / (1 << ds_level);
             best_rf_idx          = tpl_src_stats_buffer->best_rf_idx;
             best_ref_poc         = tpl_src_stats_buffer->ref_frame_poc;
             best_mode            = tpl_src_stats_buffer->best_mode;
@@ -990,11 +979,10 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                 assert(ref_frame_idx != MAX_TPL_LA_SW);
                 ref_pic_ptr = enc_ctx->mc_flow_rec_picture_buffer[ref_frame_idx];
             } else
-                ref_pic_ptr =
-                    (EbPictureBufferDesc *)pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index].picture_ptr;
+                ref_pic_ptr = get_tpl_ref_pic(&pcs->tpl_data.tpl_ref_ds_ptr_array[list_index][ref_pic_index], ds_level);
 
-            int32_t ref_origin_index = (int32_t)ref_pic_ptr->org_x + ((int32_t)mb_origin_x + (final_best_mv.col >> 3)) +
-                ((int32_t)mb_origin_y + (final_best_mv.row >> 3) + (int32_t)ref_pic_ptr->org_y) *
+            int32_t ref_origin_index = (int32_t)ref_pic_ptr->org_x + ((int32_t)pix_origin_x + (final_best_mv.col >> 3)) +
+                ((int32_t)pix_origin_y + (final_best_mv.row >> 3) + (int32_t)ref_pic_ptr->org_y) *
                     (int32_t)ref_pic_ptr->stride_y;
             // REDO COMPENSATION WITH REF PIC (INSTEAD OF REF BEING THE SRC PIC)
             // Need to do compensation for subpel, otherwise, can get pixels directly from RECON picture
@@ -1010,8 +998,8 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                     ref_pic_ptr->buffer_y + ref_pic_ptr->org_x + (ref_pic_ptr->org_y * ref_pic_ptr->stride_y),
                     NULL, // src_ptr_2b,
                     dst_buffer,
-                    (int16_t)mb_origin_y,
-                    (int16_t)mb_origin_x,
+                    (int16_t)pix_origin_y,
+                    (int16_t)pix_origin_x,
                     final_best_mv,
                     &scs->sf_identity,
                     &conv_params_y,
@@ -1034,10 +1022,10 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                     0,
                     0); // is16bit
             } else {
-                for (int i = 0; i < (int)size; ++i)
+                for (int i = 0; i < (int)pix_size; ++i)
                     EB_MEMCPY(dst_buffer + i * dst_buffer_stride,
                               ref_pic_ptr->buffer_y + ref_origin_index + i * ref_pic_ptr->stride_y,
-                              sizeof(uint8_t) * (size));
+                              sizeof(uint8_t) * (pix_size));
             }
         } else {
             // intra recon
@@ -1053,10 +1041,10 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
             uint8_t *recon_buffer = recon_pic->buffer_y + dst_basic_offset;
 
             if (intra_dc_sad_path) {
-                const uint8_t mb_inside = (mb_origin_x + size <= pcs->enhanced_pic->width) &&
-                    (mb_origin_y + size <= pcs->enhanced_pic->height);
-                if (mb_origin_x > 0 && mb_origin_y > 0 && mb_inside)
-                    get_neighbor_samples_dc(recon_buffer + mb_origin_x + mb_origin_y * dst_buffer_stride,
+                const uint8_t mb_inside = (pix_origin_x + pix_size <= input_pic->width) &&
+                    (pix_origin_y + pix_size <= input_pic->height);
+                if (pix_origin_x > 0 && pix_origin_y > 0 && mb_inside)
+                    get_neighbor_samples_dc(recon_buffer + pix_origin_x + pix_origin_y * dst_buffer_stride,
                                             dst_buffer_stride,
                                             above_row,
                                             left_col,
@@ -1068,19 +1056,19 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                                                                              left_col - 1,
                                                                              recon_buffer,
                                                                              dst_buffer_stride,
-                                                                             mb_origin_x,
-                                                                             mb_origin_y,
-                                                                             size,
-                                                                             size,
+                                                                             pix_origin_x,
+                                                                             pix_origin_y,
+                                                                             pix_size,
+                                                                             pix_size,
                                                                              input_pic->width,
                                                                              input_pic->height);
 
                 svt_aom_intra_prediction_open_loop_mb(
                     0,
                     DC_PRED,
-                    mb_origin_x,
-                    mb_origin_y,
-                    tx_size_array[dispenser_search_level], // use full block for prediction
+                    pix_origin_x,
+                    pix_origin_y,
+                    tx_size_array[pix_level], // use full block for prediction
                     above_row,
                     left_col,
                     dst_buffer,
@@ -1093,10 +1081,10 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                                                                          left_col - 1,
                                                                          recon_buffer,
                                                                          dst_buffer_stride,
-                                                                         mb_origin_x,
-                                                                         mb_origin_y,
-                                                                         size,
-                                                                         size,
+                                                                         pix_origin_x,
+                                                                         pix_origin_y,
+                                                                         pix_size,
+                                                                         pix_size,
                                                                          input_pic->width,
                                                                          input_pic->height);
                 uint8_t ois_intra_mode = best_intra_mode;
@@ -1107,11 +1095,11 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                 if (av1_is_directional_mode((PredictionMode)ois_intra_mode)) {
                     filter_intra_edge(NULL,
                                       ois_intra_mode,
-                                      scs->max_input_luma_width,
-                                      scs->max_input_luma_height,
+                                      scs->max_input_luma_width >> ds_level,
+                                      scs->max_input_luma_height >> ds_level,
                                       p_angle,
-                                      mb_origin_x,
-                                      mb_origin_y,
+                                      pix_origin_x,
+                                      pix_origin_y,
                                       above_row,
                                       left_col);
                 }
@@ -1119,9 +1107,9 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
                 svt_aom_intra_prediction_open_loop_mb(
                     p_angle,
                     ois_intra_mode,
-                    mb_origin_x,
-                    mb_origin_y,
-                    tx_size_array[dispenser_search_level], // use full block for prediction
+                    pix_origin_x,
+                    pix_origin_y,
+                    tx_size_array[pix_level], // use full block for prediction
                     above_row,
                     left_col,
                     dst_buffer,
@@ -1129,16 +1117,16 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
             }
         }
 
-        svt_aom_subtract_block(size >> tpl_ctrls->subsample_tx,
-                               size,
+        svt_aom_subtract_block(pix_size >> tpl_ctrls->subsample_tx,
+                               pix_size,
                                src_diff,
-                               size << tpl_ctrls->subsample_tx,
+                               pix_size << tpl_ctrls->subsample_tx,
                                src_mb,
                                input_pic->stride_y << tpl_ctrls->subsample_tx,
                                dst_buffer,
                                dst_buffer_stride << tpl_ctrls->subsample_tx);
         EB_TRANS_COEFF_SHAPE pf_shape = pcs->tpl_ctrls.pf_shape;
-        svt_av1_wht_fwd_txfm(src_diff, size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
+        svt_av1_wht_fwd_txfm(src_diff, pix_size << tpl_ctrls->subsample_tx, coeff, tx_size, pf_shape, 8, 0);
 
         uint16_t eob = 0;
 
@@ -1160,38 +1148,39 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext *enc_ctx, SequenceCon
 
                 // If subsampling is used for the TX, need to populate the missing rows in recon with a copy of the neighbouring rows
                 if (tpl_ctrls->subsample_tx == 2) {
-                    for (int i = 0; i < (int)size; i += 4) {
+                    for (int i = 0; i < (int)pix_size; i += 4) {
                         EB_MEMCPY(dst_buffer + (i + 1) * dst_buffer_stride,
                                   dst_buffer + i * dst_buffer_stride,
-                                  sizeof(uint8_t) * (size));
+                                  sizeof(uint8_t) * (pix_size));
                         EB_MEMCPY(dst_buffer + (i + 2) * dst_buffer_stride,
                                   dst_buffer + i * dst_buffer_stride,
-                                  sizeof(uint8_t) * (size));
+                                  sizeof(uint8_t) * (pix_size));
                         EB_MEMCPY(dst_buffer + (i + 3) * dst_buffer_stride,
                                   dst_buffer + i * dst_buffer_stride,
-                                  sizeof(uint8_t) * (size));
+                                  sizeof(uint8_t) * (pix_size));
                     }
                 } else if (tpl_ctrls->subsample_tx == 1) {
-                    for (int i = 0; i < (int)size; i += 2) {
+                    for (int i = 0; i < (int)pix_size; i += 2) {
                         EB_MEMCPY(dst_buffer + (i + 1) * dst_buffer_stride,
                                   dst_buffer + i * dst_buffer_stride,
-                                  sizeof(uint8_t) * (size));
+                                  sizeof(uint8_t) * (pix_size));
                     }
                 }
             }
         }
 
-        tpl_stats.recrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx;
-        tpl_stats.recrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx;
+        tpl_stats.recrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift;
+        tpl_stats.recrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift;
         if (best_mode != NEWMV) {
-            tpl_stats.srcrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx;
-            tpl_stats.srcrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << tpl_ctrls->subsample_tx;
+            tpl_stats.srcrf_dist = (recon_error << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift;
+            tpl_stats.srcrf_rate = (rate_cost << (pcs->scs->static_config.tune == 3 ? 1 : TPL_DEP_COST_SCALE_LOG2)) << stats_shift;
         }
 
         tpl_stats.recrf_dist = AOMMAX(tpl_stats.srcrf_dist, tpl_stats.recrf_dist);
         tpl_stats.recrf_rate = AOMMAX(tpl_stats.srcrf_rate, tpl_stats.recrf_rate);
         if (pcs->tpl_data.tpl_slice_type != I_SLICE && best_rf_idx != -1) {
-            tpl_stats.mv            = final_best_mv;
+            tpl_stats.mv.row        = final_best_mv.row * (1 << ds_level);
+            tpl_stats.mv.col        = final_best_mv.col * (1 << ds_level);
             tpl_stats.ref_frame_poc = best_ref_poc;
         }
 
@@ -1343,13 +1332,12 @@ static Bool assign_tpl_segments(EncDecSegments *segmentPtr, uint16_t *segmentInO
 /************************************************
  * Genrate TPL MC Flow Dispenser  Based on Lookahead
  ** LAD Window: sliding window size
+ ** Posts the picture to the TPL dispenser kernels; completion is
+ ** awaited in tpl_mc_flow_dispenser_wait()
  ************************************************/
 
-static void tpl_mc_flow_dispenser(EncodeContext *enc_ctx, SequenceControlSet *scs, int32_t *base_rdmult,
-                                  PictureParentControlSet *pcs, int32_t frame_idx,
-                                  SourceBasedOperationsContext *context_ptr) {
-    EbPictureBufferDesc *recon_pic = enc_ctx->mc_flow_rec_picture_buffer[frame_idx];
-
+static void tpl_mc_flow_dispenser(SequenceControlSet *scs, int32_t *base_rdmult, PictureParentControlSet *pcs,
+                                  int32_t frame_idx, SourceBasedOperationsContext *context_ptr) {
     int32_t qIndex = quantizer_to_qindex[(uint8_t)scs->static_config.qp];
     if (pcs->tpl_ctrls.enable_tpl_qps) {
         const double delta_rate_new[7][6] = {
@@ -1393,10 +1381,18 @@ static void tpl_mc_flow_dispenser(EncodeContext *enc_ctx, SequenceControlSet *sc
             out_results->qIndex      = qIndex;
 
             svt_post_full_object(out_results_wrapper);
-
-            svt_block_on_semaphore(pcs->tpl_disp_done_semaphore); // we can do all in // ?
         }
     }
+}
+
+/************************************************
+ * Wait for the TPL dispenser of one picture to be done
+ * and pad its recon for the pictures referencing it
+ ************************************************/
+static void tpl_mc_flow_dispenser_wait(EncodeContext *enc_ctx, PictureParentControlSet *pcs, int32_t frame_idx) {
+    EbPictureBufferDesc *recon_pic = enc_ctx->mc_flow_rec_picture_buffer[frame_idx];
+
+    svt_block_on_semaphore(pcs->tpl_disp_done_semaphore);
 
     // padding current recon picture
     svt_aom_generate_padding(recon_pic->buffer_y,
@@ -1771,6 +1767,67 @@ static void init_tpl_segments(SequenceControlSet *scs, PictureParentControlSet *
         }
     }
 }
+/*
+  Return true when all in-window references of the TPL group picture at frame_idx are retired, i.e. their
+  TPL recon is complete and padded
+*/
+static bool tpl_refs_retired(PictureParentControlSet *pcs, int32_t frame_idx, int32_t retired_cnt) {
+    for (uint8_t list_index = REF_LIST_0; list_index < TOTAL_NUM_OF_REF_LISTS; list_index++) {
+        const uint8_t ref_cnt = list_index == REF_LIST_0 ? pcs->tpl_data.tpl_ref0_count
+                                                         : pcs->tpl_data.tpl_ref1_count;
+        for (uint8_t ref_idx = 0; ref_idx < ref_cnt; ref_idx++) {
+            if (!pcs->tpl_data.ref_in_slide_window[list_index][ref_idx])
+                continue;
+            const int32_t ref_grp_idx = pcs->tpl_data.ref_tpl_group_idx[list_index][ref_idx];
+            if (ref_grp_idx < frame_idx && ref_grp_idx >= retired_cnt)
+                return false;
+        }
+    }
+    return true;
+}
+
+/*
+  Select the pictures of the TPL group to be dispensed. When the stats of the previous (overlapping) TPL group are
+  reused, a picture already dispensed there keeps its stats, unless one of its references is no longer part of the
+  TPL group (the recon based costs would change the most), or a picture to be dispensed uses it as a recon reference.
+*/
+static void set_tpl_dispense_list(SequenceControlSet *scs, PictureParentControlSet *pcs, int32_t frames_in_sw,
+                                  uint8_t *dispense) {
+    const uint8_t reuse = scs->tpl_lad_mg > 0 && pcs->tpl_ctrls.reuse_prev_group_stats;
+    for (int32_t frame_idx = 0; frame_idx < frames_in_sw; frame_idx++)
+        dispense[frame_idx] = pcs->tpl_valid_pic[frame_idx] &&
+            !(reuse && frame_idx > 0 && pcs->tpl_group[frame_idx]->tpl_src_data_ready);
+    if (!reuse)
+        return;
+    for (int32_t frame_idx = 1; frame_idx < frames_in_sw; frame_idx++) {
+        if (dispense[frame_idx] || !pcs->tpl_valid_pic[frame_idx])
+            continue;
+        const TPLData *tpl_data = &pcs->tpl_group[frame_idx]->tpl_data;
+        for (uint8_t list_index = REF_LIST_0; list_index < TOTAL_NUM_OF_REF_LISTS; list_index++) {
+            const uint8_t ref_cnt = list_index == REF_LIST_0 ? tpl_data->tpl_ref0_count : tpl_data->tpl_ref1_count;
+            for (uint8_t ref_idx = 0; ref_idx < ref_cnt; ref_idx++)
+                if (!tpl_data->ref_in_slide_window[list_index][ref_idx])
+                    dispense[frame_idx] = 1;
+        }
+    }
+    // references precede the pictures using them in decode order, so one backward pass covers the reference chains
+    for (int32_t frame_idx = frames_in_sw - 1; frame_idx > 0; frame_idx--) {
+        if (!dispense[frame_idx])
+            continue;
+        const TPLData *tpl_data = &pcs->tpl_group[frame_idx]->tpl_data;
+        for (uint8_t list_index = REF_LIST_0; list_index < TOTAL_NUM_OF_REF_LISTS; list_index++) {
+            const uint8_t ref_cnt = list_index == REF_LIST_0 ? tpl_data->tpl_ref0_count : tpl_data->tpl_ref1_count;
+            for (uint8_t ref_idx = 0; ref_idx < ref_cnt; ref_idx++) {
+                if (!tpl_data->ref_in_slide_window[list_index][ref_idx])
+                    continue;
+                const int32_t ref_grp_idx = tpl_data->ref_tpl_group_idx[list_index][ref_idx];
+                if (ref_grp_idx < frame_idx && pcs->tpl_valid_pic[ref_grp_idx])
+                    dispense[ref_grp_idx] = 1;
+            }
+        }
+    }
+}
+
 typedef struct TplRefList {
     EbObjectWrapper *ref;
     int32_t          frame_idx;
@@ -1799,8 +1856,9 @@ static EbErrorType tpl_mc_flow(EncodeContext *enc_ctx, SequenceControlSet *scs,
     pcs->tpl_is_valid = 0;
     init_tpl_buffers(enc_ctx);
 
-    TplRefList tpl_ref_list[REF_FRAMES + 1]; // Buffer for each ref pic and current pic
-    memset(tpl_ref_list, 0, sizeof(tpl_ref_list[0]) * (REF_FRAMES + 1));
+    // Buffer for each ref pic and the pictures in flight
+    TplRefList tpl_ref_list[REF_FRAMES + MAX_TPL_FRAMES_IN_FLIGHT];
+    memset(tpl_ref_list, 0, sizeof(tpl_ref_list[0]) * (REF_FRAMES + MAX_TPL_FRAMES_IN_FLIGHT));
 
     if (pcs->tpl_group[0]->tpl_data.tpl_temporal_layer_index == 0) {
         // no Tiles path
@@ -1808,60 +1866,85 @@ static EbErrorType tpl_mc_flow(EncodeContext *enc_ctx, SequenceControlSet *scs,
             init_tpl_segments(scs, pcs, pcs->tpl_group, frames_in_sw);
 
         uint8_t tpl_on;
-        enc_ctx->poc_map_idx[0] = pcs->tpl_group[0]->picture_number;
+        for (int32_t frame_idx = 0; frame_idx < frames_in_sw; frame_idx++)
+            enc_ctx->poc_map_idx[frame_idx] = pcs->tpl_group[frame_idx]->picture_number;
+        uint8_t dispense[MAX_TPL_LA_SW];
+        set_tpl_dispense_list(scs, pcs, frames_in_sw, dispense);
+        // Pictures are dispensed in decode order as soon as all their in-window references are retired, so
+        // pictures that do not depend on each other (e.g. the non-reference pictures of a mini-GOP) run
+        // concurrently. Pictures are retired (padded, references released) in decode order, which keeps the
+        // reference bookkeeping identical to the serial flow.
+        const int32_t max_in_flight = MAX(1, scs->tpl_frames_in_flight);
+        int32_t       next_issue    = 0;
         //TPL main frame loop
         for (int32_t frame_idx = 0; frame_idx < frames_in_sw; frame_idx++) {
-            enc_ctx->poc_map_idx[frame_idx] = pcs->tpl_group[frame_idx]->picture_number;
-            // NREF need recon buffer for intra pred
-            EbObjectWrapper *ref_pic_wrapper;
-            // Get Empty Reference Picture Object
-            svt_get_empty_object(scs->enc_ctx->tpl_reference_picture_pool_fifo_ptr, &ref_pic_wrapper);
-            // if resolution has changed, and the tpl_reference_picture settings do not match scs settings, update tpl reference params
-            if (((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr->max_width !=
-                    scs->max_input_luma_width ||
-                ((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr->max_height !=
-                    scs->max_input_luma_height)
-                svt_tpl_reference_param_update((EbTplReferenceObject *)ref_pic_wrapper->object_ptr, scs);
-            // Give the new Reference a nominal live_count of 1
-            svt_object_inc_live_count(ref_pic_wrapper, 1);
-
-            for (int i = 0; i < (REF_FRAMES + 1); i++) {
-                // Get empty list entry
-                if (!tpl_ref_list[i].is_valid) {
-                    tpl_ref_list[i].ref                = ref_pic_wrapper;
-                    tpl_ref_list[i].refresh_frame_mask = pcs->tpl_group[frame_idx]->is_ref
-                        ? pcs->tpl_group[frame_idx]->av1_ref_signal.refresh_frame_mask
-                        : 0;
-                    tpl_ref_list[i].frame_idx          = frame_idx;
-                    tpl_ref_list[i].is_valid           = true;
-                    enc_ctx->mc_flow_rec_picture_buffer[frame_idx] =
-                        ((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr;
-                    break;
+            while (next_issue < frames_in_sw && next_issue - frame_idx < max_in_flight &&
+                   tpl_refs_retired(pcs->tpl_group[next_issue], next_issue, frame_idx)) {
+                // NREF need recon buffer for intra pred
+                EbObjectWrapper *ref_pic_wrapper;
+                // Get Empty Reference Picture Object
+                svt_get_empty_object(scs->enc_ctx->tpl_reference_picture_pool_fifo_ptr, &ref_pic_wrapper);
+                // if resolution has changed, and the tpl_reference_picture settings do not match scs settings, update tpl reference params
+                if (((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr->max_width !=
+                        scs->max_input_luma_width ||
+                    ((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr->max_height !=
+                        scs->max_input_luma_height)
+                    svt_tpl_reference_param_update((EbTplReferenceObject *)ref_pic_wrapper->object_ptr, scs);
+                // Give the new Reference a nominal live_count of 1
+                svt_object_inc_live_count(ref_pic_wrapper, 1);
+
+                for (int i = 0; i < (REF_FRAMES + MAX_TPL_FRAMES_IN_FLIGHT); i++) {
+                    // Get empty list entry
+                    if (!tpl_ref_list[i].is_valid) {
+                        tpl_ref_list[i].ref                = ref_pic_wrapper;
+                        tpl_ref_list[i].refresh_frame_mask = pcs->tpl_group[next_issue]->is_ref
+                            ? pcs->tpl_group[next_issue]->av1_ref_signal.refresh_frame_mask
+                            : 0;
+                        tpl_ref_list[i].frame_idx          = next_issue;
+                        tpl_ref_list[i].is_valid           = true;
+                        enc_ctx->mc_flow_rec_picture_buffer[next_issue] =
+                            ((EbTplReferenceObject *)ref_pic_wrapper->object_ptr)->ref_picture_ptr;
+                        break;
+                    }
                 }
+                if (dispense[next_issue] || !pcs->tpl_valid_pic[next_issue]) {
+                    for (uint32_t blky = 0; blky < (picture_height_in_mb); blky++) {
+                        memset(pcs->tpl_group[next_issue]->pa_me_data->tpl_stats[blky * (picture_width_in_mb)],
+                               0,
+                               (picture_width_in_mb) * sizeof(TplStats));
+                    }
+                } else {
+                    // reused stats: only the propagated costs are specific to the TPL group
+                    TplStats **tpl_stats = pcs->tpl_group[next_issue]->pa_me_data->tpl_stats;
+                    for (uint32_t blk_idx = 0; blk_idx < picture_height_in_mb * picture_width_in_mb; blk_idx++) {
+                        tpl_stats[blk_idx]->mc_dep_rate = 0;
+                        tpl_stats[blk_idx]->mc_dep_dist = 0;
+                    }
+                }
+                if (dispense[next_issue])
+                    tpl_mc_flow_dispenser(scs,
+                                          &pcs->tpl_group[next_issue]->pa_me_data->base_rdmult,
+                                          pcs->tpl_group[next_issue],
+                                          next_issue,
+                                          context_ptr);
+                next_issue++;
             }
-            for (uint32_t blky = 0; blky < (picture_height_in_mb); blky++) {
-                memset(pcs->tpl_group[frame_idx]->pa_me_data->tpl_stats[blky * (picture_width_in_mb)],
-                       0,
-                       (picture_width_in_mb) * sizeof(TplStats));
-            }
-            tpl_on = pcs->tpl_valid_pic[frame_idx];
+            assert(next_issue > frame_idx);
+
+            tpl_on = dispense[frame_idx];
             if (tpl_on)
-                tpl_mc_flow_dispenser(enc_ctx,
-                                      scs,
-                                      &pcs->tpl_group[frame_idx]->pa_me_data->base_rdmult,
-                                      pcs->tpl_group[frame_idx],
-                                      frame_idx,
-                                      context_ptr);
+                tpl_mc_flow_dispenser_wait(enc_ctx, pcs->tpl_group[frame_idx], frame_idx);
 
             if (scs->tpl_lad_mg > 0)
                 if (tpl_on)
                     pcs->tpl_group[frame_idx]->tpl_src_data_ready = 1;
 
-            // Release references
-            for (int i = 0; i < (REF_FRAMES + 1); i++) {
+            // Release references; pictures dispensed after frame_idx are not affected by its refresh
+            for (int i = 0; i < (REF_FRAMES + MAX_TPL_FRAMES_IN_FLIGHT); i++) {
                 // Get empty list entry
                 if (tpl_ref_list[i].is_valid &&
-                    (frame_idx != tpl_ref_list[i].frame_idx || tpl_ref_list[i].refresh_frame_mask == 0)) {
+                    (frame_idx > tpl_ref_list[i].frame_idx ||
+                     (frame_idx == tpl_ref_list[i].frame_idx && tpl_ref_list[i].refresh_frame_mask == 0))) {
                     tpl_ref_list[i].refresh_frame_mask &= ~(
                         pcs->tpl_group[frame_idx]->av1_ref_signal.refresh_frame_mask);
                     if (tpl_ref_list[i].refresh_frame_mask == 0) {
@@ -1924,7 +2007,7 @@ static EbErrorType tpl_mc_flow(EncodeContext *enc_ctx, SequenceControlSet *scs,
     }
 #endif
     // Release un-released tpl references
-    for (int i = 0; i < (REF_FRAMES + 1); i++) {
+    for (int i = 0; i < (REF_FRAMES + MAX_TPL_FRAMES_IN_FLIGHT); i++) {
         // Get empty list entry
         if (tpl_ref_list[i].is_valid) {
             svt_release_object(tpl_ref_list[i].ref);
@@ -2048,7 +2131,7 @@ void *svt_aom_tpl_disp_kernel(void *input_ptr) {
                                                          in_results_ptr->qIndex,
                                                          (b64_geom->width == 64 && b64_geom->height == 64)
                                                              ? pcs->tpl_ctrls.dispenser_search_level
-                                                             : 0);
+                                                             : scs->tpl_ds_level);
                         context_ptr->coded_sb_count++;
                     }
 
@@ -2074,7 +2157,8 @@ void *svt_aom_tpl_disp_kernel(void *input_ptr) {
                     frame_idx,
                     sb_index,
                     in_results_ptr->qIndex,
-                    (b64_geom->width == 64 && b64_geom->height == 64) ? pcs->tpl_ctrls.dispenser_search_level : 0);
+                    (b64_geom->width == 64 && b64_geom->height == 64) ? pcs->tpl_ctrls.dispenser_search_level
+                                                                      : scs->tpl_ds_level);
             }
             svt_post_semaphore(pcs->tpl_disp_done_semaphore);
         }
@@ -2768,6 +2768,20 @@ static void set_hme_search_params_mctf(MeContext *ctx, uint8_t hme_search_level)
     }
 
 }
+// Keep the full-pel 64x64 motion of the farthest searched picture on each side; the PA ME of the
+// central picture uses it as a search centre
+static void tf_store_me_mv(PictureParentControlSet *centre_pcs, MeContext *ctx,
+                           PictureParentControlSet *ref_pcs, uint32_t b64_index) {
+    const int dist = (int)((int64_t)ref_pcs->picture_number - (int64_t)centre_pcs->picture_number);
+    TfMeMv   *tf_mv = &centre_pcs->tf_me_mv[2 * b64_index + (dist > 0)];
+    if (ABS(dist) <= ABS(tf_mv->dist))
+        return;
+    tf_mv->mv_x = (ctx->tf_use_pred_64x64_only_th == (uint8_t)~0) ? ctx->search_results[0][0].hme_sc_x
+                                                                 : _MVXT(ctx->p_best_mv64x64[0]);
+    tf_mv->mv_y = (ctx->tf_use_pred_64x64_only_th == (uint8_t)~0) ? ctx->search_results[0][0].hme_sc_y
+                                                                 : _MVYT(ctx->p_best_mv64x64[0]);
+    tf_mv->dist = (int8_t)dist;
+}
 // Produce the filtered alt-ref picture
 // - core function
 static EbErrorType produce_temporally_filtered_pic(
@@ -3025,6 +3039,9 @@ static EbErrorType produce_temporally_filtered_pic(
                                                ss_x,
                                                ss_y);
 
+            centre_pcs->tf_me_mv[2 * (blk_row * blk_cols + blk_col)].dist     = 0;
+            centre_pcs->tf_me_mv[2 * (blk_row * blk_cols + blk_col) + 1].dist = 0;
+
             // 1st segment: past pics - from closest to farthest
             // 2nd segment: current pic
             // 3rd segment: future pics - from closest to farthest
@@ -3119,7 +3136,7 @@ static EbErrorType produce_temporally_filtered_pic(
                         (uint32_t)blk_row * BH, // y block
                         ctx,
                         input_picture_ptr_central); // source picture
-
+                    tf_store_me_mv(centre_pcs, ctx, pcs_list[frame_index], blk_row * blk_cols + blk_col);
 
                     if (ctx->tf_use_pred_64x64_only_th &&
                         (ctx->tf_use_pred_64x64_only_th == (uint8_t)~0 ||
@@ -4065,6 +4082,9 @@ EbErrorType svt_av1_init_temporal_filtering(
 
         centre_pcs->do_tf =
             TRUE; // set temporal filtering flag ON for current picture
+        // the low delay path filters without motion search
+        centre_pcs->tf_me_mv_valid =
+            centre_pcs->scs->static_config.pred_structure != SVT_AV1_PRED_LOW_DELAY_B;
 
         // save original source picture (to be replaced by the temporally filtered pic)
         // if stat_report is enabled for PSNR computation
@@ -425,6 +425,7 @@ void svt_aom_init_intra_dc_predictors_c_internal(void);
 void svt_aom_init_intra_predictors_internal(void);
 void svt_av1_init_me_luts(void);
 uint8_t svt_aom_get_tpl_group_level(uint8_t tpl, int8_t enc_mode, SvtAv1RcMode rc_mode);
+uint8_t svt_aom_get_tpl_ds_level(uint8_t tpl, int8_t enc_mode, EbInputResolution input_resolution, bool is_scale);
 uint8_t svt_aom_set_tpl_group(PictureParentControlSet* pcs, uint8_t tpl_group_level, uint32_t source_width, uint32_t source_height);
 static void enc_switch_to_real_time(){
 #if !defined(_WIN32)
@@ -1032,6 +1033,15 @@ static EbErrorType load_default_buffer_configuration_settings(
     scs->dlf_fifo_init_count                         = 300;
     scs->cdef_fifo_init_count                        = 300;
     scs->rest_fifo_init_count                        = 300;
+    // With the cross-picture wavefront, EncDec tasks waiting on reference rows keep their task
+    // objects, so up to one task per segment row of every picture in flight may be parked
+    if (scs->cross_pic_wavefront) {
+        const uint32_t wavefront_task_count = scs->picture_control_set_pool_init_count_child *
+            (((scs->max_input_luma_height + 63) >> 6) + 2);
+        scs->mode_decision_configuration_fifo_init_count = MAX(scs->mode_decision_configuration_fifo_init_count,
+                                                               wavefront_task_count);
+        scs->enc_dec_fifo_init_count = MAX(scs->enc_dec_fifo_init_count, wavefront_task_count);
+    }
     //#====================== Processes number ======================
     scs->total_process_init_count                    = 0;
 
@@ -1177,6 +1187,20 @@ static EbErrorType load_default_buffer_configuration_settings(
     }
 #endif
 
+    // TPL pictures whose references are done are dispensed concurrently; size the TPL reference pool for the pictures in flight
+    scs->tpl_frames_in_flight = (uint8_t)MIN(MAX_TPL_FRAMES_IN_FLIGHT, scs->tpl_disp_process_init_count);
+    scs->tpl_reference_picture_buffer_init_count = min_tpl_ref + scs->tpl_frames_in_flight - 1;
+
+    // Sub-SB parallel MD shares the quadrants of an SB with the other EncDec threads, each thread
+    // keeping at most 3 quadrant tasks in flight
+    if (scs->sub_sb_parallel_md) {
+        if (scs->enc_dec_process_init_count == 1) {
+            SVT_WARN("Sub-SB parallel MD needs more than one EncDec thread, and will be disabled\n");
+            scs->sub_sb_parallel_md = 0;
+        } else
+            scs->mode_decision_configuration_fifo_init_count += 3 * scs->enc_dec_process_init_count;
+    }
+
     scs->total_process_init_count += 6; // single processes count
 #if CLN_LP_LVLS
     if (scs->static_config.pass == 0 || scs->static_config.pass == 2) {
@@ -1236,6 +1260,7 @@ static PicMgrPorts pic_mgr_ports[] = {
     {PIC_MGR_INPUT_PORT_SOP,            0},
     {PIC_MGR_INPUT_PORT_PACKETIZATION,  0},
     {PIC_MGR_INPUT_PORT_REST,           0},
+    {PIC_MGR_INPUT_PORT_MDC,            0},
     {PIC_MGR_INPUT_PORT_INVALID,        0}
 };
 static uint32_t pic_mgr_port_lookup(
@@ -1714,8 +1739,9 @@ static int create_tpl_ref_buf_descs(EbEncHandle *enc_handle_ptr, uint32_t instan
     EbPictureBufferDescInitData       ref_pic_buf_desc_init_data;
     // PA Reference Picture Buffers
     // Currently, only Luma samples are needed in the PA
-    ref_pic_buf_desc_init_data.max_width = scs->max_input_luma_width;
-    ref_pic_buf_desc_init_data.max_height = scs->max_input_luma_height;
+    // The TPL recon is kept at the resolution the dispenser works at
+    ref_pic_buf_desc_init_data.max_width = scs->max_input_luma_width >> scs->tpl_ds_level;
+    ref_pic_buf_desc_init_data.max_height = scs->max_input_luma_height >> scs->tpl_ds_level;
     ref_pic_buf_desc_init_data.bit_depth = EB_EIGHT_BIT;
     ref_pic_buf_desc_init_data.color_format = EB_YUV420; //use 420 for picture analysis
 
@@ -2112,6 +2138,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     pic_mgr_ports[PIC_MGR_INPUT_PORT_SOP].count = enc_handle_ptr->scs_instance_array[0]->scs->source_based_operations_process_init_count;
     pic_mgr_ports[PIC_MGR_INPUT_PORT_PACKETIZATION].count = EB_PacketizationProcessInitCount;
     pic_mgr_ports[PIC_MGR_INPUT_PORT_REST].count = enc_handle_ptr->scs_instance_array[0]->scs->rest_process_init_count;
+    pic_mgr_ports[PIC_MGR_INPUT_PORT_MDC].count = enc_handle_ptr->scs_instance_array[0]->scs->mode_decision_configuration_process_init_count;
     // Rate Control
     rate_control_ports[RATE_CONTROL_INPUT_PORT_INLME].count = EB_PictureManagerProcessInitCount;
     rate_control_ports[RATE_CONTROL_INPUT_PORT_PACKETIZATION].count = EB_PacketizationProcessInitCount;
@@ -2569,7 +2596,8 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
                     svt_aom_mode_decision_configuration_context_ctor,
                     enc_handle_ptr,
                     process_index,
-                    enc_dec_port_lookup(ENCDEC_INPUT_PORT_MDC, process_index));
+                    enc_dec_port_lookup(ENCDEC_INPUT_PORT_MDC, process_index),
+                    pic_mgr_port_lookup(PIC_MGR_INPUT_PORT_MDC, process_index));
             }
         }
         // EncDec Contexts
@@ -4184,6 +4212,41 @@ static void validate_scaling_params(SequenceControlSet *scs) {
     }
 }
 
+/*
+* Validate the cross-picture wavefront against the rest of the configuration. The wavefront needs
+* references whose rows are final as soon as they are reconstructed (no frame level post-filtering
+* or re-encoding), and a 64x64 SB grid shared by all the pictures.
+*/
+static void set_cross_pic_wavefront(SequenceControlSet *scs) {
+    EbSvtAv1EncConfiguration *cfg = &scs->static_config;
+    scs->cross_pic_wavefront      = cfg->cross_pic_wavefront;
+    if (!scs->cross_pic_wavefront)
+        return;
+    if (cfg->encoder_bit_depth > EB_EIGHT_BIT || cfg->tile_rows || cfg->tile_columns ||
+        cfg->superres_mode > SUPERRES_NONE || cfg->resize_mode > RESIZE_NONE ||
+        cfg->rate_control_mode != SVT_AV1_RC_MODE_CQP_OR_CRF || cfg->max_bit_rate || cfg->pass != ENC_SINGLE_PASS ||
+        cfg->film_grain_denoise_strength || cfg->enable_overlays) {
+        SVT_WARN(
+            "Cross-picture wavefront is only supported for 8-bit single pass CRF / CQP without tiles, super-res, "
+            "resize, film grain or overlays, and will be disabled\n");
+        scs->cross_pic_wavefront = 0;
+    }
+}
+/*
+* Validate the static SB fast path. The source hashes it compares are taken at full resolution on
+* 4:2:0 input.
+*/
+static void set_static_sb_skip(SequenceControlSet *scs) {
+    EbSvtAv1EncConfiguration *cfg = &scs->static_config;
+    scs->static_sb_skip           = cfg->enable_static_sb_skip;
+    if (!scs->static_sb_skip)
+        return;
+    if (cfg->superres_mode > SUPERRES_NONE || cfg->resize_mode > RESIZE_NONE ||
+        cfg->encoder_color_format != EB_YUV420) {
+        SVT_WARN("Static SB skip is only supported for 4:2:0 input without super-res or resize, and will be disabled\n");
+        scs->static_sb_skip = 0;
+    }
+}
 static void set_param_based_on_input(SequenceControlSet *scs)
 {
     set_multi_pass_params(
@@ -4333,10 +4396,23 @@ static void set_param_based_on_input(SequenceControlSet *scs)
             // update the look ahead size
             update_look_ahead(scs);
     }
+    scs->tpl_ds_level = svt_aom_get_tpl_ds_level(
+        scs->tpl,
+        scs->static_config.enc_mode,
+        scs->input_resolution,
+        scs->static_config.superres_mode > SUPERRES_NONE || scs->static_config.resize_mode > RESIZE_NONE);
+    set_cross_pic_wavefront(scs);
+    set_static_sb_skip(scs);
+    // Checked against the EncDec thread count when the processes are set up, and per SB in EncDec
+    scs->sub_sb_parallel_md  = scs->static_config.enable_sub_sb_parallel_md;
+    scs->md_early_term_level = scs->static_config.md_early_term_level;
     // when resize mode is used, use sb 64 because of a r2r when 128 is used
     // In low delay mode, sb size is set to 64
     // in 240P resolution, sb size is set to 64
-    if ((scs->static_config.fast_decode && scs->static_config.qp <= 56 && !(scs->input_resolution <= INPUT_SIZE_360p_RANGE)) ||
+    // the cross-picture wavefront tracks the reference progress in 64x64 SB rows
+    // the static SB map is built on the 64x64 ME grid
+    if (scs->cross_pic_wavefront || scs->static_sb_skip ||
+        (scs->static_config.fast_decode && scs->static_config.qp <= 56 && !(scs->input_resolution <= INPUT_SIZE_360p_RANGE)) ||
         scs->static_config.resize_mode > RESIZE_NONE ||
         scs->static_config.pred_structure == SVT_AV1_PRED_LOW_DELAY_B ||
         (scs->input_resolution == INPUT_SIZE_240p_RANGE) ||
@@ -5030,6 +5106,21 @@ static void copy_api_from_app(
     // Noise normalization strength
     scs->static_config.noise_norm_strength = config_struct->noise_norm_strength;
 
+    // Hash based ME pre-pass
+    scs->static_config.enable_hash_me = config_struct->enable_hash_me;
+
+    // Cross-picture wavefront
+    scs->static_config.cross_pic_wavefront = config_struct->cross_pic_wavefront;
+
+    // Static SB fast path
+    scs->static_config.enable_static_sb_skip = config_struct->enable_static_sb_skip;
+
+    // Sub-SB parallel MD
+    scs->static_config.enable_sub_sb_parallel_md = config_struct->enable_sub_sb_parallel_md;
+
+    // MD early termination
+    scs->static_config.md_early_term_level = config_struct->md_early_term_level;
+
     // Override settings for Still Picture tune
     if (scs->static_config.tune == 4) {
         SVT_WARN("Tune 4: Still Picture is experimental, expect frequent changes that may modify present behavior.\n");
@@ -929,6 +929,31 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet *scs) {
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->enable_hash_me > 1) {
+        SVT_ERROR("Instance %u: Enable hash ME must be between 0 and 1\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->cross_pic_wavefront > 16) {
+        SVT_ERROR("Instance %u: Cross-picture wavefront must be between 0 and 16\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->enable_static_sb_skip > 1) {
+        SVT_ERROR("Instance %u: Enable static SB skip must be between 0 and 1\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->enable_sub_sb_parallel_md > 1) {
+        SVT_ERROR("Instance %u: Enable sub-SB parallel MD must be between 0 and 1\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->md_early_term_level > 2) {
+        SVT_ERROR("Instance %u: MD early termination level must be between 0 and 2\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     return return_error;
 }
 
@@ -1097,6 +1122,11 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration *config_ptr) {
     config_ptr->tf_strength                       = 1;
     config_ptr->kf_tf_strength                    = 1;
     config_ptr->noise_norm_strength               = 0;
+    config_ptr->enable_hash_me                    = FALSE;
+    config_ptr->cross_pic_wavefront               = 0;
+    config_ptr->enable_static_sb_skip             = FALSE;
+    config_ptr->enable_sub_sb_parallel_md         = FALSE;
+    config_ptr->md_early_term_level               = 0;
     return return_error;
 }
 
@@ -2136,6 +2166,8 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration *config_
         {"kf-tf-strength", &config_struct->kf_tf_strength},
         {"noise-norm-strength", &config_struct->noise_norm_strength},
         {"fast-decode", &config_struct->fast_decode},
+        {"cross-pic-wavefront", &config_struct->cross_pic_wavefront},
+        {"md-early-term", &config_struct->md_early_term_level},
     };
     const size_t uint8_opts_size = sizeof(uint8_opts) / sizeof(uint8_opts[0]);
 
@@ -2241,6 +2273,9 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration *config_
         {"enable-alt-curve", &config_struct->enable_alt_curve},
         {"max-32-tx-size", &config_struct->max_32_tx_size},
         {"adaptive-film-grain", &config_struct->adaptive_film_grain},
+        {"enable-hash-me", &config_struct->enable_hash_me},
+        {"enable-static-sb-skip", &config_struct->enable_static_sb_skip},
+        {"enable-sub-sb-parallel-md", &config_struct->enable_sub_sb_parallel_md},
     };
     const size_t bool_opts_size = sizeof(bool_opts) / sizeof(bool_opts[0]);
 
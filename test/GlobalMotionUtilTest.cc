@@ -38,6 +38,10 @@ extern "C" {
 using std::tuple;
 using std::vector;
 using svt_av1_test_tool::SVTRandom;
+
+/** setup_test_env is implemented in test/TestEnv.c */
+extern "C" void setup_test_env();
+
 namespace {
 
 using Point = struct {
@@ -87,6 +91,7 @@ template <typename Sample, typename FuncType>
 class RansacTest : public ::testing::TestWithParam<TransformationType> {
   protected:
     RansacTest() : rnd_(0, CoordinateMax) {
+        setup_test_env();
         data_.clear();
         ref_.clear();
         memset(&mat_, 0, sizeof(mat_));
@@ -118,7 +123,7 @@ class RansacTest : public ::testing::TestWithParam<TransformationType> {
         }
     }
 
-    void run_test(size_t times) {
+    void run_test(size_t times, uint8_t adaptive_trials) {
         for (size_t i = 0; i < times; i++) {
             data_.clear();
             ref_.clear();
@@ -127,7 +132,7 @@ class RansacTest : public ::testing::TestWithParam<TransformationType> {
             int inliers = 0;
             generate_data(max_data_count, inliers);
             ASSERT_NE(inliers, 0) << "generate data failed!";
-            do_ransac_check();
+            do_ransac_check(adaptive_trials);
         }
     }
 
@@ -135,7 +140,7 @@ class RansacTest : public ::testing::TestWithParam<TransformationType> {
 
     virtual FuncType get_ransac_func(TransformationType type) = 0;
 
-    void do_ransac_check() {
+    void do_ransac_check(uint8_t adaptive_trials) {
         const int npoints = (int)data_.size();
         Sample *points = new Sample[npoints * 4];
         ASSERT_NE(points, nullptr);
@@ -157,8 +162,12 @@ class RansacTest : public ::testing::TestWithParam<TransformationType> {
 
         FuncType ransac_func = (FuncType)get_ransac_func(GetParam());
         ASSERT_NE(ransac_func, nullptr);
-        int ret = ransac_func(
-            points, npoints, num_inliers_by_motion, motions, num_motions);
+        int ret = ransac_func(points,
+                              npoints,
+                              num_inliers_by_motion,
+                              motions,
+                              num_motions,
+                              adaptive_trials);
         ASSERT_EQ(ret, 0);
 
         /** check for the number of inlier */
@@ -346,7 +355,11 @@ static const TransformationType transform_table[] = {
     TRANSLATION, ROTZOOM, AFFINE};
 
 TEST_P(RansacIntTest, CheckOutput) {
-    run_test(1000);
+    run_test(1000, 0);
+};
+
+TEST_P(RansacIntTest, CheckOutputAdaptiveTrials) {
+    run_test(1000, 1);
 };
 
 INSTANTIATE_TEST_SUITE_P(GlobalMotion, RansacIntTest,
@@ -0,0 +1,419 @@
+/*
+ * Copyright(c) 2024 Alliance for Open Media
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file HashTest.cc
+ *
+ * @brief Unit test for the CRC32C based IntraBC hash functions:
+ * - svt_av1_get_crc32c_value
+ * - svt_av1_generate_block_2x2_hash_row
+ * - svt_av1_generate_block_hash_row
+ * and for the IntraBC block hash table, including the whole picture build
+ * used by the hash ME pre-pass (svt_av1_build_picture_block_hash_map).
+ *
+ ******************************************************************************/
+#include <stdlib.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "definitions.h"
+#include "hash_motion.h"
+#include "random.h"
+#include "svt_time.h"
+#include "util.h"
+
+using svt_av1_test_tool::SVTRandom;
+
+/** setup_test_env is implemented in test/TestEnv.c */
+extern "C" void setup_test_env();
+
+namespace {
+
+static const int kWidth = 128;
+static const int kStride = kWidth + 32;
+static const int kHeight = 34;
+
+// CRC-32C check vectors from RFC 3720, B.4.
+TEST(Crc32cTest, KnownVectors) {
+    uint32_t words[8];
+
+    memset(words, 0x00, sizeof(words));
+    EXPECT_EQ(0x8A9136AAu, svt_av1_get_crc32c_value_c(words, 8));
+    memset(words, 0xFF, sizeof(words));
+    EXPECT_EQ(0x62A8AB43u, svt_av1_get_crc32c_value_c(words, 8));
+}
+
+using Crc32cFunc = uint32_t (*)(const uint32_t *words, int count);
+
+class Crc32cValueTest : public ::testing::TestWithParam<Crc32cFunc> {};
+
+TEST_P(Crc32cValueTest, MatchTest) {
+    SVTRandom rnd(0, 0x7FFFFFFF);
+    uint32_t words[64];
+    const Crc32cFunc test_func = GetParam();
+
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 64; j++)
+            words[j] = (uint32_t)rnd.random() ^ ((uint32_t)rnd.random() << 1);
+        for (int count = 1; count <= 64; count++)
+            ASSERT_EQ(svt_av1_get_crc32c_value_c(words, count),
+                      test_func(words, count))
+                << "count " << count;
+    }
+}
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Crc32cValueTest);
+
+using Hash2x2RowFunc = void (*)(const uint8_t *src, int stride, int width,
+                                uint32_t *hash1, uint32_t *hash2,
+                                int8_t *row_same, int8_t *col_same);
+
+class Hash2x2RowTest : public ::testing::TestWithParam<Hash2x2RowFunc> {
+  protected:
+    void RunCheck(bool flat) {
+        SVTRandom rnd(0, flat ? 1 : 255);
+        uint8_t src[kStride * 2];
+        uint32_t hash_ref[2][kWidth], hash_tst[2][kWidth];
+        int8_t same_ref[2][kWidth], same_tst[2][kWidth];
+
+        for (int i = 0; i < 100; i++) {
+            for (int j = 0; j < kStride * 2; j++)
+                src[j] = (uint8_t)rnd.random();
+            for (int width = 1; width <= kWidth; width++) {
+                svt_av1_generate_block_2x2_hash_row_c(src,
+                                                      kStride,
+                                                      width,
+                                                      hash_ref[0],
+                                                      hash_ref[1],
+                                                      same_ref[0],
+                                                      same_ref[1]);
+                GetParam()(src,
+                           kStride,
+                           width,
+                           hash_tst[0],
+                           hash_tst[1],
+                           same_tst[0],
+                           same_tst[1]);
+                for (int k = 0; k < 2; k++) {
+                    ASSERT_EQ(0,
+                              memcmp(hash_ref[k],
+                                     hash_tst[k],
+                                     width * sizeof(hash_ref[k][0])))
+                        << "width " << width;
+                    ASSERT_EQ(0, memcmp(same_ref[k], same_tst[k], width))
+                        << "width " << width;
+                }
+            }
+        }
+    }
+};
+
+TEST_P(Hash2x2RowTest, MatchTest) {
+    RunCheck(false);
+}
+
+TEST_P(Hash2x2RowTest, FlatMatchTest) {
+    RunCheck(true);
+}
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Hash2x2RowTest);
+
+using HashRowFunc = void (*)(const uint32_t *src_hash1,
+                             const uint32_t *src_hash2, int src_size,
+                             int stride, int width, uint32_t *dst_hash1,
+                             uint32_t *dst_hash2);
+
+class HashRowTest : public ::testing::TestWithParam<HashRowFunc> {
+  protected:
+    void SetUp() override {
+        src_[0] = new uint32_t[kStride * kHeight];
+        src_[1] = new uint32_t[kStride * kHeight];
+    }
+
+    void TearDown() override {
+        delete[] src_[0];
+        delete[] src_[1];
+    }
+
+    void RunCheck(int iterations, bool speed) {
+        SVTRandom rnd(0, 0x7FFFFFFF);
+        uint32_t dst_ref[2][kWidth], dst_tst[2][kWidth];
+        double time_c = 0, time_o = 0;
+        uint64_t start_s, start_us, mid_s, mid_us, end_s, end_us;
+
+        for (int i = 0; i < kStride * kHeight; i++) {
+            src_[0][i] = (uint32_t)rnd.random() << 1;
+            src_[1][i] = (uint32_t)rnd.random() << 1;
+        }
+        for (int src_size = 2; src_size <= 16; src_size *= 2) {
+            const int width = kWidth - src_size;
+            svt_av1_get_time(&start_s, &start_us);
+            for (int i = 0; i < iterations; i++)
+                svt_av1_generate_block_hash_row_c(src_[0],
+                                                  src_[1],
+                                                  src_size,
+                                                  kStride,
+                                                  width,
+                                                  dst_ref[0],
+                                                  dst_ref[1]);
+            svt_av1_get_time(&mid_s, &mid_us);
+            for (int i = 0; i < iterations; i++)
+                GetParam()(src_[0],
+                           src_[1],
+                           src_size,
+                           kStride,
+                           width,
+                           dst_tst[0],
+                           dst_tst[1]);
+            svt_av1_get_time(&end_s, &end_us);
+            time_c += svt_av1_compute_overall_elapsed_time_ms(
+                start_s, start_us, mid_s, mid_us);
+            time_o += svt_av1_compute_overall_elapsed_time_ms(
+                mid_s, mid_us, end_s, end_us);
+
+            for (int k = 0; k < 2; k++)
+                ASSERT_EQ(0,
+                          memcmp(dst_ref[k],
+                                 dst_tst[k],
+                                 width * sizeof(dst_ref[k][0])))
+                    << "src_size " << src_size;
+        }
+        if (speed)
+            printf("c_time = %f \t o_time = %f \t Gain = %4.2f \n",
+                   time_c,
+                   time_o,
+                   time_c / time_o);
+    }
+
+    uint32_t *src_[2];
+};
+
+TEST_P(HashRowTest, MatchTest) {
+    RunCheck(1, false);
+}
+
+TEST_P(HashRowTest, DISABLED_Speed) {
+    RunCheck(100000, true);
+}
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(HashRowTest);
+
+// Hash table built from screen content like data: a few distinct block
+// hashes repeated all over the picture, and flat blocks skipped.
+class HashTableTest : public ::testing::Test {
+  protected:
+    static const int kPicWidth = 1920;
+    static const int kPicHeight = 1080;
+    static const int kDistinctHashes = 256;
+
+    void SetUp() override {
+        memset(&table_, 0, sizeof(table_));
+        hash_[0] = new uint32_t[kPicWidth * kPicHeight];
+        hash_[1] = new uint32_t[kPicWidth * kPicHeight];
+        is_same_ = new int8_t[kPicWidth * kPicHeight];
+
+        SVTRandom rnd(0, 0x7FFFFFFF);
+        uint32_t distinct[kDistinctHashes];
+        for (int i = 0; i < kDistinctHashes; i++)
+            distinct[i] = (uint32_t)rnd.random();
+        SVTRandom pick(0, kDistinctHashes - 1);
+        SVTRandom flat(0, 3);
+        for (int i = 0; i < kPicWidth * kPicHeight; i++) {
+            const uint32_t h = distinct[pick.random()];
+            hash_[0][i] = h;
+            hash_[1][i] = h * 3 + (uint32_t)flat.random();
+            is_same_[i] = flat.random() != 0;
+        }
+    }
+
+    void TearDown() override {
+        svt_av1_hash_table_destroy(&table_);
+        delete[] hash_[0];
+        delete[] hash_[1];
+        delete[] is_same_;
+    }
+
+    void Build(int width, int height) {
+        ASSERT_EQ(EB_ErrorNone,
+                  svt_aom_rtime_alloc_svt_av1_hash_table_create(&table_));
+        for (int size = 8; size <= 32; size *= 2)
+            svt_aom_rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(
+                &table_, hash_, is_same_, width, height, size);
+    }
+
+    // Compare every bucket with a brute force scan in insertion order.
+    void Check(int width, int height) {
+        const int size = 16;
+        const uint32_t key_base = 2 << 16;
+        const int x_end = width - size + 1;
+        const int y_end = height - size + 1;
+        for (int i = 0; i < 8; i++) {
+            const uint32_t key = key_base + (hash_[0][i * 7] & 0xFFFF);
+            int expected = 0;
+            const BlockHash *block = nullptr;
+            const int count = svt_av1_hash_table_count(&table_, key);
+            if (count)
+                block = svt_av1_hash_get_first_block(&table_, key);
+            for (int x = 0; x < x_end; x++) {
+                for (int y = 0; y < y_end; y++) {
+                    const int pos = y * width + x;
+                    if (!is_same_[pos] ||
+                        (hash_[0][pos] & 0xFFFF) != (key & 0xFFFF))
+                        continue;
+                    ASSERT_LT(expected, count);
+                    EXPECT_EQ(x, block[expected].x);
+                    EXPECT_EQ(y, block[expected].y);
+                    EXPECT_EQ(hash_[1][pos], block[expected].hash_value2);
+                    expected++;
+                }
+            }
+            EXPECT_EQ(expected, count);
+        }
+        // 4x4 blocks were not added
+        EXPECT_EQ(0, svt_av1_hash_table_count(&table_, hash_[0][0] & 0xFFFF));
+    }
+
+    HashTable table_;
+    uint32_t *hash_[2];
+    int8_t *is_same_;
+};
+
+TEST_F(HashTableTest, MatchTest) {
+    // the second picture reuses and grows the buffers of the first one
+    Build(kPicWidth / 4, kPicHeight / 4);
+    Check(kPicWidth / 4, kPicHeight / 4);
+    Build(kPicWidth / 2, kPicHeight / 2);
+    Check(kPicWidth / 2, kPicHeight / 2);
+    Build(kPicWidth / 8, kPicHeight / 8);
+    Check(kPicWidth / 8, kPicHeight / 8);
+}
+
+TEST_F(HashTableTest, DISABLED_Speed) {
+    const int num_iter = 10;
+    uint64_t start_s, start_us, mid_s, mid_us, end_s, end_us;
+    uint64_t matches = 0;
+
+    svt_av1_get_time(&start_s, &start_us);
+    for (int i = 0; i < num_iter; i++)
+        Build(kPicWidth, kPicHeight);
+    svt_av1_get_time(&mid_s, &mid_us);
+    for (int i = 0; i < num_iter; i++) {
+        for (int pos = 0; pos < kPicWidth * kPicHeight; pos += 61) {
+            const uint32_t key = (1 << 16) + (hash_[0][pos] & 0xFFFF);
+            const int count = svt_av1_hash_table_count(&table_, key);
+            if (!count)
+                continue;
+            const BlockHash *block = svt_av1_hash_get_first_block(&table_, key);
+            for (int j = 0; j < count; j++)
+                matches += block[j].hash_value2 == hash_[1][pos];
+        }
+    }
+    svt_av1_get_time(&end_s, &end_us);
+    printf("build_time = %f \t lookup_time = %f \t matches = %llu\n",
+           svt_av1_compute_overall_elapsed_time_ms(
+               start_s, start_us, mid_s, mid_us),
+           svt_av1_compute_overall_elapsed_time_ms(mid_s, mid_us, end_s, end_us),
+           (unsigned long long)matches);
+}
+
+// Every 64x64 block of a textured picture is found in the table built by
+// svt_av1_build_picture_block_hash_map, with the hashes computed block by
+// block by svt_av1_get_block_hash_value.
+TEST(PictureHashMapTest, MatchTest) {
+    const int width = 200, height = 136, stride = width + 24;
+    const int size = 64;
+    setup_test_env();
+    uint8_t *pic = new uint8_t[stride * height];
+    SVTRandom rnd(0, 255);
+    for (int i = 0; i < stride * height; i++)
+        pic[i] = (uint8_t)rnd.random();
+    // a repeated block gives two entries with the same hashes
+    for (int y = 0; y < size; y++)
+        memcpy(pic + (y + 70) * stride + 130, pic + (y + 3) * stride + 5, size);
+
+    Yv12BufferConfig picture;
+    memset(&picture, 0, sizeof(picture));
+    picture.y_buffer = pic;
+    picture.y_stride = stride;
+    picture.y_crop_width = width;
+    picture.y_crop_height = height;
+
+    HashTable table;
+    memset(&table, 0, sizeof(table));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_build_picture_block_hash_map(&table, &picture, size));
+
+    uint32_t *hash_value_buffer[2][2];
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            hash_value_buffer[i][j] = new uint32_t[(size / 2) * (size / 2)];
+    for (int y = 0; y <= height - size; y += 9) {
+        for (int x = 0; x <= width - size; x += 7) {
+            uint32_t hash1, hash2;
+            svt_av1_get_block_hash_value(pic + y * stride + x,
+                                         stride,
+                                         size,
+                                         &hash1,
+                                         &hash2,
+                                         0,
+                                         hash_value_buffer);
+            const int count = svt_av1_hash_table_count(&table, hash1);
+            ASSERT_GT(count, 0);
+            const BlockHash *block = svt_av1_hash_get_first_block(&table, hash1);
+            int found = 0;
+            for (int i = 0; i < count; i++)
+                found += block[i].x == x && block[i].y == y &&
+                         block[i].hash_value2 == hash2;
+            EXPECT_EQ(1, found) << "x " << x << " y " << y;
+        }
+    }
+
+    uint32_t hash1, hash2;
+    svt_av1_get_block_hash_value(
+        pic + 70 * stride + 130, stride, size, &hash1, &hash2, 0, hash_value_buffer);
+    const BlockHash *block = svt_av1_hash_get_first_block(&table, hash1);
+    int same = 0;
+    for (int i = 0; i < svt_av1_hash_table_count(&table, hash1); i++)
+        same += block[i].hash_value2 == hash2;
+    EXPECT_EQ(2, same);
+
+    // only the 64x64 blocks were added
+    EXPECT_EQ(1 << 4, table.level_mask);
+
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            delete[] hash_value_buffer[i][j];
+    svt_av1_hash_table_destroy(&table);
+    delete[] pic;
+}
+
+#if ARCH_X86_64
+INSTANTIATE_TEST_SUITE_P(SSE4_2, Crc32cValueTest,
+                         ::testing::Values(svt_av1_get_crc32c_value_sse4_2));
+INSTANTIATE_TEST_SUITE_P(
+    SSE4_2, Hash2x2RowTest,
+    ::testing::Values(svt_av1_generate_block_2x2_hash_row_sse4_2));
+INSTANTIATE_TEST_SUITE_P(
+    SSE4_2, HashRowTest,
+    ::testing::Values(svt_av1_generate_block_hash_row_sse4_2));
+#endif  // ARCH_X86_64
+
+#if defined(ARCH_AARCH64) && HAVE_ARM_CRC32
+INSTANTIATE_TEST_SUITE_P(
+    ARM_CRC32, Crc32cValueTest,
+    ::testing::Values(svt_av1_get_crc32c_value_arm_crc32));
+INSTANTIATE_TEST_SUITE_P(
+    ARM_CRC32, Hash2x2RowTest,
+    ::testing::Values(svt_av1_generate_block_2x2_hash_row_arm_crc32));
+INSTANTIATE_TEST_SUITE_P(
+    ARM_CRC32, HashRowTest,
+    ::testing::Values(svt_av1_generate_block_hash_row_arm_crc32));
+#endif  // ARCH_AARCH64 && HAVE_ARM_CRC32
+
+}  // namespace
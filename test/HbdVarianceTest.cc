@@ -15,7 +15,7 @@
  *
  * @brief Unit test for HBD variance
  * functions:
- * - svt_aom_highbd_BD{8,10,12}_varianceW{8,16,32,64}xH{4,8,16,32,64}
+ * - svt_aom_highbd_BD{8,10,12}_varianceW{4,8,16,32,64}xH{4,8,16,32,64}
  *
  * @author  Cidana-Wenyao, Cidana-Edmond
  *
@@ -103,7 +103,7 @@ using HbdVarianceParam = std::tuple<uint32_t,            /**< width */
 /**
  * @brief Unit test for HBD variance
  * functions:
- * - svt_aom_highbd_BD{8,10,12}_varianceW{8,16,32,64}xH{4,8,16,32,64}
+ * - svt_aom_highbd_BD{8,10,12}_varianceW{4,8,16,32,64}xH{4,8,16,32,64}
  *
  * Test strategy:
  *  This test case use random source, max source, zero source as test
@@ -261,9 +261,14 @@ INSTANTIATE_TEST_SUITE_P(SSE2, HbdVarianceTest,
                          ::testing::ValuesIn(HbdTestVector_sse2));
 
 static const HbdVarianceParam HbdTestVector_avx2[] = {
+    HbdVarianceParam(4, 4, 10, svt_aom_highbd_10_variance4x4_avx2),
+    HbdVarianceParam(4, 8, 10, svt_aom_highbd_10_variance4x8_avx2),
+    HbdVarianceParam(4, 16, 10, svt_aom_highbd_10_variance4x16_avx2),
+    HbdVarianceParam(8, 4, 10, svt_aom_highbd_10_variance8x4_avx2),
     HbdVarianceParam(8, 8, 10, svt_aom_highbd_10_variance8x8_avx2),
     HbdVarianceParam(8, 16, 10, svt_aom_highbd_10_variance8x16_avx2),
     HbdVarianceParam(8, 32, 10, svt_aom_highbd_10_variance8x32_avx2),
+    HbdVarianceParam(16, 4, 10, svt_aom_highbd_10_variance16x4_avx2),
     HbdVarianceParam(16, 8, 10, svt_aom_highbd_10_variance16x8_avx2),
     HbdVarianceParam(16, 16, 10, svt_aom_highbd_10_variance16x16_avx2),
     HbdVarianceParam(16, 32, 10, svt_aom_highbd_10_variance16x32_avx2),
@@ -283,6 +288,18 @@ static const HbdVarianceParam HbdTestVector_avx2[] = {
 INSTANTIATE_TEST_SUITE_P(AVX2, HbdVarianceTest,
                          ::testing::ValuesIn(HbdTestVector_avx2));
 
+#if EN_AVX512_SUPPORT
+static const HbdVarianceParam HbdTestVector_avx512[] = {
+    HbdVarianceParam(4, 8, 10, svt_aom_highbd_10_variance4x8_avx512),
+    HbdVarianceParam(4, 16, 10, svt_aom_highbd_10_variance4x16_avx512),
+    HbdVarianceParam(8, 4, 10, svt_aom_highbd_10_variance8x4_avx512),
+    HbdVarianceParam(16, 4, 10, svt_aom_highbd_10_variance16x4_avx512),
+};
+
+INSTANTIATE_TEST_SUITE_P(AVX512, HbdVarianceTest,
+                         ::testing::ValuesIn(HbdTestVector_avx512));
+#endif  // EN_AVX512_SUPPORT
+
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -13,9 +13,9 @@
 /******************************************************************************
  * @file QuantAsmTest.c
  *
- * @brief Unit test for quantize avx2 functions:
- * - svt_aom_highbd_quantize_b_avx2
- * - svt_aom_quantize_b_avx2
+ * @brief Unit test for quantize avx2 and avx512 functions:
+ * - svt_aom_highbd_quantize_b_avx2/avx512
+ * - svt_aom_quantize_b_avx2/avx512
  *
  * @author Cidana-Zhengwen
  *
@@ -31,6 +31,7 @@
 #include "definitions.h"
 #include "transforms.h"
 #include "pcs.h"
+#include "sequence_control_set.h"
 #include "aom_dsp_rtcd.h"
 #include "util.h"
 #include "random.h"
@@ -40,7 +41,7 @@ namespace QuantizeAsmTest {
 extern "C" void svt_av1_build_quantizer(
     EbBitDepth bit_depth, int32_t y_dc_delta_q, int32_t u_dc_delta_q,
     int32_t u_ac_delta_q, int32_t v_dc_delta_q, int32_t v_ac_delta_q,
-    Quants *const quants, Dequants *const deq);
+    Quants *const quants, Dequants *const deq, PictureParentControlSet *pcs);
 
 using QuantizeFunc = void (*)(const TranLow *coeff_ptr, intptr_t n_coeffs,
                               const int16_t *zbin_ptr, const int16_t *round_ptr,
@@ -56,9 +57,9 @@ using QuantizeParam = std::tuple<int, int, QuantizeFunc>;
 
 using svt_av1_test_tool::SVTRandom;  // to generate the random
 /**
- * @brief Unit test for quantize avx2 functions:
- * - svt_aom_highbd_quantize_b_avx2
- * - svt_aom_quantize_b_avx2
+ * @brief Unit test for quantize avx2 and avx512 functions:
+ * - svt_aom_highbd_quantize_b_avx2/avx512
+ * - svt_aom_quantize_b_avx2/avx512
  *
  * Test strategy:
  * These tests use quantize C function as reference, input the same data and
@@ -88,7 +89,17 @@ class QuantizeBTest : public ::testing::TestWithParam<QuantizeParam> {
         coeff_max_ = (1 << (7 + bd_)) - 1;
         rnd_ = new SVTRandom(coeff_min_, coeff_max_);
 
-        svt_av1_build_quantizer(bd_, 0, 0, 0, 0, 0, &qtab_quants_, &qtab_deq_);
+        // zeroed sets select the default tune and sharpness tables
+        SequenceControlSet *scs = reinterpret_cast<SequenceControlSet *>(
+            calloc(1, sizeof(SequenceControlSet)));
+        PictureParentControlSet *pcs =
+            reinterpret_cast<PictureParentControlSet *>(
+                calloc(1, sizeof(PictureParentControlSet)));
+        pcs->scs = scs;
+        svt_av1_build_quantizer(
+            bd_, 0, 0, 0, 0, 0, &qtab_quants_, &qtab_deq_, pcs);
+        free(pcs);
+        free(scs);
         setup_func_ptrs();
     }
 
@@ -337,6 +348,26 @@ INSTANTIATE_TEST_SUITE_P(
                                          static_cast<int>(TX_64X64)),
                        ::testing::Values(static_cast<int>(EB_TEN_BIT)),
                        ::testing::Values(svt_aom_highbd_quantize_b_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    LBD_AVX512, QuantizeBTest,
+    ::testing::Combine(::testing::Values(static_cast<int>(TX_4X4),
+                                         static_cast<int>(TX_16X16),
+                                         static_cast<int>(TX_32X32),
+                                         static_cast<int>(TX_64X64)),
+                       ::testing::Values(static_cast<int>(EB_EIGHT_BIT)),
+                       ::testing::Values(svt_aom_quantize_b_avx512)));
+
+INSTANTIATE_TEST_SUITE_P(
+    HBD_AVX512, QuantizeBTest,
+    ::testing::Combine(::testing::Values(static_cast<int>(TX_4X4),
+                                         static_cast<int>(TX_16X16),
+                                         static_cast<int>(TX_32X32),
+                                         static_cast<int>(TX_64X64)),
+                       ::testing::Values(static_cast<int>(EB_TEN_BIT)),
+                       ::testing::Values(svt_aom_highbd_quantize_b_avx512)));
+#endif  // EN_AVX512_SUPPORT
 #endif  // ARCH_X86_64
 
 class QuantizeBQmTest : public QuantizeBTest {
@@ -543,6 +574,26 @@ INSTANTIATE_TEST_SUITE_P(
                                          static_cast<int>(TX_64X64)),
                        ::testing::Values(static_cast<int>(EB_TEN_BIT)),
                        ::testing::Values(svt_av1_highbd_quantize_b_qm_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    LBD_AVX512, QuantizeBQmTest,
+    ::testing::Combine(::testing::Values(static_cast<int>(TX_4X4),
+                                         static_cast<int>(TX_16X16),
+                                         static_cast<int>(TX_32X32),
+                                         static_cast<int>(TX_64X64)),
+                       ::testing::Values(static_cast<int>(EB_EIGHT_BIT)),
+                       ::testing::Values(svt_av1_quantize_b_qm_avx512)));
+
+INSTANTIATE_TEST_SUITE_P(
+    HBD_AVX512, QuantizeBQmTest,
+    ::testing::Combine(::testing::Values(static_cast<int>(TX_4X4),
+                                         static_cast<int>(TX_16X16),
+                                         static_cast<int>(TX_32X32),
+                                         static_cast<int>(TX_64X64)),
+                       ::testing::Values(static_cast<int>(EB_TEN_BIT)),
+                       ::testing::Values(svt_av1_highbd_quantize_b_qm_avx512)));
+#endif  // EN_AVX512_SUPPORT
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
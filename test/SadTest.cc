@@ -936,6 +936,78 @@ class Allsad8x8_CalculationTest
         ASSERT_TRUE(0);
     }
 
+    void speed_sad(Bool sub_sad) {
+        const uint64_t num_loop = 100000;
+        uint32_t best_sad8x8[2][64];
+        uint32_t best_mv8x8[2][64] = {{0}};
+        uint32_t best_sad16x16[2][16];
+        uint32_t best_mv16x16[2][16] = {{0}};
+        uint32_t eight_sad16x16[2][16][8];
+        uint32_t eight_sad8x8[2][64][8];
+        double time_c, time_o;
+        uint64_t start_time_seconds, start_time_useconds;
+        uint64_t finish_time_seconds, finish_time_useconds;
+
+        fill_buf_with_value(&best_sad8x8[0][0], 2 * 64, BEST_SAD_MAX);
+        fill_buf_with_value(&best_sad16x16[0][0], 2 * 16, UINT_MAX);
+        prepare_data();
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (uint64_t i = 0; i < num_loop; i++) {
+            svt_ext_all_sad_calculation_8x8_16x16_c(src_aligned_,
+                                                    src_stride_,
+                                                    ref1_aligned_,
+                                                    ref1_stride_,
+                                                    0,
+                                                    best_sad8x8[0],
+                                                    best_sad16x16[0],
+                                                    best_mv8x8[0],
+                                                    best_mv16x16[0],
+                                                    eight_sad16x16[0],
+                                                    eight_sad8x8[0],
+                                                    sub_sad);
+        }
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+        time_c = svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                         start_time_useconds,
+                                                         finish_time_seconds,
+                                                         finish_time_useconds);
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (uint64_t i = 0; i < num_loop; i++) {
+            test_func_(src_aligned_,
+                       src_stride_,
+                       ref1_aligned_,
+                       ref1_stride_,
+                       0,
+                       best_sad8x8[1],
+                       best_sad16x16[1],
+                       best_mv8x8[1],
+                       best_mv16x16[1],
+                       eight_sad16x16[1],
+                       eight_sad8x8[1],
+                       sub_sad);
+        }
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+        time_o = svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                         start_time_useconds,
+                                                         finish_time_seconds,
+                                                         finish_time_useconds);
+
+        EXPECT_EQ(
+            0, memcmp(best_sad8x8[0], best_sad8x8[1], sizeof(best_sad8x8[0])))
+            << "compare best_sad8x8 error";
+        EXPECT_EQ(
+            0,
+            memcmp(
+                best_sad16x16[0], best_sad16x16[1], sizeof(best_sad16x16[0])))
+            << "compare best_sad16x16 error";
+
+        printf("    svt_ext_all_sad_calculation_8x8_16x16(sub_sad %d): %5.2fx\n",
+               sub_sad,
+               time_c / time_o);
+    }
+
     svt_ext_all_sad_calculation_8x8_16x16_fn test_func_;
 };
 
@@ -943,6 +1015,11 @@ TEST_P(Allsad8x8_CalculationTest, check_sad8x8) {
     check_sad();
 }
 
+TEST_P(Allsad8x8_CalculationTest, DISABLED_speed_sad8x8) {
+    speed_sad(false);
+    speed_sad(true);
+}
+
 #ifdef ARCH_X86_64
 INSTANTIATE_TEST_SUITE_P(
     SSE4_1, Allsad8x8_CalculationTest,
@@ -957,6 +1034,15 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::ValuesIn(TEST_PATTERNS),
         ::testing::ValuesIn(TEST_SAD_PATTERNS),
         ::testing::Values(svt_ext_all_sad_calculation_8x8_16x16_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, Allsad8x8_CalculationTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PATTERNS),
+        ::testing::ValuesIn(TEST_SAD_PATTERNS),
+        ::testing::Values(svt_ext_all_sad_calculation_8x8_16x16_avx512)));
+#endif
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -1060,6 +1146,15 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::ValuesIn(TEST_PATTERNS),
         ::testing::ValuesIn(TEST_SAD_PATTERNS),
         ::testing::Values(svt_ext_eight_sad_calculation_32x32_64x64_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, Allsad32x32_CalculationTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PATTERNS),
+        ::testing::ValuesIn(TEST_SAD_PATTERNS),
+        ::testing::Values(svt_ext_eight_sad_calculation_32x32_64x64_avx512)));
+#endif
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -1350,6 +1445,15 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::ValuesIn(TEST_PATTERNS),
         ::testing::ValuesIn(TEST_SAD_PATTERNS),
         ::testing::Values(svt_ext_sad_calculation_32x32_64x64_sse4_intrin)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, Extsad32x32_CalculationTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(TEST_PATTERNS),
+        ::testing::ValuesIn(TEST_SAD_PATTERNS),
+        ::testing::Values(svt_ext_sad_calculation_32x32_64x64_avx512)));
+#endif
 #endif  // ARCH_X86_64
 
 typedef void (*InitBufferFunc)(uint32_t *pointer, uint32_t count128,
@@ -451,6 +451,12 @@ INSTANTIATE_TEST_SUITE_P(
     AVX2, TemporalFilterTestPlanewiseMedium,
     ::testing::Values(svt_av1_apply_temporal_filter_planewise_medium_avx2));
 
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, TemporalFilterTestPlanewiseMedium,
+    ::testing::Values(svt_av1_apply_temporal_filter_planewise_medium_avx512));
+#endif
+
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -957,6 +963,13 @@ INSTANTIATE_TEST_SUITE_P(
     AVX2, TemporalFilterTestPlanewiseMediumHbd,
     ::testing::Values(svt_av1_apply_temporal_filter_planewise_medium_hbd_avx2));
 
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, TemporalFilterTestPlanewiseMediumHbd,
+    ::testing::Values(
+        svt_av1_apply_temporal_filter_planewise_medium_hbd_avx512));
+#endif
+
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -967,6 +980,203 @@ INSTANTIATE_TEST_SUITE_P(
 
 #endif  // ARCH_AARCH64
 
+typedef void (*TemporalFilterZZFunc)(
+    struct MeContext *me_ctx, const uint8_t *y_pre, int y_pre_stride,
+    const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride,
+    unsigned int block_width, unsigned int block_height, int ss_x, int ss_y,
+    uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+    uint32_t *v_accum, uint16_t *v_count);
+
+typedef void (*TemporalFilterZZFuncHbd)(
+    struct MeContext *me_ctx, const uint16_t *y_pre, int y_pre_stride,
+    const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride,
+    unsigned int block_width, unsigned int block_height, int ss_x, int ss_y,
+    uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count,
+    uint32_t *v_accum, uint16_t *v_count, uint32_t encoder_bit_depth);
+
+// Zero-motion (zz) based filtering only reads the predictor and the
+// block errors, so a single class covers both bit depths: hbd parameters
+// are used when the lbd function pointer is NULL.
+typedef std::tuple<TemporalFilterZZFunc, TemporalFilterZZFuncHbd>
+    TemporalFilterZZParam;
+
+class TemporalFilterTestZZBasedMedium
+    : public ::testing::TestWithParam<TemporalFilterZZParam> {
+  public:
+    TemporalFilterTestZZBasedMedium() : rnd_(0, (1 << 10) - 1){};
+    ~TemporalFilterTestZZBasedMedium() {
+    }
+
+    void SetUp() {
+        setup_test_env();
+        tst_func_ = TEST_GET_PARAM(0);
+        tst_func_hbd_ = TEST_GET_PARAM(1);
+
+        for (int c = 0; c < COLOR_CHANNELS; c++) {
+            pred_ptr[c] = reinterpret_cast<uint8_t *>(
+                svt_aom_memalign(8, MAX_STRIDE * MAX_STRIDE));
+            pred_ptr_hbd[c] = reinterpret_cast<uint16_t *>(svt_aom_memalign(
+                8, MAX_STRIDE * MAX_STRIDE * sizeof(uint16_t)));
+            for (int i = 0; i < 2; i++) {
+                accum_ptr[i][c] = reinterpret_cast<uint32_t *>(
+                    svt_aom_memalign(
+                        8, MAX_STRIDE * MAX_STRIDE * sizeof(uint32_t)));
+                count_ptr[i][c] = reinterpret_cast<uint16_t *>(
+                    svt_aom_memalign(
+                        8, MAX_STRIDE * MAX_STRIDE * sizeof(uint16_t)));
+                memset(accum_ptr[i][c],
+                       0,
+                       MAX_STRIDE * MAX_STRIDE * sizeof(uint32_t));
+                memset(count_ptr[i][c],
+                       0,
+                       MAX_STRIDE * MAX_STRIDE * sizeof(uint16_t));
+            }
+        }
+    }
+
+    void TearDown() {
+        for (int c = 0; c < COLOR_CHANNELS; c++) {
+            svt_aom_free(pred_ptr[c]);
+            svt_aom_free(pred_ptr_hbd[c]);
+            for (int i = 0; i < 2; i++) {
+                svt_aom_free(accum_ptr[i][c]);
+                svt_aom_free(count_ptr[i][c]);
+            }
+        }
+    }
+
+    void RunFunc(int idx, struct MeContext *me_ctx, int width, int height) {
+        if (tst_func_hbd_ == NULL) {
+            TemporalFilterZZFunc func =
+                idx ? tst_func_
+                    : svt_av1_apply_zz_based_temporal_filter_planewise_medium_c;
+            func(me_ctx,
+                 pred_ptr[C_Y],
+                 MAX_STRIDE,
+                 pred_ptr[C_U],
+                 pred_ptr[C_V],
+                 MAX_STRIDE,
+                 width,
+                 height,
+                 1,  // subsampling
+                 1,  // subsampling
+                 accum_ptr[idx][C_Y],
+                 count_ptr[idx][C_Y],
+                 accum_ptr[idx][C_U],
+                 count_ptr[idx][C_U],
+                 accum_ptr[idx][C_V],
+                 count_ptr[idx][C_V]);
+        } else {
+            TemporalFilterZZFuncHbd func =
+                idx ? tst_func_hbd_
+                    : svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_c;
+            func(me_ctx,
+                 pred_ptr_hbd[C_Y],
+                 MAX_STRIDE,
+                 pred_ptr_hbd[C_U],
+                 pred_ptr_hbd[C_V],
+                 MAX_STRIDE,
+                 width,
+                 height,
+                 1,  // subsampling
+                 1,  // subsampling
+                 accum_ptr[idx][C_Y],
+                 count_ptr[idx][C_Y],
+                 accum_ptr[idx][C_U],
+                 count_ptr[idx][C_U],
+                 accum_ptr[idx][C_V],
+                 count_ptr[idx][C_V],
+                 10);
+        }
+    }
+
+    void RunTest(int width, int height, int run_times) {
+        struct MeContext context1, context2, *me_ctx;
+        TemporalFilterFillMeContexts(&context1, &context2);
+
+        for (int j = 0; j < run_times; j++) {
+            me_ctx = (j % 2 == 0) ? &context1 : &context2;
+            for (int c = 0; c < COLOR_CHANNELS; c++) {
+                me_ctx->tf_decay_factor_fp16[c] = FLOAT2FP(
+                    (float)fclamp((rnd_.random_float() * 100000.0f), 1.0, 32760),
+                    16,
+                    uint32_t);
+                for (int ii = 0; ii < height; ii++) {
+                    for (int jj = 0; jj < width; jj++) {
+                        pred_ptr[c][ii * MAX_STRIDE + jj] = rnd_.Rand8();
+                        pred_ptr_hbd[c][ii * MAX_STRIDE + jj] = rnd_.random();
+                    }
+                }
+            }
+            // Cover both the split and the non-split 32x32 paths
+            me_ctx->tf_32x32_block_split_flag[me_ctx->tf_block_col] = j & 2;
+
+            RunFunc(0, me_ctx, width, height);
+            RunFunc(1, me_ctx, width, height);
+
+            for (int c = 0; c < COLOR_CHANNELS; c++) {
+                EXPECT_EQ(memcmp(accum_ptr[0][c],
+                                 accum_ptr[1][c],
+                                 MAX_STRIDE * MAX_STRIDE * sizeof(uint32_t)),
+                          0);
+                EXPECT_EQ(memcmp(count_ptr[0][c],
+                                 count_ptr[1][c],
+                                 MAX_STRIDE * MAX_STRIDE * sizeof(uint16_t)),
+                          0);
+            }
+        }
+    }
+
+  private:
+    TemporalFilterZZFunc tst_func_;
+    TemporalFilterZZFuncHbd tst_func_hbd_;
+    SVTRandom rnd_;
+    uint8_t *pred_ptr[COLOR_CHANNELS];
+    uint16_t *pred_ptr_hbd[COLOR_CHANNELS];
+    uint32_t *accum_ptr[2][COLOR_CHANNELS];
+    uint16_t *count_ptr[2][COLOR_CHANNELS];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TemporalFilterTestZZBasedMedium);
+
+TEST_P(TemporalFilterTestZZBasedMedium, OperationCheck) {
+    RunTest(32, 32, 100);
+}
+
+#ifdef ARCH_X86_64
+
+INSTANTIATE_TEST_SUITE_P(
+    SSE4_1, TemporalFilterTestZZBasedMedium,
+    ::testing::Values(
+        TemporalFilterZZParam(
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_sse4_1,
+            NULL),
+        TemporalFilterZZParam(
+            NULL,
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_sse4_1)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, TemporalFilterTestZZBasedMedium,
+    ::testing::Values(
+        TemporalFilterZZParam(
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_avx2, NULL),
+        TemporalFilterZZParam(
+            NULL,
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, TemporalFilterTestZZBasedMedium,
+    ::testing::Values(
+        TemporalFilterZZParam(
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_avx512,
+            NULL),
+        TemporalFilterZZParam(
+            NULL,
+            svt_av1_apply_zz_based_temporal_filter_planewise_medium_hbd_avx512)));
+#endif
+
+#endif  // ARCH_X86_64
+
 typedef void (*get_final_filtered_pixels_fn)(
     struct MeContext *me_ctx, EbByte *src_center_ptr_start,
     uint16_t **altref_buffer_highbd_start, uint32_t **accum, uint16_t **count,
@@ -1327,6 +1537,15 @@ int32_t estimate_noise_fp16_avx2_wrapper(const uint16_t *src, int width,
         (const uint8_t *)src, width, height, stride);
 }
 
+#if EN_AVX512_SUPPORT
+int32_t estimate_noise_fp16_avx512_wrapper(const uint16_t *src, int width,
+                                           int height, int stride, int bd) {
+    UNUSED(bd);
+    return svt_estimate_noise_fp16_avx512(
+        (const uint8_t *)src, width, height, stride);
+}
+#endif
+
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
@@ -1435,6 +1654,24 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::Values(2160, 1080, 720, 600, 480, 240),
                        ::testing::Values(10, 12)));
 
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, EstimateNoiseTestFP,
+    ::testing::Combine(::testing::Values(estimate_noise_fp16_c_wrapper),
+                       ::testing::Values(estimate_noise_fp16_avx512_wrapper),
+                       ::testing::Values(3840, 1920, 1280, 800, 640, 360),
+                       ::testing::Values(2160, 1080, 720, 600, 480, 240),
+                       ::testing::Values(8)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, EstimateNoiseTestFPHbd,
+    ::testing::Combine(::testing::Values(svt_estimate_noise_highbd_fp16_c),
+                       ::testing::Values(svt_estimate_noise_highbd_fp16_avx512),
+                       ::testing::Values(3840, 1920, 1280, 800, 640, 360),
+                       ::testing::Values(2160, 1080, 720, 600, 480, 240),
+                       ::testing::Values(10, 12)));
+#endif
+
 #endif
 
 #ifdef ARCH_AARCH64
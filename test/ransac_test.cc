@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file ransac_test.cc
+ *
+ * @brief Unit test for the RANSAC inlier distance kernel:
+ * - svt_av1_ransac_inlier_dist_avx2
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "definitions.h"
+#include "util.h"
+#include "acm_random.h"
+
+using libaom_test::ACMRandom;
+
+namespace {
+
+typedef void (*RansacInlierDistFunc)(const float *mat, const float *x1,
+                                     const float *y1, const float *x2,
+                                     const float *y2, float *dist_pow2, int n);
+
+using ::testing::make_tuple;
+using ::testing::tuple;
+// <number of points, tested function>
+typedef tuple<int, RansacInlierDistFunc> RansacInlierDistParam;
+
+class RansacInlierDistTest
+    : public ::testing::TestWithParam<RansacInlierDistParam> {
+  public:
+    void SetUp() override {
+        rnd_.Reset(ACMRandom::DeterministicSeed());
+        n_ = TEST_GET_PARAM(0);
+        target_func_ = TEST_GET_PARAM(1);
+    }
+
+  protected:
+    // Random affine model close to the identity, as found between
+    // neighbouring frames, with a translation of up to +/-32 pixels
+    void fill_model(float *mat) {
+        mat[0] = (rnd_.Rand16() % 6401 - 3200) / 100.0f;
+        mat[1] = (rnd_.Rand16() % 6401 - 3200) / 100.0f;
+        mat[2] = 1.0f + (rnd_.Rand16() % 201 - 100) / 1000.0f;
+        mat[3] = (rnd_.Rand16() % 201 - 100) / 1000.0f;
+        mat[4] = (rnd_.Rand16() % 201 - 100) / 1000.0f;
+        mat[5] = 1.0f + (rnd_.Rand16() % 201 - 100) / 1000.0f;
+    }
+
+    void run_check_output() {
+        const int max_coord = 4096;
+        float mat[6];
+        float *x1 = new float[n_];
+        float *y1 = new float[n_];
+        float *x2 = new float[n_];
+        float *y2 = new float[n_];
+        float *dist_ref = new float[n_];
+        float *dist_tst = new float[n_];
+
+        for (int iter = 0; iter < 100; ++iter) {
+            fill_model(mat);
+            for (int i = 0; i < n_; ++i) {
+                x1[i] = (float)(rnd_.Rand16() % max_coord);
+                y1[i] = (float)(rnd_.Rand16() % max_coord);
+                // Half of the points follow the model, the others are noise
+                if (i & 1) {
+                    x2[i] = (float)(int)(mat[2] * x1[i] + mat[3] * y1[i] +
+                                         mat[0] + rnd_.Rand8() % 3 - 1);
+                    y2[i] = (float)(int)(mat[4] * x1[i] + mat[5] * y1[i] +
+                                         mat[1] + rnd_.Rand8() % 3 - 1);
+                } else {
+                    x2[i] = (float)(rnd_.Rand16() % max_coord);
+                    y2[i] = (float)(rnd_.Rand16() % max_coord);
+                }
+            }
+
+            svt_av1_ransac_inlier_dist_c(mat, x1, y1, x2, y2, dist_ref, n_);
+            target_func_(mat, x1, y1, x2, y2, dist_tst, n_);
+
+            for (int i = 0; i < n_; ++i)
+                ASSERT_EQ(dist_ref[i], dist_tst[i])
+                    << "iter " << iter << " point " << i;
+        }
+
+        delete[] x1;
+        delete[] y1;
+        delete[] x2;
+        delete[] y2;
+        delete[] dist_ref;
+        delete[] dist_tst;
+    }
+
+    int n_;
+    RansacInlierDistFunc target_func_;
+    ACMRandom rnd_;
+};
+
+TEST_P(RansacInlierDistTest, CheckOutput) {
+    run_check_output();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, RansacInlierDistTest,
+    ::testing::Combine(::testing::Values(1, 7, 8, 15, 64, 301, 4096),
+                       ::testing::Values(&svt_av1_ransac_inlier_dist_avx2)));
+
+}  // namespace
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Alliance for Open Media. All rights reserved
+#
+# This source code is subject to the terms of the BSD 2 Clause License and
+# the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+# was not distributed with this source code in the LICENSE file, you can
+# obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+# Media Patent License 1.0 was not distributed with this source code in the
+# PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+#
+"""Train the MD early termination models (--md-early-term) from feature dumps.
+
+Dump the features by running the encoder with the models off and the
+SVT_ETM_DUMP_FILE environment variable set, e.g.
+
+    SVT_ETM_DUMP_FILE=clip.csv SvtAv1EncApp -i clip.y4m --preset 6 -b clip.ivf
+
+then train on one or more dumps and write the C tables:
+
+    test/train_md_early_term.py clip*.csv -o Source/Lib/Codec/md_early_term_weights.h
+
+Each model is a sum of small regression trees trained with logistic loss
+(gradient boosting) to predict that the search it prunes is useless
+(label 0 in the dump). Leaves and thresholds are stored as integers; the
+score is a logit in Q8. One decision threshold is derived per level, as the
+lowest score for which at most the given share of the pruned samples would
+have needed the search. Only the Python standard library is used.
+"""
+
+import argparse
+import bisect
+import csv
+import math
+import sys
+
+MODELS = ("split", "nsq")
+Q = 256  # score scale (Q8)
+
+
+def load(paths):
+    data = {m: ([], []) for m in range(len(MODELS))}
+    names = None
+    for path in paths:
+        with open(path, newline="") as f:
+            reader = csv.reader(f)
+            header = next(reader)
+            if names is None:
+                names = header[2:]
+            elif names != header[2:]:
+                sys.exit("%s: feature columns differ from the first dump" % path)
+            for row in reader:
+                x, y = data[int(row[0])]
+                x.append([int(v) for v in row[2:]])
+                # Positive class: pruning is safe (the search was not useful)
+                y.append(1 - int(row[1]))
+    return names, data
+
+
+def make_edges(values, bins):
+    uniq = sorted(set(values))
+    if len(uniq) <= bins:
+        return uniq
+    s = sorted(values)
+    edges = sorted(set(s[min(len(s) - 1, (i * len(s)) // bins)] for i in range(1, bins + 1)))
+    if edges[-1] != uniq[-1]:
+        edges.append(uniq[-1])
+    return edges
+
+
+class Trainer:
+    def __init__(self, x, y, args):
+        self.n = len(y)
+        self.y = y
+        self.args = args
+        nf = len(x[0])
+        self.edges = [make_edges([r[f] for r in x], args.bins) for f in range(nf)]
+        # Column-major bin indices: feature <= edges[b] <=> bin <= b
+        self.bins = [[bisect.bisect_left(self.edges[f], r[f]) for r in x] for f in range(nf)]
+
+    def build(self, idx, g, h, depth, nodes):
+        lam, min_leaf = self.args.l2, self.args.min_leaf
+        gs = sum(g[i] for i in idx)
+        hs = sum(h[i] for i in idx)
+        best = None
+        if depth < self.args.depth and len(idx) >= 2 * min_leaf:
+            base = gs * gs / (hs + lam)
+            for f, col in enumerate(self.bins):
+                nb = len(self.edges[f])
+                hg, hh, hc = [0.0] * nb, [0.0] * nb, [0] * nb
+                for i in idx:
+                    b = col[i]
+                    hg[b] += g[i]
+                    hh[b] += h[i]
+                    hc[b] += 1
+                gl = hl = 0.0
+                cl = 0
+                for b in range(nb - 1):
+                    gl += hg[b]
+                    hl += hh[b]
+                    cl += hc[b]
+                    if cl < min_leaf or len(idx) - cl < min_leaf:
+                        continue
+                    gr, hr = gs - gl, hs - hl
+                    gain = gl * gl / (hl + lam) + gr * gr / (hr + lam) - base
+                    if gain > self.args.min_gain and (best is None or gain > best[0]):
+                        best = (gain, f, b)
+        node = len(nodes)
+        if best is None:
+            nodes.append([-1, int(round(self.args.lr * gs / (hs + lam) * Q)), 0, 0])
+            return node
+        _, f, b = best
+        nodes.append([f, self.edges[f][b], 0, 0])
+        col = self.bins[f]
+        nodes[node][2] = self.build([i for i in idx if col[i] <= b], g, h, depth + 1, nodes)
+        nodes[node][3] = self.build([i for i in idx if col[i] > b], g, h, depth + 1, nodes)
+        return node
+
+    def train(self, train_idx):
+        pos = sum(self.y[i] for i in train_idx)
+        pos = min(max(pos, 1), len(train_idx) - 1)
+        bias = int(round(math.log(pos / (len(train_idx) - pos)) * Q))
+        score = [bias] * self.n
+        nodes, roots = [], []
+        for _ in range(self.args.trees):
+            g, h = [0.0] * self.n, [0.0] * self.n
+            for i in train_idx:
+                p = 1.0 / (1.0 + math.exp(-score[i] / Q))
+                g[i] = self.y[i] - p
+                h[i] = max(p * (1.0 - p), 1e-6)
+            root = self.build(train_idx, g, h, 0, nodes)
+            roots.append(root)
+            for i in range(self.n):
+                score[i] += leaf_value(nodes, root, lambda f: self.edges_value(f, i))
+        return bias, nodes, roots, score
+
+    def edges_value(self, f, i):
+        # Representative feature value of the bin, consistent with the integer split thresholds
+        return self.edges[f][self.bins[f][i]]
+
+
+def leaf_value(nodes, root, feature):
+    node = nodes[root]
+    while node[0] >= 0:
+        node = nodes[node[2] if feature(node[0]) <= node[1] else node[3]]
+    return node[1]
+
+
+def pick_threshold(score, y, idx, max_err):
+    # Lowest threshold such that the pruned samples (score >= th) hold at most max_err of needed searches
+    order = sorted(idx, key=lambda i: -score[i])
+    th, bad, cnt = None, 0, 0
+    for k, i in enumerate(order):
+        cnt += 1
+        bad += 1 - y[i]
+        last = k + 1 == len(order) or score[order[k + 1]] != score[i]
+        if last and bad <= max_err * cnt:
+            th = score[i]
+    return th if th is not None else 2**31 - 1
+
+
+def evaluate(score, y, idx, th):
+    pruned = [i for i in idx if score[i] >= th]
+    bad = sum(1 - y[i] for i in pruned)
+    need = sum(1 - y[i] for i in idx)
+    return len(pruned) / max(len(idx), 1), bad / max(len(pruned), 1), bad / max(need, 1)
+
+
+def emit(out, models):
+    lines = [
+        "/*",
+        " * Copyright (c) 2026, Alliance for Open Media. All rights reserved",
+        " *",
+        " * This source code is subject to the terms of the BSD 2 Clause License and",
+        " * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License",
+        " * was not distributed with this source code in the LICENSE file, you can",
+        " * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open",
+        " * Media Patent License 1.0 was not distributed with this source code in the",
+        " * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.",
+        " */",
+        "",
+        "// Generated by test/train_md_early_term.py; do not edit.",
+        "",
+        "#ifndef EbMdEarlyTermWeights_h",
+        "#define EbMdEarlyTermWeights_h",
+        "",
+        '#include "md_early_term.h"',
+        "",
+        "// clang-format off",
+    ]
+    for name, (bias, nodes, roots, ths) in zip(MODELS, models):
+        if not nodes:
+            nodes, roots = [[-1, 0, 0, 0]], [0]
+        lines.append("static const EtmNode etm_%s_nodes[] = {" % name)
+        for k in range(0, len(nodes), 4):
+            lines.append("    " + " ".join("{%d, %d, %d, %d}," % tuple(n) for n in nodes[k:k + 4]))
+        lines.append("};")
+        lines.append("static const uint16_t etm_%s_roots[] = {%s};" % (name, ", ".join(str(r) for r in roots)))
+        lines.append("static const EtmModel etm_%s_model = {etm_%s_nodes, etm_%s_roots, %d, %d, {%s}};" %
+                     (name, name, name, len(roots) if nodes != [[-1, 0, 0, 0]] else 0, bias,
+                      ", ".join("INT32_MAX" if t >= 2**31 - 1 else str(t) for t in ths)))
+        lines.append("")
+    lines += ["// clang-format on", "", "#endif // EbMdEarlyTermWeights_h", ""]
+    with open(out, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("dumps", nargs="+", help="feature dumps (CSV) written through SVT_ETM_DUMP_FILE")
+    ap.add_argument("-o", "--output", required=True, help="generated C header")
+    ap.add_argument("--trees", type=int, default=16)
+    ap.add_argument("--depth", type=int, default=3)
+    ap.add_argument("--lr", type=float, default=0.3, help="learning rate")
+    ap.add_argument("--l2", type=float, default=1.0, help="leaf L2 regularization")
+    ap.add_argument("--bins", type=int, default=32, help="candidate thresholds per feature")
+    ap.add_argument("--min-leaf", type=int, default=50)
+    ap.add_argument("--min-gain", type=float, default=1.0)
+    ap.add_argument("--max-err", default="0.02,0.05",
+                    help="share of wrongly pruned samples allowed at each level (comma separated)")
+    args = ap.parse_args()
+    max_err = [float(v) for v in args.max_err.split(",")]
+
+    names, data = load(args.dumps)
+    models = []
+    for m, name in enumerate(MODELS):
+        x, y = data[m]
+        if len(y) < 4 * args.min_leaf:
+            print("%s: %d samples, model left empty" % (name, len(y)))
+            models.append((0, [], [], [2**31 - 1] * len(max_err)))
+            continue
+        trainer = Trainer(x, y, args)
+        # Every 5th sample is held out to report the operating points
+        train_idx = [i for i in range(len(y)) if i % 5]
+        test_idx = [i for i in range(len(y)) if not i % 5]
+        bias, nodes, roots, score = trainer.train(train_idx)
+        ths = [pick_threshold(score, y, train_idx, e) for e in max_err]
+        print("%s: %d samples, %.1f%% prunable, %d trees, %d nodes" %
+              (name, len(y), 100.0 * sum(y) / len(y), len(roots), len(nodes)))
+        for lvl, th in enumerate(ths):
+            rate, err, miss = evaluate(score, y, test_idx, th)
+            print("  level %d: th %d, held-out prune rate %.1f%%, wrong prunes %.1f%% (%.1f%% of the needed searches)" %
+                  (lvl + 1, th, 100 * rate, 100 * err, 100 * miss))
+        used = sorted(set(n[0] for n in nodes if n[0] >= 0))
+        print("  features used: %s" % ", ".join(names[f] for f in used))
+        models.append((bias, nodes, roots, ths))
+    emit(args.output, models)
+
+
+if __name__ == "__main__":
+    main()